@@ -11,6 +11,7 @@
 #ifndef AMANZI_RELATIONS_EOS_HH_
 #define AMANZI_RELATIONS_EOS_HH_
 
+#include <algorithm>
 #include <vector>
 
 namespace Amanzi {
@@ -35,6 +36,40 @@ class EOS {
   // !IsConstantMolarMass()
   virtual bool IsConstantMolarMass() = 0;
   virtual double MolarMass() = 0;
+
+  // Batched methods, evaluating the EOS at n (temperature, pressure) points.
+  // The defaults call the pointwise methods above; EOSs which depend only on
+  // temperature and pressure override these with allocation-free loops.
+  virtual void MassDensityBatch(const double* T, const double* p, double* out, int n) {
+    Batch_(&EOS::MassDensity, T, p, out, n);
+  }
+  virtual void DMassDensityDTBatch(const double* T, const double* p, double* out, int n) {
+    Batch_(&EOS::DMassDensityDT, T, p, out, n);
+  }
+  virtual void DMassDensityDpBatch(const double* T, const double* p, double* out, int n) {
+    Batch_(&EOS::DMassDensityDp, T, p, out, n);
+  }
+
+  virtual void MolarDensityBatch(const double* T, const double* p, double* out, int n) {
+    Batch_(&EOS::MolarDensity, T, p, out, n);
+  }
+  virtual void DMolarDensityDTBatch(const double* T, const double* p, double* out, int n) {
+    Batch_(&EOS::DMolarDensityDT, T, p, out, n);
+  }
+  virtual void DMolarDensityDpBatch(const double* T, const double* p, double* out, int n) {
+    Batch_(&EOS::DMolarDensityDp, T, p, out, n);
+  }
+
+ private:
+  void Batch_(double (EOS::*func)(std::vector<double>&),
+              const double* T, const double* p, double* out, int n) {
+    std::vector<double> params(2);
+    for (int i=0; i!=n; ++i) {
+      params[0] = T[i];
+      params[1] = p[i];
+      out[i] = (this->*func)(params);
+    }
+  }
 };
 
 } // namespace
@@ -35,6 +35,22 @@ public:
   virtual double DMolarDensityDT(std::vector<double>& params) override { return 0.0; }
   virtual double DMolarDensityDp(std::vector<double>& params) override { return 0.0; }
 
+  virtual void MassDensityBatch(const double* T, const double* p, double* out, int n) override {
+    std::fill(out, out+n, rho_);
+  }
+  virtual void DMassDensityDTBatch(const double* T, const double* p, double* out, int n) override {
+    std::fill(out, out+n, 0.0);
+  }
+  virtual void DMassDensityDpBatch(const double* T, const double* p, double* out, int n) override {
+    std::fill(out, out+n, 0.0);
+  }
+  virtual void DMolarDensityDTBatch(const double* T, const double* p, double* out, int n) override {
+    std::fill(out, out+n, 0.0);
+  }
+  virtual void DMolarDensityDpBatch(const double* T, const double* p, double* out, int n) override {
+    std::fill(out, out+n, 0.0);
+  }
+
 private:
   virtual void InitializeFromPlist_();
 
@@ -55,6 +55,36 @@ class EOSConstantMolarMass : public EOS {
     return DMolarDensityDp(params) * M_;
   }
 
+  virtual void MolarDensityBatch(const double* T, const double* p, double* out, int n) {
+    MassDensityBatch(T, p, out, n);
+    for (int i=0; i!=n; ++i) out[i] /= M_;
+  }
+
+  virtual void DMolarDensityDTBatch(const double* T, const double* p, double* out, int n) {
+    DMassDensityDTBatch(T, p, out, n);
+    for (int i=0; i!=n; ++i) out[i] /= M_;
+  }
+
+  virtual void DMolarDensityDpBatch(const double* T, const double* p, double* out, int n) {
+    DMassDensityDpBatch(T, p, out, n);
+    for (int i=0; i!=n; ++i) out[i] /= M_;
+  }
+
+  virtual void MassDensityBatch(const double* T, const double* p, double* out, int n) {
+    MolarDensityBatch(T, p, out, n);
+    for (int i=0; i!=n; ++i) out[i] *= M_;
+  }
+
+  virtual void DMassDensityDTBatch(const double* T, const double* p, double* out, int n) {
+    DMolarDensityDTBatch(T, p, out, n);
+    for (int i=0; i!=n; ++i) out[i] *= M_;
+  }
+
+  virtual void DMassDensityDpBatch(const double* T, const double* p, double* out, int n) {
+    DMolarDensityDpBatch(T, p, out, n);
+    for (int i=0; i!=n; ++i) out[i] *= M_;
+  }
+
   virtual bool IsConstantMolarMass() { return true; }
   virtual double MolarMass() { return M_; }
 
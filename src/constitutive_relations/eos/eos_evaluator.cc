@@ -123,6 +123,11 @@ void EOSEvaluator::EvaluateField_(const Teuchos::Ptr<State>& S,
     mass_dens = results[1];
   }
 
+  // The batched EOS methods take temperature and pressure, but the
+  // dependencies here are an arbitrary, name-sorted set: which one is
+  // temperature is not known, and the EOS may take more than two parameters
+  // (as in EOSEvaluatorCTP).  So this evaluator stays pointwise;
+  // EOSEvaluatorTP is the batched one.
   if (molar_dens != Teuchos::null) {
     // evaluate MolarDensity()
     for (CompositeVector::name_iterator comp=molar_dens->begin();
@@ -61,9 +61,6 @@ Teuchos::RCP<FieldEvaluator> EOSEvaluatorTP::Clone() const {
 void EOSEvaluatorTP::EvaluateField_(const Teuchos::Ptr<State>& S,
                          const std::vector<Teuchos::Ptr<CompositeVector> >& results) {
   
-  int num_dep = dependencies_.size();  
-  std::vector<double> eos_params(num_dep);
-
   Teuchos::RCP<const CompositeVector> temp = S->GetFieldData(temp_key_);
   Teuchos::RCP<const CompositeVector> pres = S->GetFieldData(pres_key_);
 
@@ -91,13 +88,9 @@ void EOSEvaluatorTP::EvaluateField_(const Teuchos::Ptr<State>& S,
       Epetra_MultiVector& dens_v = *(molar_dens->ViewComponent(*comp,false));
 
       int count = dens_v.MyLength();
+      eos_->MolarDensityBatch(temp_v[0], pres_v[0], dens_v[0], count);
+
       for (int id=0; id!=count; ++id) {
-        
-        eos_params[0] = temp_v[0][id];
-        eos_params[1] = pres_v[0][id];
-       
-        dens_v[0][id] = eos_->MolarDensity(eos_params);
-                  
         if (dens_v[0][id] < 0.){
           Errors::Message msg;
           msg<<"Values of pressure and temperature result in negative density\n"<<
@@ -106,7 +99,6 @@ void EOSEvaluatorTP::EvaluateField_(const Teuchos::Ptr<State>& S,
             "Density "<< dens_v[0][id]<<"\n";
           Exceptions::amanzi_throw(msg);
         }
-        
       }
     }
   }
@@ -129,25 +121,91 @@ void EOSEvaluatorTP::EvaluateField_(const Teuchos::Ptr<State>& S,
         Epetra_MultiVector& dens_v = *(mass_dens->ViewComponent(*comp,false));
 
         int count = dens_v.MyLength();
-        for (int id=0; id!=count; ++id) {
-          
-          eos_params[0] = temp_v[0][id];
-          eos_params[1] = pres_v[0][id];          
-          dens_v[0][id] = eos_->MassDensity(eos_params);
-          AMANZI_ASSERT(dens_v[0][id] > 0.);
+        eos_->MassDensityBatch(temp_v[0], pres_v[0], dens_v[0], count);
+#ifdef ENABLE_DBC
+        for (int id=0; id!=count; ++id) AMANZI_ASSERT(dens_v[0][id] > 0.);
+#endif
+      }
+    }
+  }
+}
+
+
+CellSubsetChange EOSEvaluatorTP::HasFieldChangedOnCells(const Teuchos::Ptr<State>& S,
+        const Key& request, const AmanziMesh::Entity_ID_List& cells) {
+  return HasFieldChangedOnCells_(S, request, cells, my_keys_[0], dependencies_, requests_,
+          [&]() { return EvaluateFieldOnCells_(S, cells); },
+          [&]() { UpdateField_(S); });
+}
+
+
+void EOSEvaluatorTP::UpdateField_(const Teuchos::Ptr<State>& S) {
+  changed_on_cells_ = false;
+  EOSEvaluator::UpdateField_(S);
+}
+
+
+bool EOSEvaluatorTP::EvaluateFieldOnCells_(const Teuchos::Ptr<State>& S,
+        const AmanziMesh::Entity_ID_List& cells) {
+  Teuchos::RCP<const CompositeVector> temp = S->GetFieldData(temp_key_);
+  Teuchos::RCP<const CompositeVector> pres = S->GetFieldData(pres_key_);
+
+  Teuchos::RCP<CompositeVector> molar_dens, mass_dens;
+  if (mode_ == EOS_MODE_MOLAR) {
+    molar_dens = S->GetFieldData(my_keys_[0], my_keys_[0]);
+  } else if (mode_ == EOS_MODE_MASS) {
+    mass_dens = S->GetFieldData(my_keys_[0], my_keys_[0]);
+  } else {
+    molar_dens = S->GetFieldData(my_keys_[0], my_keys_[0]);
+    mass_dens = S->GetFieldData(my_keys_[1], my_keys_[1]);
+  }
+
+  // as in EvaluateField_, one entity at a time
+  std::vector<AmanziMesh::Entity_ID_List> entities;
+  if (molar_dens != Teuchos::null) {
+    if (!getCellSubsetEntities(*molar_dens, cells, entities)) return false;
+
+    int n = 0;
+    for (CompositeVector::name_iterator comp=molar_dens->begin();
+         comp!=molar_dens->end(); ++comp, ++n) {
+      const Epetra_MultiVector& temp_v = *(temp->ViewComponent(*comp,false));
+      const Epetra_MultiVector& pres_v = *(pres->ViewComponent(*comp,false));
+      Epetra_MultiVector& dens_v = *(molar_dens->ViewComponent(*comp,false));
+
+      for (auto id : entities[n]) {
+        eos_->MolarDensityBatch(&temp_v[0][id], &pres_v[0][id], &dens_v[0][id], 1);
+      }
+    }
+  }
+
+  if (mass_dens != Teuchos::null) {
+    if (!getCellSubsetEntities(*mass_dens, cells, entities)) return false;
+
+    int n = 0;
+    for (CompositeVector::name_iterator comp=mass_dens->begin();
+         comp!=mass_dens->end(); ++comp, ++n) {
+      Epetra_MultiVector& dens_v = *(mass_dens->ViewComponent(*comp,false));
+      if (mode_ == EOS_MODE_BOTH && eos_->IsConstantMolarMass() &&
+          molar_dens->HasComponent(*comp)) {
+        double M = eos_->MolarMass();
+        const Epetra_MultiVector& molar_v = *(molar_dens->ViewComponent(*comp,false));
+        for (auto id : entities[n]) dens_v[0][id] = M * molar_v[0][id];
+      } else {
+        const Epetra_MultiVector& temp_v = *(temp->ViewComponent(*comp,false));
+        const Epetra_MultiVector& pres_v = *(pres->ViewComponent(*comp,false));
+        for (auto id : entities[n]) {
+          eos_->MassDensityBatch(&temp_v[0][id], &pres_v[0][id], &dens_v[0][id], 1);
         }
       }
     }
   }
+  return true;
 }
 
   
 void EOSEvaluatorTP::EvaluateFieldPartialDerivative_(const Teuchos::Ptr<State>& S,
                                                    Key wrt_key, const std::vector<Teuchos::Ptr<CompositeVector> >& results) {
   
-  int num_dep = dependencies_.size();  
-  std::vector<double> eos_params(num_dep);
-   
   // Pull dependencies out of state.  
   Teuchos::RCP<const CompositeVector> temp = S->GetFieldData(temp_key_);
   Teuchos::RCP<const CompositeVector> pres = S->GetFieldData(pres_key_);  
@@ -173,12 +231,7 @@ void EOSEvaluatorTP::EvaluateFieldPartialDerivative_(const Teuchos::Ptr<State>&
         Epetra_MultiVector& dens_v = *(molar_dens->ViewComponent(*comp,false));
 
         int count = dens_v.MyLength();
-        for (int i=0; i!=count; ++i) {
-          eos_params[0] = temp_v[0][i];
-          eos_params[1] = pres_v[0][i];
-            
-          dens_v[0][i] = eos_->DMolarDensityDp(eos_params);
-        }
+        eos_->DMolarDensityDpBatch(temp_v[0], pres_v[0], dens_v[0], count);
       }
     }
 
@@ -199,11 +252,7 @@ void EOSEvaluatorTP::EvaluateFieldPartialDerivative_(const Teuchos::Ptr<State>&
           Epetra_MultiVector& dens_v = *(mass_dens->ViewComponent(*comp,false));
 
           int count = dens_v.MyLength();
-          for (int i=0; i!=count; ++i) {
-            eos_params[0] = temp_v[0][i];
-            eos_params[1] = pres_v[0][i];            
-            dens_v[0][i] = eos_->DMassDensityDp(eos_params);
-          }
+          eos_->DMassDensityDpBatch(temp_v[0], pres_v[0], dens_v[0], count);
         }
       }
     }
@@ -219,11 +268,7 @@ void EOSEvaluatorTP::EvaluateFieldPartialDerivative_(const Teuchos::Ptr<State>&
         Epetra_MultiVector& dens_v = *(molar_dens->ViewComponent(*comp,false));
 
         int count = dens_v.MyLength();
-        for (int i=0; i!=count; ++i) {
-          eos_params[0] = temp_v[0][i];
-          eos_params[1] = pres_v[0][i];          
-          dens_v[0][i] = eos_->DMolarDensityDT(eos_params);
-        }
+        eos_->DMolarDensityDTBatch(temp_v[0], pres_v[0], dens_v[0], count);
       }
     }
 
@@ -244,11 +289,7 @@ void EOSEvaluatorTP::EvaluateFieldPartialDerivative_(const Teuchos::Ptr<State>&
           Epetra_MultiVector& dens_v = *(mass_dens->ViewComponent(*comp,false));
 
           int count = dens_v.MyLength();
-          for (int i=0; i!=count; ++i) {
-            eos_params[0] = temp_v[0][i];
-            eos_params[1] = pres_v[0][i];            
-            dens_v[0][i] = eos_->DMassDensityDT(eos_params);
-          }
+          eos_->DMassDensityDTBatch(temp_v[0], pres_v[0], dens_v[0], count);
         }
       }
     }
@@ -13,11 +13,13 @@
 #include "eos.hh"
 #include "Factory.hh"
 #include "eos_evaluator.hh"
+#include "cell_subset_evaluator.hh"
 
 namespace Amanzi {
 namespace Relations {
 
-class EOSEvaluatorTP : public EOSEvaluator {
+class EOSEvaluatorTP : public EOSEvaluator,
+                       public CellSubsetEvaluator {
 
  public:
   // constructor format for all derived classes
@@ -35,7 +37,16 @@ class EOSEvaluatorTP : public EOSEvaluator {
                                                Key wrt_key, const std::vector<Teuchos::Ptr<CompositeVector> >& results) override;
 
   Teuchos::RCP<EOS> get_EOS() { return eos_; }
+
+  // Updates the field on cells only, see CellSubsetEvaluator.
+  virtual CellSubsetChange HasFieldChangedOnCells(const Teuchos::Ptr<State>& S,
+          const Key& request, const AmanziMesh::Entity_ID_List& cells) override;
+
  protected:
+  virtual void UpdateField_(const Teuchos::Ptr<State>& S) override;
+  bool EvaluateFieldOnCells_(const Teuchos::Ptr<State>& S,
+          const AmanziMesh::Entity_ID_List& cells);
+
   // the actual model
   // Teuchos::RCP<EOS> eos_;
   // EOSMode mode_;
@@ -75,6 +75,33 @@ double EOSIce::DMassDensityDp(std::vector<double>& params) {
 };
 
 
+void EOSIce::MassDensityBatch(const double* T, const double* p, double* out, int n) {
+  for (int i=0; i!=n; ++i) {
+    double dT = T[i] - kT0_;
+    double rho1bar = ka_ + (kb_ + kc_*dT)*dT;
+    out[i] = rho1bar * (1.0 + kalpha_*(std::max(p[i], 101325.) - kp0_));
+  }
+}
+
+
+void EOSIce::DMassDensityDTBatch(const double* T, const double* p, double* out, int n) {
+  for (int i=0; i!=n; ++i) {
+    double dT = T[i] - kT0_;
+    double rho1bar = kb_ + 2.0*kc_*dT;
+    out[i] = rho1bar * (1.0 + kalpha_*(std::max(p[i], 101325.) - kp0_));
+  }
+}
+
+
+void EOSIce::DMassDensityDpBatch(const double* T, const double* p, double* out, int n) {
+  for (int i=0; i!=n; ++i) {
+    double dT = T[i] - kT0_;
+    double rho1bar = ka_ + (kb_ + kc_*dT)*dT;
+    out[i] = p[i] < 101325. ? 0. : rho1bar * kalpha_;
+  }
+}
+
+
 void EOSIce::InitializeFromPlist_() {
   if (eos_plist_.isParameter("Molar mass of ice [kg/mol]")) {
     M_ = eos_plist_.get<double>("Molar mass of ice [kg/mol]");
@@ -32,6 +32,10 @@ public:
   virtual double DMassDensityDT(std::vector<double>& params) override;
   virtual double DMassDensityDp(std::vector<double>& params) override;
 
+  virtual void MassDensityBatch(const double* T, const double* p, double* out, int n) override;
+  virtual void DMassDensityDTBatch(const double* T, const double* p, double* out, int n) override;
+  virtual void DMassDensityDpBatch(const double* T, const double* p, double* out, int n) override;
+
 private:
   virtual void InitializeFromPlist_();
 
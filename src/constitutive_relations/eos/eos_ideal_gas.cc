@@ -37,6 +37,19 @@ double EOSIdealGas::DMolarDensityDp(std::vector<double>& params) {
 };
 
 
+void EOSIdealGas::MolarDensityBatch(const double* T, const double* p, double* out, int n) {
+  for (int i=0; i!=n; ++i) out[i] = std::max(p[i], 101325.) / (R_*T[i]);
+}
+
+void EOSIdealGas::DMolarDensityDTBatch(const double* T, const double* p, double* out, int n) {
+  for (int i=0; i!=n; ++i) out[i] = -std::max(p[i], 101325.) / (R_*T[i]*T[i]);
+}
+
+void EOSIdealGas::DMolarDensityDpBatch(const double* T, const double* p, double* out, int n) {
+  for (int i=0; i!=n; ++i) out[i] = 1.0 / (R_*T[i]);
+}
+
+
 void EOSIdealGas::InitializeFromPlist_() {
   R_ = eos_plist_.get<double>("Ideal gas constant [J/mol-K]", 8.3144621);
 
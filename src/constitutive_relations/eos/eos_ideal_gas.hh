@@ -29,6 +29,10 @@ public:
   virtual double DMolarDensityDT(std::vector<double>& params) override;
   virtual double DMolarDensityDp(std::vector<double>& params) override;
 
+  virtual void MolarDensityBatch(const double* T, const double* p, double* out, int n) override;
+  virtual void DMolarDensityDTBatch(const double* T, const double* p, double* out, int n) override;
+  virtual void DMolarDensityDpBatch(const double* T, const double* p, double* out, int n) override;
+
 protected:
   virtual void InitializeFromPlist_();
 
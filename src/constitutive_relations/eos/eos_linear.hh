@@ -31,6 +31,16 @@ public:
   virtual double DMassDensityDp(std::vector<double>& params) override { return params[1] > 101325. ? rho_ * beta_ : 0.; }
   virtual double DMassDensityDT(std::vector<double>& params) override { return 0.; }
 
+  virtual void MassDensityBatch(const double* T, const double* p, double* out, int n) override {
+    for (int i=0; i!=n; ++i) out[i] = rho_ * (1+beta_*std::max(p[i] - 101325., 0.));
+  }
+  virtual void DMassDensityDpBatch(const double* T, const double* p, double* out, int n) override {
+    for (int i=0; i!=n; ++i) out[i] = p[i] > 101325. ? rho_ * beta_ : 0.;
+  }
+  virtual void DMassDensityDTBatch(const double* T, const double* p, double* out, int n) override {
+    std::fill(out, out+n, 0.);
+  }
+
 private:
   virtual void InitializeFromPlist_();
 
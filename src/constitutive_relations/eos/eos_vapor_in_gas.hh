@@ -35,6 +35,16 @@ public:
   double DMolarDensityDT(std::vector<double>& params);
   double DMolarDensityDp(std::vector<double>& params);
 
+  void MolarDensityBatch(const double* T, const double* p, double* out, int n) {
+    gas_eos_->MolarDensityBatch(T, p, out, n);
+  }
+  void DMolarDensityDTBatch(const double* T, const double* p, double* out, int n) {
+    gas_eos_->DMolarDensityDTBatch(T, p, out, n);
+  }
+  void DMolarDensityDpBatch(const double* T, const double* p, double* out, int n) {
+    gas_eos_->DMolarDensityDpBatch(T, p, out, n);
+  }
+
   bool IsConstantMolarMass() { return false; }
   double MolarMass() { AMANZI_ASSERT(0); return 0.0; }
 
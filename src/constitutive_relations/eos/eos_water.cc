@@ -73,5 +73,32 @@ double EOSWater::DMassDensityDp(std::vector<double>& params) {
 
 };
 
+
+void EOSWater::MassDensityBatch(const double* T, const double* p, double* out, int n) {
+  for (int i=0; i!=n; ++i) {
+    double dT = T[i] - kT0_;
+    double rho1bar = ka_ + (kb_ + (kc_ + kd_*dT)*dT)*dT;
+    out[i] = rho1bar * (1.0 + kalpha_*(std::max(p[i], 101325.) - kp0_));
+  }
+}
+
+
+void EOSWater::DMassDensityDTBatch(const double* T, const double* p, double* out, int n) {
+  for (int i=0; i!=n; ++i) {
+    double dT = T[i] - kT0_;
+    double rho1bar = kb_ + (2.0*kc_ + 3.0*kd_*dT)*dT;
+    out[i] = rho1bar * (1.0 + kalpha_*(std::max(p[i], 101325.) - kp0_));
+  }
+}
+
+
+void EOSWater::DMassDensityDpBatch(const double* T, const double* p, double* out, int n) {
+  for (int i=0; i!=n; ++i) {
+    double dT = T[i] - kT0_;
+    double rho1bar = ka_ + (kb_ + (kc_ + kd_*dT)*dT)*dT;
+    out[i] = p[i] < 101325. ? 0. : rho1bar * kalpha_;
+  }
+}
+
 } // namespace
 } // namespace
@@ -12,12 +12,14 @@
 
 #include "vapor_pressure_relation.hh"
 #include "secondary_variable_field_evaluator.hh"
+#include "cell_subset_evaluator.hh"
 
 namespace Amanzi {
 namespace Relations {
 
 // Equation of State model
-class MolarFractionGasEvaluator : public SecondaryVariableFieldEvaluator {
+class MolarFractionGasEvaluator : public SecondaryVariableFieldEvaluator,
+                                  public CellSubsetEvaluator {
 
  public:
   explicit
@@ -32,10 +34,18 @@ class MolarFractionGasEvaluator : public SecondaryVariableFieldEvaluator {
   virtual void EvaluateFieldPartialDerivative_(const Teuchos::Ptr<State>& S,
           Key wrt_key, const Teuchos::Ptr<CompositeVector>& result);
 
+  // Updates the field on cells only, see CellSubsetEvaluator.
+  virtual CellSubsetChange HasFieldChangedOnCells(const Teuchos::Ptr<State>& S,
+          const Key& request, const AmanziMesh::Entity_ID_List& cells);
+
   Teuchos::RCP<VaporPressureRelation> get_VaporPressureRelation() {
     return sat_vapor_model_; }
 
  protected:
+  virtual void UpdateField_(const Teuchos::Ptr<State>& S);
+  bool EvaluateFieldOnCells_(const Teuchos::Ptr<State>& S,
+          const AmanziMesh::Entity_ID_List& cells);
+
   Key temp_key_;
 
   Teuchos::RCP<VaporPressureRelation> sat_vapor_model_;
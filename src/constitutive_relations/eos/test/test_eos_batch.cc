@@ -0,0 +1,107 @@
+/*
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+*/
+
+// Tests that the batched EOS methods match the pointwise ones.
+
+#include <cmath>
+#include <vector>
+#include "UnitTest++.h"
+
+#include "Teuchos_ParameterList.hpp"
+
+#include "eos_constant.hh"
+#include "eos_ice.hh"
+#include "eos_ideal_gas.hh"
+#include "eos_ideal_gas_reg.hh"
+#include "eos_linear.hh"
+#include "eos_vapor_in_gas.hh"
+#include "eos_water.hh"
+
+using namespace Amanzi::Relations;
+
+namespace {
+
+// Batched evaluation must match pointwise evaluation at every point.
+void
+CheckBatch(EOS& eos, bool check_mass)
+{
+  const int n = 23;
+  std::vector<double> T(n), p(n), out(n);
+  for (int i=0; i!=n; ++i) {
+    T[i] = 250. + 2.5 * i;
+    p[i] = 9.e4 + 5.e3 * i;
+  }
+
+  auto check = [&](double (EOS::*pointwise)(std::vector<double>&)) {
+    std::vector<double> params(2);
+    for (int i=0; i!=n; ++i) {
+      params[0] = T[i];
+      params[1] = p[i];
+      double expected = (eos.*pointwise)(params);
+      CHECK_CLOSE(expected, out[i], 1.e-12 * std::abs(expected) + 1.e-300);
+    }
+  };
+
+  eos.MolarDensityBatch(&T[0], &p[0], &out[0], n);
+  check(&EOS::MolarDensity);
+  eos.DMolarDensityDTBatch(&T[0], &p[0], &out[0], n);
+  check(&EOS::DMolarDensityDT);
+  eos.DMolarDensityDpBatch(&T[0], &p[0], &out[0], n);
+  check(&EOS::DMolarDensityDp);
+
+  if (check_mass) {
+    eos.MassDensityBatch(&T[0], &p[0], &out[0], n);
+    check(&EOS::MassDensity);
+    eos.DMassDensityDTBatch(&T[0], &p[0], &out[0], n);
+    check(&EOS::DMassDensityDT);
+    eos.DMassDensityDpBatch(&T[0], &p[0], &out[0], n);
+    check(&EOS::DMassDensityDp);
+  }
+}
+
+} // namespace
+
+
+TEST(EOS_BATCH_WATER) {
+  Teuchos::ParameterList plist;
+  EOSWater eos(plist);
+  CheckBatch(eos, true);
+}
+
+TEST(EOS_BATCH_ICE) {
+  Teuchos::ParameterList plist;
+  EOSIce eos(plist);
+  CheckBatch(eos, true);
+}
+
+TEST(EOS_BATCH_IDEAL_GAS) {
+  Teuchos::ParameterList plist;
+  EOSIdealGas eos(plist);
+  CheckBatch(eos, true);
+}
+
+TEST(EOS_BATCH_LINEAR) {
+  Teuchos::ParameterList plist;
+  plist.set("density [kg/m^3]", 1000.);
+  plist.set("compressibility [1/Pa]", 1.e-9);
+  EOSLinear eos(plist);
+  CheckBatch(eos, true);
+}
+
+TEST(EOS_BATCH_CONSTANT) {
+  Teuchos::ParameterList plist;
+  plist.set("density [kg/m^3]", 1000.);
+  EOSConstant eos(plist);
+  CheckBatch(eos, true);
+}
+
+TEST(EOS_BATCH_VAPOR_IN_GAS) {
+  // mass densities are not implemented
+  Teuchos::ParameterList plist;
+  plist.sublist("gas EOS parameters").set("EOS type", "ideal gas");
+  EOSVaporInGas eos(plist);
+  CheckBatch(eos, false);
+}
@@ -67,6 +67,43 @@ void ViscosityEvaluator::EvaluateField_(const Teuchos::Ptr<State>& S,
 }
 
 
+CellSubsetChange ViscosityEvaluator::HasFieldChangedOnCells(const Teuchos::Ptr<State>& S,
+        const Key& request, const AmanziMesh::Entity_ID_List& cells) {
+  return HasFieldChangedOnCells_(S, request, cells, my_key_, dependencies_, requests_,
+          [&]() { return EvaluateFieldOnCells_(S, cells); },
+          [&]() { UpdateField_(S); });
+}
+
+
+void ViscosityEvaluator::UpdateField_(const Teuchos::Ptr<State>& S) {
+  changed_on_cells_ = false;
+  SecondaryVariableFieldEvaluator::UpdateField_(S);
+}
+
+
+bool ViscosityEvaluator::EvaluateFieldOnCells_(const Teuchos::Ptr<State>& S,
+        const AmanziMesh::Entity_ID_List& cells) {
+  Teuchos::RCP<CompositeVector> result = S->GetFieldData(my_key_, my_key_);
+  std::vector<AmanziMesh::Entity_ID_List> entities;
+  if (!getCellSubsetEntities(*result, cells, entities)) return false;
+
+  Teuchos::RCP<const CompositeVector> temp = S->GetFieldData(temp_key_);
+
+  int n = 0;
+  for (CompositeVector::name_iterator comp=result->begin();
+       comp!=result->end(); ++comp, ++n) {
+    const Epetra_MultiVector& temp_v = *(temp->ViewComponent(*comp,false));
+    Epetra_MultiVector& result_v = *(result->ViewComponent(*comp,false));
+
+    for (auto id : entities[n]) {
+      AMANZI_ASSERT(temp_v[0][id] > 200.);
+      result_v[0][id] = visc_->Viscosity(temp_v[0][id]);
+    }
+  }
+  return true;
+}
+
+
 void ViscosityEvaluator::EvaluateFieldPartialDerivative_(
     const Teuchos::Ptr<State>& S, Key wrt_key,
     const Teuchos::Ptr<CompositeVector>& result) {
@@ -12,11 +12,13 @@
 
 #include "viscosity_relation.hh"
 #include "secondary_variable_field_evaluator.hh"
+#include "cell_subset_evaluator.hh"
 
 namespace Amanzi {
 namespace Relations {
 
-class ViscosityEvaluator : public SecondaryVariableFieldEvaluator {
+class ViscosityEvaluator : public SecondaryVariableFieldEvaluator,
+                           public CellSubsetEvaluator {
 
  public:
 
@@ -33,7 +35,15 @@ class ViscosityEvaluator : public SecondaryVariableFieldEvaluator {
   virtual void EvaluateFieldPartialDerivative_(const Teuchos::Ptr<State>& S,
           Key wrt_key, const Teuchos::Ptr<CompositeVector>& result);
 
+  // Updates the field on cells only, see CellSubsetEvaluator.
+  virtual CellSubsetChange HasFieldChangedOnCells(const Teuchos::Ptr<State>& S,
+          const Key& request, const AmanziMesh::Entity_ID_List& cells);
+
  protected:
+  virtual void UpdateField_(const Teuchos::Ptr<State>& S);
+  bool EvaluateFieldOnCells_(const Teuchos::Ptr<State>& S,
+          const AmanziMesh::Entity_ID_List& cells);
+
   // the actual model
   Teuchos::RCP<ViscosityRelation> visc_;
 
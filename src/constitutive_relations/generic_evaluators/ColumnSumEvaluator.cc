@@ -71,60 +71,42 @@ ColumnSumEvaluator::EvaluateField_(const Teuchos::Ptr<State>& S,
   Epetra_MultiVector& res_c = *result->ViewComponent("cell",false);
   const Epetra_MultiVector& dep_c = *S->GetFieldData(dep_key_)->ViewComponent("cell", false);
 
+  if (columns_ == Teuchos::null)
+    columns_ = Teuchos::rcp(new ColumnView(*S->GetMesh(domain_), res_c.MyLength()));
+  const ColumnView& columns = *columns_;
+
+  const Epetra_Vector* cv = nullptr;
+  const Epetra_Vector* surf_cv = nullptr;
   if (cv_key_ != "") {
-    const Epetra_MultiVector& cv = *S->GetFieldData(cv_key_)->ViewComponent("cell", false);
-    const Epetra_MultiVector& surf_cv = *S->GetFieldData(surf_cv_key_)->ViewComponent("cell", false);
-
-    if (molar_dens_key_ != "") {
-      const Epetra_MultiVector& dens = *S->GetFieldData(molar_dens_key_)->ViewComponent("cell",false);
-
-      Teuchos::RCP<const AmanziMesh::Mesh> subsurf_mesh = S->GetMesh(domain_);
-      for (int c=0; c!=res_c.MyLength(); ++c) {
-        double sum = 0;
-        for (auto i : subsurf_mesh->cells_of_column(c)) {
-          sum += dep_c[0][i] * cv[0][i] / dens[0][i];
-        }
-        res_c[0][c] = coef_ * sum / surf_cv[0][c];
-      }
-    } else {
-
-      Teuchos::RCP<const AmanziMesh::Mesh> subsurf_mesh = S->GetMesh(domain_);
-      for (int c=0; c!=res_c.MyLength(); ++c) {
-        double sum = 0;
-        for (auto i : subsurf_mesh->cells_of_column(c)) {
-          sum += dep_c[0][i] * cv[0][i];
-        }
-        res_c[0][c] = coef_ * sum / surf_cv[0][c];
-      }
-    }
+    cv = (*S->GetFieldData(cv_key_)->ViewComponent("cell", false))(0);
+    surf_cv = (*S->GetFieldData(surf_cv_key_)->ViewComponent("cell", false))(0);
+  }
+  const Epetra_Vector* dens = nullptr;
+  if (molar_dens_key_ != "") {
+    dens = (*S->GetFieldData(molar_dens_key_)->ViewComponent("cell",false))(0);
+  }
 
-  } else {
-    if (molar_dens_key_ != "") {
-      const Epetra_MultiVector& dens = *S->GetFieldData(molar_dens_key_)->ViewComponent("cell",false);
-
-      Teuchos::RCP<const AmanziMesh::Mesh> subsurf_mesh = S->GetMesh(domain_);
-      for (int c=0; c!=res_c.MyLength(); ++c) {
-        double sum = 0;
-        for (auto i : subsurf_mesh->cells_of_column(c)) {
-          sum += dep_c[0][i] / dens[0][i];
-        }
-        res_c[0][c] = coef_ * sum;
-      }
-    } else {
-
-      Teuchos::RCP<const AmanziMesh::Mesh> subsurf_mesh = S->GetMesh(domain_);
-      for (int c=0; c!=res_c.MyLength(); ++c) {
-        double sum = 0;
-        for (auto i : subsurf_mesh->cells_of_column(c)) {
-          sum += dep_c[0][i];
-        }
-        res_c[0][c] = coef_ * sum;
-      }
+  // workspace for columns that are not contiguous in the subsurface vectors
+  std::vector<double> dep_work(columns.max_num_cells());
+  std::vector<double> cv_work(cv ? columns.max_num_cells() : 0);
+  std::vector<double> dens_work(dens ? columns.max_num_cells() : 0);
+
+  for (int c=0; c!=res_c.MyLength(); ++c) {
+    const double* dep_col = columns.column(*dep_c(0), c, dep_work.data());
+    const double* cv_col = cv ? columns.column(*cv, c, cv_work.data()) : nullptr;
+    const double* dens_col = dens ? columns.column(*dens, c, dens_work.data()) : nullptr;
+
+    double sum = 0;
+    for (int i=0; i!=columns.num_cells(c); ++i) {
+      double val = dep_col[i];
+      if (cv_col) val *= cv_col[i];
+      if (dens_col) val /= dens_col[i];
+      sum += val;
     }
+    res_c[0][c] = cv ? coef_ * sum / (*surf_cv)[c] : coef_ * sum;
   }
 }
 
-
 void
 ColumnSumEvaluator::EvaluateFieldPartialDerivative_(const Teuchos::Ptr<State>& S,
                Key wrt_key, const Teuchos::Ptr<CompositeVector>& result)
@@ -43,6 +43,7 @@ of summing fluxes onto the surface and converting to m/s instead of mol/m^2/s).
 
 #include "Factory.hh"
 #include "secondary_variable_field_evaluator.hh"
+#include "column_view.hh"
 
 namespace Amanzi {
 namespace Relations {
@@ -77,6 +78,7 @@ protected:
   Key surf_domain_;
 
   bool updated_once_;
+  Teuchos::RCP<ColumnView> columns_;
 private:
   static Utils::RegisteredFactory<FieldEvaluator,ColumnSumEvaluator> factory_;
 
@@ -475,9 +475,10 @@ bool Coordinator::advance(double t_old, double t_new, double& dt_next) {
     dt_next = get_dt(fail);
     checkpoint(dt_next); // checkpoint with the new dt
 
-    // we're done with this time step, copy the state
+    // we're done with this time step, copy the state.  Without subcycling,
+    // S_inter_ is S_, and a second copy is not needed.
     *S_ = *S_next_;
-    *S_inter_ = *S_next_;
+    if (S_inter_ != S_) *S_inter_ = *S_next_;
 
   } else {
     // Failed the timestep.
@@ -486,7 +487,7 @@ bool Coordinator::advance(double t_old, double t_new, double& dt_next) {
 
     // The timestep sizes have been updated, so copy back old soln and try again.
     *S_next_ = *S_;
-    *S_inter_ = *S_;
+    if (S_inter_ != S_) *S_inter_ = *S_;
 
     // check whether meshes are deformable, and if so, recover the old coordinates
     for (Amanzi::State::mesh_iterator mesh=S_->mesh_begin();
@@ -0,0 +1,87 @@
+/* -*-  mode: c++; indent-tabs-mode: nil -*- */
+/*
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+*/
+
+//! Column-contiguous views of subsurface cell data for column-based physics.
+
+#include <algorithm>
+
+#include "column_view.hh"
+
+namespace Amanzi {
+
+ColumnView::ColumnView(const AmanziMesh::Mesh& mesh, int ncols) :
+    cells_(ncols),
+    offsets_(ncols + 1, 0),
+    first_(ncols, -1),
+    max_num_cells_(0),
+    column_major_(true)
+{
+  for (int col=0; col!=ncols; ++col) {
+    const auto& cells = mesh.cells_of_column(col);
+    cells_[col] = &cells;
+    offsets_[col+1] = offsets_[col] + cells.size();
+    max_num_cells_ = std::max(max_num_cells_, (int) cells.size());
+
+    bool contiguous = cells.size() > 0;
+    for (int i=1; i<cells.size(); ++i) {
+      if (cells[i] != cells[0] + i) {
+        contiguous = false;
+        break;
+      }
+    }
+    if (contiguous) first_[col] = cells[0];
+    if (!contiguous || first_[col] != offsets_[col]) column_major_ = false;
+  }
+}
+
+
+void
+ColumnView::GatherColumn(const Epetra_Vector& v, int col, double* col_v) const
+{
+  if (contiguous(col)) {
+    std::copy(&v[first_[col]], &v[first_[col]] + num_cells(col), col_v);
+  } else {
+    const auto& cells = *cells_[col];
+    for (int i=0; i!=cells.size(); ++i) col_v[i] = v[cells[i]];
+  }
+}
+
+
+void
+ColumnView::ScatterColumn(const double* col_v, int col, Epetra_Vector& v) const
+{
+  if (contiguous(col)) {
+    std::copy(col_v, col_v + num_cells(col), &v[first_[col]]);
+  } else {
+    const auto& cells = *cells_[col];
+    for (int i=0; i!=cells.size(); ++i) v[cells[i]] = col_v[i];
+  }
+}
+
+
+void
+ColumnView::Gather(const Epetra_Vector& v, double* packed) const
+{
+  if (column_major_) {
+    std::copy(&v[0], &v[0] + size(), packed);
+  } else {
+    for (int col=0; col!=num_columns(); ++col) GatherColumn(v, col, packed + offsets_[col]);
+  }
+}
+
+
+void
+ColumnView::Scatter(const double* packed, Epetra_Vector& v) const
+{
+  if (column_major_) {
+    std::copy(packed, packed + size(), &v[0]);
+  } else {
+    for (int col=0; col!=num_columns(); ++col) ScatterColumn(packed + offsets_[col], col, v);
+  }
+}
+
+} // namespace Amanzi
@@ -0,0 +1,79 @@
+/* -*-  mode: c++; indent-tabs-mode: nil -*- */
+/*
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+*/
+
+//! Column-contiguous views of subsurface cell data for column-based physics.
+
+/*
+  Column physics (BGC, FATES, column sums) works on one column of subsurface
+  cells at a time, top to bottom.  When a mesh is extruded column by column,
+  the cells of each column are already numbered contiguously, and a column of
+  a cell vector is just a span of that vector.  Otherwise the column must be
+  gathered.
+
+  ColumnView resolves the column cell lists once and records whether each
+  column is contiguous.  column() returns a zero-copy pointer into the vector
+  for contiguous columns and gathers into a caller-provided workspace
+  otherwise.  For kernels that sweep all columns, Gather() / Scatter() copy a
+  whole vector to and from a column-major buffer (column col occupies
+  [offset(col), offset(col+1)) top to bottom), which is a plain copy when the
+  mesh ordering is already column-major.
+*/
+
+#pragma once
+
+#include <vector>
+
+#include "Epetra_Vector.h"
+#include "Mesh.hh"
+
+namespace Amanzi {
+
+class ColumnView {
+ public:
+  // Columns are the first ncols columns of the mesh, i.e. those below the
+  // owned surface cells.
+  ColumnView(const AmanziMesh::Mesh& mesh, int ncols);
+
+  int num_columns() const { return cells_.size(); }
+  int num_cells(int col) const { return cells_[col]->size(); }
+  int offset(int col) const { return offsets_[col]; }
+  int size() const { return offsets_.back(); }
+  int max_num_cells() const { return max_num_cells_; }
+  const AmanziMesh::Entity_ID_List& cells(int col) const { return *cells_[col]; }
+
+  // is the column's data contiguous in cell vectors?
+  bool contiguous(int col) const { return first_[col] >= 0; }
+
+  // is the cell ordering column-major, so that Gather() is a copy?
+  bool column_major() const { return column_major_; }
+
+  // Column col of v, top to bottom.  Returns a pointer into v if the column
+  // is contiguous, otherwise gathers into work, which must hold num_cells(col)
+  // values, and returns work.
+  const double* column(const Epetra_Vector& v, int col, double* work) const {
+    if (contiguous(col)) return &v[first_[col]];
+    GatherColumn(v, col, work);
+    return work;
+  }
+
+  // copy one column of v to/from col_v
+  void GatherColumn(const Epetra_Vector& v, int col, double* col_v) const;
+  void ScatterColumn(const double* col_v, int col, Epetra_Vector& v) const;
+
+  // copy all columns of v to/from a column-major buffer of length size()
+  void Gather(const Epetra_Vector& v, double* packed) const;
+  void Scatter(const double* packed, Epetra_Vector& v) const;
+
+ private:
+  std::vector<const AmanziMesh::Entity_ID_List*> cells_;
+  std::vector<int> offsets_;
+  std::vector<AmanziMesh::Entity_ID> first_;  // first cell of a contiguous column, or -1
+  int max_num_cells_;
+  bool column_major_;
+};
+
+} // namespace Amanzi
@@ -0,0 +1,76 @@
+/* -*-  mode: c++; indent-tabs-mode: nil -*- */
+
+// -----------------------------------------------------------------------------
+// ATS
+//
+// License: see $ATS_DIR/COPYRIGHT
+// Author: Ethan Coon (ecoon@lanl.gov)
+//
+// Compressed face-to-cell connectivity, with the orientation of each face
+// relative to the outward normal of each of its cells.
+// -----------------------------------------------------------------------------
+
+#include "dbc.hh"
+#include "face_cell_connectivity.hh"
+
+namespace Amanzi {
+namespace Operators {
+
+FaceCellConnectivity::FaceCellConnectivity(const AmanziMesh::Mesh& mesh) :
+    mesh_(&mesh)
+{
+  int nfaces = mesh.num_entities(AmanziMesh::FACE, AmanziMesh::Parallel_type::ALL);
+  int ncells = mesh.num_entities(AmanziMesh::CELL, AmanziMesh::Parallel_type::ALL);
+
+  AmanziMesh::Entity_ID_List faces;
+  std::vector<int> fdirs;
+
+  // count, then fill, visiting cells in order so that cells of each face are
+  // sorted
+  offsets_.assign(nfaces+1, 0);
+  for (int c=0; c!=ncells; ++c) {
+    mesh.cell_get_faces_and_dirs(c, &faces, &fdirs);
+    for (auto f : faces) offsets_[f+1]++;
+  }
+  for (int f=0; f!=nfaces; ++f) offsets_[f+1] += offsets_[f];
+
+  cells_.resize(offsets_[nfaces]);
+  dirs_.resize(offsets_[nfaces]);
+  std::vector<int> pos(offsets_.begin(), offsets_.end()-1);
+  for (int c=0; c!=ncells; ++c) {
+    mesh.cell_get_faces_and_dirs(c, &faces, &fdirs);
+    for (unsigned int n=0; n!=faces.size(); ++n) {
+      int k = pos[faces[n]]++;
+      cells_[k] = c;
+      dirs_[k] = fdirs[n];
+    }
+  }
+}
+
+
+void
+FaceCellConnectivity::IdentifyUpwindCells(const Epetra_MultiVector& flux, int nfaces,
+        Epetra_IntVector& upwind_cell, Epetra_IntVector& downwind_cell) const
+{
+  AMANZI_ASSERT(nfaces <= size());
+  for (int f=0; f!=nfaces; ++f) {
+    int uw = -1, dw = -1;
+    for (int n=offsets_[f]; n!=offsets_[f+1]; ++n) {
+      double flux_dir = flux[0][f] * dirs_[n];
+      if (flux_dir > 0) {
+        uw = cells_[n];
+      } else if (flux_dir < 0) {
+        dw = cells_[n];
+      } else if (uw == -1) {
+        uw = cells_[n];
+      } else {
+        dw = cells_[n];
+      }
+    }
+    upwind_cell[f] = uw;
+    downwind_cell[f] = dw;
+  }
+}
+
+} // namespace
+} // namespace
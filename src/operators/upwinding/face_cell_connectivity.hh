@@ -0,0 +1,59 @@
+/* -*-  mode: c++; indent-tabs-mode: nil -*- */
+
+// -----------------------------------------------------------------------------
+// ATS
+//
+// License: see $ATS_DIR/COPYRIGHT
+// Author: Ethan Coon (ecoon@lanl.gov)
+//
+// Compressed face-to-cell connectivity, with the orientation of each face
+// relative to the outward normal of each of its cells.  This is built once
+// per mesh, after which upwinding only needs the sign of the flux.
+// -----------------------------------------------------------------------------
+
+#ifndef AMANZI_UPWINDING_FACE_CELL_CONNECTIVITY_
+#define AMANZI_UPWINDING_FACE_CELL_CONNECTIVITY_
+
+#include <vector>
+
+#include "Epetra_IntVector.h"
+#include "Epetra_MultiVector.h"
+
+#include "Mesh.hh"
+
+namespace Amanzi {
+namespace Operators {
+
+class FaceCellConnectivity {
+ public:
+  explicit FaceCellConnectivity(const AmanziMesh::Mesh& mesh);
+
+  const AmanziMesh::Mesh* mesh() const { return mesh_; }
+
+  // number of owned and ghosted faces
+  int size() const { return offsets_.size() - 1; }
+
+  // Cells of face f, in increasing order of local id, and the direction of
+  // f's normal relative to the outward normal of each cell.
+  int num_cells(AmanziMesh::Entity_ID f) const { return offsets_[f+1] - offsets_[f]; }
+  AmanziMesh::Entity_ID cell(AmanziMesh::Entity_ID f, int n) const { return cells_[offsets_[f] + n]; }
+  int dir(AmanziMesh::Entity_ID f, int n) const { return dirs_[offsets_[f] + n]; }
+
+  // Identify upwind and downwind cells of the first nfaces faces given the
+  // flux on those faces.  Boundaries are marked by -1.  For zero flux, the
+  // first cell is upwind and the second is downwind.
+  void IdentifyUpwindCells(const Epetra_MultiVector& flux, int nfaces,
+                           Epetra_IntVector& upwind_cell,
+                           Epetra_IntVector& downwind_cell) const;
+
+ private:
+  const AmanziMesh::Mesh* mesh_;
+  std::vector<int> offsets_;
+  std::vector<AmanziMesh::Entity_ID> cells_;
+  std::vector<int> dirs_;
+};
+
+} // namespace
+} // namespace
+
+#endif
@@ -70,8 +70,6 @@ void UpwindTotalFlux::CalculateCoefficientsOnFaces(
   Epetra_IntVector downwind_cell(*face_coef->ComponentMap("face",true));
   downwind_cell.PutValue(-1);
 
-  AmanziMesh::Entity_ID_List faces;
-  std::vector<int> fdirs;
   int nfaces_local = flux.size("face",false);
 
   bool has_cells = face_coef->HasComponent("cell");
@@ -79,33 +77,13 @@ void UpwindTotalFlux::CalculateCoefficientsOnFaces(
   if (has_cells)
     face_cell_coef = face_coef->ViewComponent("cell", true);
 
-  int ncells = cell_coef.size("cell",true);
-  for (int c=0; c!=ncells; ++c) {
-    mesh->cell_get_faces_and_dirs(c, &faces, &fdirs);   
-
-    for (unsigned int n=0; n!=faces.size(); ++n) {
-      int f = faces[n];
-
-      if (has_cells) (*face_cell_coef)[0][c] = coef_cells[0][c];
-
-      if (f < nfaces_local) {
-        if (flux_v[0][f] * fdirs[n] > 0) {
-          upwind_cell[f] = c;
-        } else if (flux_v[0][f] * fdirs[n] < 0) {
-          downwind_cell[f] = c;
-        } else {
-          // We don't care, but we have to get one into upwind and the other
-          // into downwind.
-          if (upwind_cell[f] == -1) {
-            upwind_cell[f] = c;
-          } else {
-            downwind_cell[f] = c;
-          }
-        }
-      }
-    }
+  if (has_cells) {
+    int ncells = cell_coef.size("cell",true);
+    for (int c=0; c!=ncells; ++c) (*face_cell_coef)[0][c] = coef_cells[0][c];
   }
 
+  Connectivity_(*mesh).IdentifyUpwindCells(flux_v, nfaces_local, upwind_cell, downwind_cell);
+
   // Determine the face coefficient of local faces.
   // These parameters may be key to a smooth convergence rate near zero flux.
   //  double flow_eps_factor = 1.;
@@ -211,33 +189,7 @@ UpwindTotalFlux::UpdateDerivatives(const Teuchos::Ptr<State>& S,
   Epetra_IntVector downwind_cell(mesh->face_map(true));
   downwind_cell.PutValue(-1);
 
-  AmanziMesh::Entity_ID_List faces;
-  std::vector<int> fdirs;
-
-  int ncells = dcell_v.MyLength();
-  for (int c=0; c!=ncells; ++c) {
-    mesh->cell_get_faces_and_dirs(c, &faces, &fdirs);
-
-    for (unsigned int n=0; n!=faces.size(); ++n) {
-      int f = faces[n];
-
-      if (f < nfaces_owned) {
-        if (flux_v[0][f] * fdirs[n] > 0) {
-          upwind_cell[f] = c;
-        } else if (flux_v[0][f] * fdirs[n] < 0) {
-          downwind_cell[f] = c;
-        } else {
-          // We don't care, but we have to get one into upwind and the other
-          // into downwind.
-          if (upwind_cell[f] == -1) {
-            upwind_cell[f] = c;
-          } else {
-            downwind_cell[f] = c;
-          }
-        }
-      }
-    }
-  }
+  Connectivity_(*mesh).IdentifyUpwindCells(flux_v, nfaces_owned, upwind_cell, downwind_cell);
 
 
   for (unsigned int f=0; f!=nfaces_owned; ++f) {
@@ -19,6 +19,7 @@
 #include "dbc.hh"
 #include "OperatorDefs.hh"
 #include "CompositeVector.hh"
+#include "face_cell_connectivity.hh"
 
 namespace Amanzi {
 
@@ -57,8 +58,17 @@ class Upwinding {
 
   virtual std::string
   CoefficientLocation() = 0;
-  
 
+ protected:
+  // Face-to-cell connectivity of the mesh, built on first use.
+  const FaceCellConnectivity& Connectivity_(const AmanziMesh::Mesh& mesh) const {
+    if (connectivity_ == Teuchos::null || connectivity_->mesh() != &mesh)
+      connectivity_ = Teuchos::rcp(new FaceCellConnectivity(mesh));
+    return *connectivity_;
+  }
+
+ private:
+  mutable Teuchos::RCP<FaceCellConnectivity> connectivity_;
 };
 
 } // namespace
@@ -6,6 +6,8 @@
 
 */
 
+#include <cmath>
+
 #include "utils.hh"
 
 #include "PFT.hh"
@@ -183,5 +185,66 @@ void PFT::InitRoots(const Epetra_SerialDenseVector& SoilTArr,
   return;
 }
 
+
+void PFT::CopyStateTo(Epetra_MultiVector& state, int first, int col) const
+{
+  int k = first;
+  state[k++][col] = Bleaf;
+  state[k++][col] = Bleafmemory;
+  state[k++][col] = Broot;
+  state[k++][col] = Bstem;
+  state[k++][col] = Bstore;
+  state[k++][col] = GDD;
+  state[k++][col] = mResp;
+  state[k++][col] = gResp;
+  state[k++][col] = annNPP;
+  state[k++][col] = GPP;
+  state[k++][col] = NPP;
+  state[k++][col] = ET;
+  state[k++][col] = lai;
+  state[k++][col] = laimemory;
+  state[k++][col] = totalBiomass;
+  state[k++][col] = rootD;
+  state[k++][col] = bleafon;
+  state[k++][col] = leafondaysi;
+  state[k++][col] = leafoffdaysi;
+  state[k++][col] = CSinkLimit;
+  state[k++][col] = leafstatus;
+  state[k++][col] = bleafoff;
+  state[k++][col] = maxLAI;
+  for (int i=0; i!=10; ++i) state[k++][col] = annCBalance[i];
+  AMANZI_ASSERT(k == first + num_state);
+}
+
+void PFT::CopyStateFrom(const Epetra_MultiVector& state, int first, int col)
+{
+  int k = first;
+  Bleaf = state[k++][col];
+  Bleafmemory = state[k++][col];
+  Broot = state[k++][col];
+  Bstem = state[k++][col];
+  Bstore = state[k++][col];
+  GDD = state[k++][col];
+  mResp = state[k++][col];
+  gResp = state[k++][col];
+  annNPP = state[k++][col];
+  GPP = state[k++][col];
+  NPP = state[k++][col];
+  ET = state[k++][col];
+  lai = state[k++][col];
+  laimemory = state[k++][col];
+  totalBiomass = state[k++][col];
+  rootD = state[k++][col];
+  bleafon = state[k++][col];
+  leafondaysi = state[k++][col];
+  leafoffdaysi = state[k++][col];
+  CSinkLimit = state[k++][col];
+  leafstatus = std::lround(state[k++][col]);
+  bleafoff = std::lround(state[k++][col]);
+  maxLAI = std::lround(state[k++][col]);
+  for (int i=0; i!=10; ++i) annCBalance[i] = state[k++][col];
+  AMANZI_ASSERT(k == first + num_state);
+}
+
 } // namespace
 } // namespace
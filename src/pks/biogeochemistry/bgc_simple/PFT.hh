@@ -37,6 +37,7 @@ Paramters for a plant functional type.
 #include "Teuchos_ParameterList.hpp"
 #include "Teuchos_RCP.hpp"
 #include "Epetra_SerialDenseVector.h"
+#include "Epetra_MultiVector.h"
 
 #include "dbc.hh"
 
@@ -64,6 +65,13 @@ class PFT {
                  const Epetra_SerialDenseVector& SoilDArr,
                  const Epetra_SerialDenseVector& SoilThicknessArr);
 
+  // The evolving (non-parameter) scalars of a PFT, other than BRootSoil, are
+  // stored outside of the PFT as num_state consecutive vectors of a
+  // MultiVector, starting at vector first, with one entry per column.
+  static const int num_state = 33;
+  void CopyStateTo(Epetra_MultiVector& state, int first, int col) const;
+  void CopyStateFrom(const Epetra_MultiVector& state, int first, int col);
+
   bool AssertRootBalance_or_die() {
     double totalRootW = BRootSoil.Norm1();
     AMANZI_ASSERT(std::abs(totalRootW - Broot) < 1.e-6);
@@ -9,11 +9,13 @@
 
    CURRENT ASSUMPTIONS:
      1. parallel decomp not in the vertical
-     2. fields are not ordered along the column, and so must be copied
+     2. fields are copied to columns unless the mesh numbers each column's
+        cells contiguously, in which case they are viewed in place
      3. all columns have the same number of cells
    ------------------------------------------------------------------------- */
 
 #include "MeshPartition.hh"
+#include "parallel_for.hh"
 
 #include "bgc_simple_funcs.hh"
 
@@ -92,7 +94,6 @@ void BGCSimple::Setup(const Teuchos::Ptr<State>& S) {
   }
 
   int ncols = mesh_surf_->num_entities(AmanziMesh::CELL, AmanziMesh::Parallel_type::OWNED);
-  pfts_old_.resize(ncols);
   pfts_.resize(ncols);
   for (unsigned int col=0; col!=ncols; ++col) {
     int f = mesh_surf_->entity_get_parent(AmanziMesh::CELL, col);
@@ -111,15 +112,13 @@ void BGCSimple::Setup(const Teuchos::Ptr<State>& S) {
       AMANZI_ASSERT(ncol_cells == ncells_per_col_);
     }
 
-    pfts_old_[col].resize(pft_names.size());
     pfts_[col].resize(pft_names.size());
 
     for (int i=0; i!=pft_names.size(); ++i) {
       std::string pft_name = pft_names[i];
       Teuchos::ParameterList& pft_plist = pft_params.sublist(pft_name);
-      pfts_old_[col][i] = Teuchos::rcp(new PFT(pft_name, ncol_cells));
-      pfts_old_[col][i]->Init(pft_plist,col_area);
-      pfts_[col][i] = Teuchos::rcp(new PFT(*pfts_old_[col][i]));
+      pfts_[col][i] = Teuchos::rcp(new PFT(pft_name, ncol_cells));
+      pfts_[col][i]->Init(pft_plist,col_area);
     }
   }
 
@@ -137,10 +136,35 @@ void BGCSimple::Setup(const Teuchos::Ptr<State>& S) {
     }
   }
 
+  // -- column views of subsurface fields
+  columns_ = Teuchos::rcp(new ColumnView(*mesh_, ncols));
+
+  // -- column threads, each with its own workspace
+  num_threads_ = plist_->get<int>("number of column threads", 1);
+  if (num_threads_ < 1) {
+    Errors::Message msg;
+    msg << "BGCSimple: \"number of column threads\" must be positive, not " << num_threads_;
+    Exceptions::amanzi_throw(msg);
+  }
+#ifndef _OPENMP
+  num_threads_ = 1;
+#endif
+  workspaces_.assign(num_threads_, ColumnWorkspace_(std::max(ncells_per_col_, 0)));
+
   // requirements: primary variable
   S->RequireField(key_, name_)->SetMesh(mesh_)
       ->SetComponent("cell", AmanziMesh::CELL, nPools);
 
+  // requirements: PFT state.  This lives in State, rather than only in the
+  // PFTs, so that it is rolled back with State on failed steps and is
+  // checkpointed.
+  pft_state_key_ = Keys::readKey(*plist_, domain_surf_, "pft state", "pft_state");
+  S->RequireField(pft_state_key_, name_)->SetMesh(mesh_surf_)
+      ->SetComponent("cell", AmanziMesh::CELL, pft_names.size() * PFT::num_state);
+  pft_root_key_ = Keys::readKey(*plist_, domain_, "pft root biomass", "pft_root_biomass");
+  S->RequireField(pft_root_key_, name_)->SetMesh(mesh_)
+      ->SetComponent("cell", AmanziMesh::CELL, pft_names.size());
+
   // requirements: other primary variables
   S->RequireField(trans_key_, name_)->SetMesh(mesh_)
       ->SetComponent("cell", AmanziMesh::CELL, 1);
@@ -258,11 +282,11 @@ void BGCSimple::Initialize(const Teuchos::Ptr<State>& S) {
       Teuchos::rcp_dynamic_cast<Field_CompositeVector>(leaf_biomass_field);
   AMANZI_ASSERT(leaf_biomass_field_cv != Teuchos::null);
 
-  int npft = pfts_old_[0].size();
+  int npft = pfts_[0].size();
   std::vector<std::vector<std::string> > names;
   names.resize(1);
   names[0].resize(npft);
-  for (int i=0; i!=npft; ++i) names[0][i] = pfts_old_[0][i]->pft_type;
+  for (int i=0; i!=npft; ++i) names[0][i] = pfts_[0][i]->pft_type;
   leaf_biomass_field_cv->set_subfield_names(names);
 
   if (!leaf_biomass_field->initialized()) {
@@ -278,7 +302,7 @@ void BGCSimple::Initialize(const Teuchos::Ptr<State>& S) {
       int ncols = mesh_surf_->num_entities(AmanziMesh::CELL, AmanziMesh::Parallel_type::OWNED);
       for (int col=0; col!=ncols; ++col) {
         for (int i=0; i!=npft; ++i) {
-          pfts_old_[col][i]->Bleaf = bio[i][col];
+          pfts_[col][i]->Bleaf = bio[i][col];
         }
       }
       leaf_biomass_field->set_initialized();
@@ -308,33 +332,29 @@ void BGCSimple::Initialize(const Teuchos::Ptr<State>& S) {
     ColDepthDz_(col, col_depth.ptr(), col_dz.ptr());
 
     for (int i=0; i!=npft; ++i) {
-      pfts_old_[col][i]->InitRoots(*col_temp, *col_depth, *col_dz);
+      pfts_[col][i]->InitRoots(*col_temp, *col_depth, *col_dz);
     }
   }
 
-  // ensure all initialization in both PFTs?  Not sure this is
-  // necessary -- likely done in initial call to commit-state --etc
+  // store the initial PFT state, which is overwritten on restart
+  Epetra_MultiVector& pft_state = *S->GetFieldData(pft_state_key_, name_)
+      ->ViewComponent("cell", false);
+  Epetra_MultiVector& pft_root = *S->GetFieldData(pft_root_key_, name_)
+      ->ViewComponent("cell", false);
   for (int col=0; col!=ncols; ++col) {
-    for (int i=0; i!=npft; ++i) {
-      *pfts_[col][i] = *pfts_old_[col][i];
-    }
+    PFTsToState_(col, pft_state, pft_root);
+  }
+  for (const auto& key : { pft_state_key_, pft_root_key_ }) {
+    S->GetField(key, name_)->set_initialized();
+    S->GetField(key, name_)->set_io_vis(false);
+    S->GetField(key, name_)->set_io_checkpoint(true);
   }
 }
 
   
 // -- Commit any secondary (dependent) variables.
 void BGCSimple::CommitStep(double told, double tnew, const Teuchos::RCP<State>& S) {
-  // Copy the PFT over, which includes all additional state required, commit
-  // the step as succesful.
-  double dt = tnew - told;
-
-  int ncols = mesh_surf_->num_entities(AmanziMesh::CELL, AmanziMesh::Parallel_type::OWNED);
-  int npft = pfts_old_[0].size();
-  for (int col=0; col!=ncols; ++col) {
-    for (int i=0; i!=npft; ++i) {
-      *pfts_old_[col][i] = *pfts_[col][i];
-    }
-  }
+  // PFT state is in State, and so is committed with it.
 }
 
 // -- advance the model
@@ -349,16 +369,7 @@ bool BGCSimple::AdvanceStep(double t_old, double t_new, bool reinit) {
                << " t1 = " << S_next_->time() << " h = " << dt << std::endl
                << "----------------------------------------------------------------" << std::endl;
 
-  // Copy the PFT from old to new, in case we failed the previous attempt at
-  // this timestep.  This is hackery to get around the fact that PFTs are not
-  // (but should be) in state.
   AmanziMesh::Entity_ID ncols = mesh_surf_->num_entities(AmanziMesh::CELL, AmanziMesh::Parallel_type::OWNED);
-  for (AmanziMesh::Entity_ID col=0; col!=ncols; ++col) {
-    int npft = pfts_old_[col].size();
-    for (int i=0; i!=npft; ++i) {
-      *pfts_[col][i] = *pfts_old_[col][i];
-    }
-  }
 
   // grab the required fields
   Epetra_MultiVector& sc_pools = *S_next_->GetFieldData(key_, name_)
@@ -418,38 +429,38 @@ bool BGCSimple::AdvanceStep(double t_old, double t_new, bool reinit) {
   const Epetra_MultiVector& scv = *S_inter_->GetFieldData("surface-cell_volume")
       ->ViewComponent("cell", false);
 
-  // Create workspace arrays (these should be removed when data is correctly oriented).
-  Teuchos::RCP<Epetra_SerialDenseVector> temp_c =
-      Teuchos::rcp(new Epetra_SerialDenseVector(ncells_per_col_));
-  Teuchos::RCP<Epetra_SerialDenseVector> pres_c =
-      Teuchos::rcp(new Epetra_SerialDenseVector(ncells_per_col_));
-  Teuchos::RCP<Epetra_SerialDenseVector> dz_c =
-      Teuchos::rcp(new Epetra_SerialDenseVector(ncells_per_col_));
-  Teuchos::RCP<Epetra_SerialDenseVector> depth_c =
-      Teuchos::rcp(new Epetra_SerialDenseVector(ncells_per_col_));
-
-  // Create a workspace array for the result
-  Epetra_SerialDenseVector co2_decomp_c(ncells_per_col_);
-  Epetra_SerialDenseVector trans_c(ncells_per_col_);
-  double sw_c(0.);
+  const Epetra_MultiVector& pft_state_old = *S_inter_->GetFieldData(pft_state_key_)
+      ->ViewComponent("cell",false);
+  const Epetra_MultiVector& pft_root_old = *S_inter_->GetFieldData(pft_root_key_)
+      ->ViewComponent("cell",false);
+  Epetra_MultiVector& pft_state = *S_next_->GetFieldData(pft_state_key_, name_)
+      ->ViewComponent("cell",false);
+  Epetra_MultiVector& pft_root = *S_next_->GetFieldData(pft_root_key_, name_)
+      ->ViewComponent("cell",false);
 
   total_lai.PutScalar(0.);
-
-  // loop over columns and apply the model
-  for (AmanziMesh::Entity_ID col=0; col!=ncols; ++col) {
-    // update the various soil arrays
-    FieldToColumn_(col, *temp(0), temp_c.ptr());
-    FieldToColumn_(col, *pres(0), pres_c.ptr());
-    ColDepthDz_(col, depth_c.ptr(), dz_c.ptr());
+  double t_inter = S_inter_->time();
+
+  // Advance one column.  Columns share no mutable data: PFTs and soil carbon
+  // pools are per column, field entries written are those of the column,
+  // and all workspace is in ws.  Mesh geometry used by ColDepthDz_() was
+  // cached by the serial calls in Initialize().
+  auto advance_column = [&](AmanziMesh::Entity_ID col, ColumnWorkspace_& ws) {
+    // Load the PFT state at the start of the step.  This is taken from
+    // S_inter_, so that a failed previous attempt at this step is discarded.
+    PFTsFromState_(col, pft_state_old, pft_root_old);
+
+    // view the various soil arrays (BGCAdvance does not modify them)
+    auto& col_iter = columns_->cells(col);
+    int ncells = col_iter.size();
+    Epetra_SerialDenseVector temp_c(View,
+        const_cast<double*>(columns_->column(*temp(0), col, ws.temp.A())), ncells);
+    Epetra_SerialDenseVector pres_c(View,
+        const_cast<double*>(columns_->column(*pres(0), col, ws.pres.A())), ncells);
+    ColDepthDz_(col, Teuchos::ptr(&ws.depth), Teuchos::ptr(&ws.dz));
 
     // copy over the soil carbon arrays
-    auto& col_iter = mesh_->cells_of_column(col);
-    ncells_per_col_ = col_iter.size();
-    
-    // -- serious cache thrash... --etc
     for (std::size_t i=0; i!=col_iter.size(); ++i) {
-      AmanziGeometry::Point centroid = mesh_->cell_centroid(col_iter[i]);
-	  //      std::cout << "Col iter col=" << col << ", index i=" << i << ", cell=" << col_iter[i] << " at " << centroid << std::endl;
       for (int p=0; p!=soil_carbon_pools_[col][i]->nPools; ++p) {
         soil_carbon_pools_[col][i]->SOM[p] = sc_pools[p][col_iter[i]];
       }
@@ -464,27 +475,26 @@ bool BGCSimple::AdvanceStep(double t_old, double t_new, bool reinit) {
     met.relhum = rel_hum[0][col];
     met.CO2a = co2[0][col];
     met.lat = lat_;
-    sw_c = met.qSWin;
+    double sw_c = met.qSWin;
 
     // call the model
-    BGCAdvance(S_inter_->time(), dt, scv[0][col], cryoturbation_coef_, met,
-               *temp_c, *pres_c, *depth_c, *dz_c,
+    BGCAdvance(t_inter, dt, scv[0][col], cryoturbation_coef_, met,
+               temp_c, pres_c, ws.depth, ws.dz,
                pfts_[col], soil_carbon_pools_[col],
-               co2_decomp_c, trans_c, sw_c);
+               ws.co2_decomp, ws.trans, sw_c);
 
     // copy back
-    // -- serious cache thrash... --etc
     for (std::size_t i=0; i!=col_iter.size(); ++i) {
       for (int p=0; p!=soil_carbon_pools_[col][i]->nPools; ++p) {
         sc_pools[p][col_iter[i]] = soil_carbon_pools_[col][i]->SOM[p];
       }
 
       // and integrate the decomp
-      co2_decomp[0][col_iter[i]] += co2_decomp_c[i];
+      co2_decomp[0][col_iter[i]] += ws.co2_decomp[i];
 
 
       // and pull in the transpiration, converting to mol/m^3/s, as a sink
-      trans[0][col_iter[i]] = trans_c[i] / .01801528;
+      trans[0][col_iter[i]] = ws.trans[i] / .01801528;
       sw[0][col] = sw_c;
     }
 
@@ -498,7 +508,13 @@ bool BGCSimple::AdvanceStep(double t_old, double t_new, bool reinit) {
       total_lai[0][col] += pfts_[col][lcv_pft]->lai;
     }
 
-  } // end loop over columns
+    PFTsToState_(col, pft_state, pft_root);
+  };
+
+  // loop over columns and apply the model
+  ParallelFor(ncols, num_threads_, 16, [&](int col, int tid) {
+      advance_column(col, workspaces_[tid]);
+    });
 
   // mark primaries as changed
   trans_eval_->SetFieldAsChanged(S_next_.ptr());
@@ -515,30 +531,51 @@ void BGCSimple::FieldToColumn_(AmanziMesh::Entity_ID col, const Epetra_Vector& v
     col_vec = Teuchos::ptr(new Epetra_SerialDenseVector(ncells_per_col_));
   }
 
-  auto& col_iter = mesh_->cells_of_column(col);
-  for (std::size_t i=0; i!=col_iter.size(); ++i) {
-    (*col_vec)[i] = vec[col_iter[i]];
-  }
+  columns_->GatherColumn(vec, col, col_vec->A());
 }
 
 // helper function for pushing field to column
 void BGCSimple::FieldToColumn_(AmanziMesh::Entity_ID col, const Epetra_Vector& vec,
                                double* col_vec, int ncol) {
-  auto& col_iter = mesh_->cells_of_column(col);
-  for (std::size_t i=0; i!=col_iter.size(); ++i) {
-    col_vec[i] = vec[col_iter[i]];
-  }
+  columns_->GatherColumn(vec, col, col_vec);
 }
 
   
+// helper functions for moving the state of a column's PFTs to and from State
+void BGCSimple::PFTsFromState_(AmanziMesh::Entity_ID col,
+                               const Epetra_MultiVector& pft_state,
+                               const Epetra_MultiVector& pft_root) {
+  auto& col_iter = columns_->cells(col);
+  for (int i=0; i!=pfts_[col].size(); ++i) {
+    PFT& pft = *pfts_[col][i];
+    pft.CopyStateFrom(pft_state, i * PFT::num_state, col);
+    for (std::size_t j=0; j!=col_iter.size(); ++j) {
+      pft.BRootSoil[j] = pft_root[i][col_iter[j]];
+    }
+  }
+}
+
+void BGCSimple::PFTsToState_(AmanziMesh::Entity_ID col,
+                             Epetra_MultiVector& pft_state,
+                             Epetra_MultiVector& pft_root) const {
+  auto& col_iter = columns_->cells(col);
+  for (int i=0; i!=pfts_[col].size(); ++i) {
+    const PFT& pft = *pfts_[col][i];
+    pft.CopyStateTo(pft_state, i * PFT::num_state, col);
+    for (std::size_t j=0; j!=col_iter.size(); ++j) {
+      pft_root[i][col_iter[j]] = pft.BRootSoil[j];
+    }
+  }
+}
+
+
 // helper function for collecting column dz and depth
 void BGCSimple::ColDepthDz_(AmanziMesh::Entity_ID col,
                             Teuchos::Ptr<Epetra_SerialDenseVector> depth,
                             Teuchos::Ptr<Epetra_SerialDenseVector> dz) {
   AmanziMesh::Entity_ID f_above = mesh_surf_->entity_get_parent(AmanziMesh::CELL, col);
-  auto& col_iter = mesh_->cells_of_column(col);
-  ncells_per_col_ = col_iter.size();
-  
+  auto& col_iter = columns_->cells(col);
+
   AmanziGeometry::Point surf_centroid = mesh_->face_centroid(f_above);
   AmanziGeometry::Point neg_z(3);
   neg_z.set(0.,0.,-1);
@@ -49,6 +49,10 @@ that build_columns in the subsurface Mesh_ spec has been supplied.
 
   * `"cryoturbation mixing coefficient [cm^2/yr]`" ``[double]`` **5.0** Controls diffusion of carbon into the subsurface via cryoturbation.
 
+  * `"number of column threads`" ``[int]`` **1** Columns are independent, and
+    are advanced on this many OpenMP threads.  Ignored if ATS is built
+    without OpenMP.
+
   * `"leaf biomass initial condition`" ``[initial-conditions-spec]`` Sets the leaf biomass IC.
 
   * `"domain name`" ``[string]`` **domain**
@@ -63,6 +67,12 @@ that build_columns in the subsurface Mesh_ spec has been supplied.
 
   * `"total leaf area index key`" ``[string]`` **SURFACE_DOMAIN-total_leaf_area_index** Total LAI across all PFTs.
 
+  * `"pft state key`" ``[string]`` **SURFACE_DOMAIN-pft_state** Evolving state
+    of all PFTs, stored so that it is checkpointed.
+
+  * `"pft root biomass key`" ``[string]`` **DOMAIN-pft_root_biomass** Root
+    biomass of each PFT in each soil cell `[kg C m^-2]`
+
   EVALUATORS:
 
   - `"temperature`" The soil temperature `[K]`
@@ -88,6 +98,7 @@ that build_columns in the subsurface Mesh_ spec has been supplied.
 
 #include "PK_Factory.hh"
 #include "pk_physical_default.hh"
+#include "column_view.hh"
 
 #include "SoilCarbonParameters.hh"
 #include "PFT.hh"
@@ -141,6 +152,12 @@ class BGCSimple : public PK_Physical_Default {
                      bool copy=true);
   void FieldToColumn_(AmanziMesh::Entity_ID col, const Epetra_Vector& vec,
                       double* col_vec, int ncol);
+  void PFTsFromState_(AmanziMesh::Entity_ID col,
+                      const Epetra_MultiVector& pft_state,
+                      const Epetra_MultiVector& pft_root);
+  void PFTsToState_(AmanziMesh::Entity_ID col,
+                    Epetra_MultiVector& pft_state,
+                    Epetra_MultiVector& pft_root) const;
   void ColDepthDz_(AmanziMesh::Entity_ID col,
                    Teuchos::Ptr<Epetra_SerialDenseVector> depth,
                    Teuchos::Ptr<Epetra_SerialDenseVector> dz);
@@ -149,12 +166,24 @@ class BGCSimple : public PK_Physical_Default {
  protected:
   double dt_;
   Teuchos::RCP<const AmanziMesh::Mesh> mesh_surf_;
+  Teuchos::RCP<ColumnView> columns_;
+
+  // per-thread workspace for advancing a column
+  struct ColumnWorkspace_ {
+    explicit ColumnWorkspace_(int ncells) :
+        temp(ncells), pres(ncells), depth(ncells), dz(ncells),
+        co2_decomp(ncells), trans(ncells) {}
+
+    Epetra_SerialDenseVector temp, pres, depth, dz;
+    Epetra_SerialDenseVector co2_decomp, trans;
+  };
+  std::vector<ColumnWorkspace_> workspaces_;
+  int num_threads_;
   Key domain_surf_;
   
   // physical structs needed by model
   std::vector<Teuchos::RCP<SoilCarbonParameters> > sc_params_;
-  std::vector<std::vector<Teuchos::RCP<PFT> > > pfts_;       // this also contains state data!
-  std::vector<std::vector<Teuchos::RCP<PFT> > > pfts_old_;   // need two copies for failed timesteps
+  std::vector<std::vector<Teuchos::RCP<PFT> > > pfts_;  // state is loaded from State each step
   std::vector<std::vector<Teuchos::RCP<SoilCarbon> > > soil_carbon_pools_;
 
   // evaluator for transpiration
@@ -173,6 +202,8 @@ class BGCSimple : public PK_Physical_Default {
   Key trans_key_;
   Key shaded_sw_key_;
   Key total_lai_key_;
+  Key pft_state_key_;
+  Key pft_root_key_;
 
 
  private:
@@ -263,6 +263,7 @@ void FATES_PK::Initialize(const Teuchos::Ptr<State>& S){
       }
       
     }
+    columns_ = Teuchos::rcp(new ColumnView(*mesh_, ncells_owned_));
   }
 
   int array_size = ncells_per_col_*ncells_owned_;
@@ -381,48 +382,44 @@ bool FATES_PK::AdvanceStep(double t_old, double t_new, bool reinit){
 
   if (run_photo){
 
-    for (unsigned int c=0; c<ncells_owned_; ++c){
-      
-      if (surface_only_){
+    if (surface_only_){
+      for (unsigned int c=0; c<ncells_owned_; ++c){
         t_soil_[c] = air_temp[0][c];
         poro_[c] = 0.5;
         eff_poro_[c] = poro_[c];
         vsm_[c] = 1.*poro_[c];
         suc_[c] = 0.;
+      }
+    }else{
+      // soil fields are gathered whole into the column-major arrays, all
+      // columns having ncells_per_col_ cells
+      if (S_next_->HasField(soil_temp_key_)){
+        S_next_->GetFieldEvaluator(soil_temp_key_)->HasFieldChanged(S_next_.ptr(), name_);
+        const Epetra_Vector& temp_vec = *(*S_next_->GetFieldData(soil_temp_key_)->ViewComponent("cell", false))(0);
+        columns_->Gather(temp_vec, t_soil_.data());
+      }
+
+      if (S_next_->HasField(poro_key_)){
+        S_next_->GetFieldEvaluator(poro_key_)->HasFieldChanged(S_next_.ptr(), name_);
+        const Epetra_Vector& poro_vec = *(*S_next_->GetFieldData(poro_key_)->ViewComponent("cell", false))(0);
+        columns_->Gather(poro_vec, poro_.data());
+      }
+      eff_poro_.assign(poro_.begin(), poro_.end());
+
+      if (S_next_->HasField(sat_key_)){
+        S_next_->GetFieldEvaluator(sat_key_)->HasFieldChanged(S_next_.ptr(), name_);
+        const Epetra_Vector& sat_vec = *(*S_next_->GetFieldData(sat_key_)->ViewComponent("cell", false))(0);
+        columns_->Gather(sat_vec, vsm_.data());
       }else{
-        
-        if (S_next_->HasField(soil_temp_key_)){
-          S_next_->GetFieldEvaluator(soil_temp_key_)->HasFieldChanged(S_next_.ptr(), name_);
-          const Epetra_Vector& temp_vec = *(*S_next_->GetFieldData(soil_temp_key_)->ViewComponent("cell", false))(0);        
-          FieldToColumn_(c, temp_vec, t_soil_.data() + c*ncells_per_col_, ncells_per_col_);
-        }
-        
-        
-        if (S_next_->HasField(poro_key_)){
-          S_next_->GetFieldEvaluator(poro_key_)->HasFieldChanged(S_next_.ptr(), name_);
-          const Epetra_Vector& poro_vec = *(*S_next_->GetFieldData(poro_key_)->ViewComponent("cell", false))(0);        
-          FieldToColumn_(c, poro_vec, poro_.data() + c*ncells_per_col_, ncells_per_col_);
-        }
-        eff_poro_.assign(poro_.begin(), poro_.end());
-
-        if (S_next_->HasField(sat_key_)){
-          S_next_->GetFieldEvaluator(sat_key_)->HasFieldChanged(S_next_.ptr(), name_);
-          const Epetra_Vector& sat_vec = *(*S_next_->GetFieldData(sat_key_)->ViewComponent("cell", false))(0);        
-          FieldToColumn_(c, sat_vec, vsm_.data() + c*ncells_per_col_, ncells_per_col_);
-                   
-        }else{
-          vsm_.assign(poro_.begin(), poro_.end());  // No saturation in state. Fully saturated assumption;
-        }
-
-        if (S_next_->HasField(suc_key_)){          
-          S_next_->GetFieldEvaluator(suc_key_)->HasFieldChanged(S_next_.ptr(), name_);
-          const Epetra_Vector& suc_vec = *(*S_next_->GetFieldData(suc_key_)->ViewComponent("cell", false))(0);        
-          FieldToColumn_(c, suc_vec, suc_.data() + c*ncells_per_col_, ncells_per_col_);
-          
-        }else{
-          for(int i=0;i<suc_.size();i++) suc_[i] = 0.;  // No suction is defined in State;
-        }
-        
+        vsm_.assign(poro_.begin(), poro_.end());  // No saturation in state. Fully saturated assumption;
+      }
+
+      if (S_next_->HasField(suc_key_)){
+        S_next_->GetFieldEvaluator(suc_key_)->HasFieldChanged(S_next_.ptr(), name_);
+        const Epetra_Vector& suc_vec = *(*S_next_->GetFieldData(suc_key_)->ViewComponent("cell", false))(0);
+        columns_->Gather(suc_vec, suc_.data());
+      }else{
+        for(int i=0;i<suc_.size();i++) suc_[i] = 0.;  // No suction is defined in State;
       }
     }
 
@@ -518,40 +515,25 @@ bool FATES_PK::AdvanceStep(double t_old, double t_new, bool reinit){
   }
 
   
-  std::vector<double> temp_veg24_patch(1);
-  std::vector<double> prec24_patch(1);
-  std::vector<double> rh24_patch(1);
-  std::vector<double> wind24_patch(1);
-  std::vector<double> h2osoi_vol_col;
-
   if (run_veg_dym){
+    // Site inputs are local to each site's iteration.  Sites are still
+    // advanced serially, as the FATES driver keeps its state in Fortran
+    // module variables of a single clump.
     for (int c=0; c<ncells_owned_; c++){
       int s=c+1;
 
-      temp_veg24_patch[0] = air_temp[0][c];
+      double temp_veg24_patch = air_temp[0][c];
+      double prec24_patch = precip_rain[0][c];
+      double wind24_patch = wind[0][c];
+      double rh24_patch = humidity[0][c];
       site_[c].temp_veg24_patch = air_temp[0][c];
-      prec24_patch[0] = precip_rain[0][c];
-      wind24_patch[0] = wind[0][c];
-      rh24_patch[0] = humidity[0][c];
-
-
-      // if (surface_only_){
-      //   h2osoi_vol_col.resize(1);
-      //   h2osoi_vol_col[0] = 0.5;
-      // }else{
-      //   h2osoi_vol_col.resize(ncells_per_col_);        
-      //   S_next_->GetFieldEvaluator(poro_key_)->HasFieldChanged(S_next_.ptr(), name_);
-      //   const Epetra_Vector& poro_vec = *(*S_next_->GetFieldData(poro_key_)->ViewComponent("cell", false))(0);        
-      //   FieldToColumn_(c, poro_vec, h2osoi_vol_col.data(), ncells_per_col_);
-      // }      
-             
+
       dynamics_driv_per_site(&clump_, &s, &(site_[c]), &dtime,
                              vsm_.data() + c*ncells_per_col_,  // column data for volumetric soil moisture content
-                             temp_veg24_patch.data(),
-                             prec24_patch.data(),
-                             rh24_patch.data(),
-                             wind24_patch.data());
-    
+                             &temp_veg24_patch,
+                             &prec24_patch,
+                             &rh24_patch,
+                             &wind24_patch);
     }
     t_site_dym_ = t_new;
   }
@@ -581,10 +563,7 @@ void FATES_PK::CommitStep(double t_old, double t_new, const Teuchos::RCP<State>&
 void FATES_PK::FieldToColumn_(AmanziMesh::Entity_ID col, const Epetra_Vector& vec,
                                double* col_vec, int ncol) {
 
-  auto& col_iter = mesh_->cells_of_column(col);
-  for (std::size_t i=0; i!=col_iter.size(); ++i) {
-    col_vec[i] = vec[col_iter[i]];
-  }
+  columns_->GatherColumn(vec, col, col_vec);
 }
 
 // helper function for collecting column dz and depth
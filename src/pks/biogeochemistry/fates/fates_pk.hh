@@ -11,6 +11,7 @@ Authors: Daniil Svyatsky (dasvyat@lanl.gov), Xu Chonggang
 
 #include "PK_Factory.hh"
 #include "pk_physical_default.hh"
+#include "column_view.hh"
 #include "ISO_Fortran_binding.h"
 
 #include "Teuchos_ParameterList.hpp"
@@ -129,6 +130,7 @@ namespace BGC {
     
     bool surface_only_;
     Teuchos::RCP<const AmanziMesh::Mesh> mesh_surf_, mesh_domain_;
+    Teuchos::RCP<ColumnView> columns_;
     Key domain_surf_;
     Key trans_key_;
     Key precip_key_, air_temp_key_, humidity_key_, wind_key_, co2a_key_;
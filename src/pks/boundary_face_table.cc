@@ -0,0 +1,60 @@
+/* -*-  mode: c++; indent-tabs-mode: nil -*- */
+/*
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+*/
+
+//! Cached boundary face connectivity of a mesh.
+
+#include <algorithm>
+
+#include "errors.hh"
+#include "mesh_cache.hh"
+#include "boundary_face_table.hh"
+
+namespace Amanzi {
+
+BoundaryFaceTable::BoundaryFaceTable(const AmanziMesh::Mesh& mesh)
+{
+  const auto& fmap = mesh.face_map(true);
+  const auto& bfmap = mesh.exterior_face_map(false);
+  int nbfaces = bfmap.NumMyElements();
+  int nfaces = mesh.num_entities(AmanziMesh::FACE, AmanziMesh::Parallel_type::OWNED);
+
+  faces_.resize(nbfaces);
+  cells_.resize(nbfaces);
+  dirs_.resize(nbfaces);
+  face_to_bf_.assign(nfaces, -1);
+
+  AmanziMesh::Entity_ID_List cells, faces;
+  std::vector<int> fdirs;
+  for (int bf=0; bf!=nbfaces; ++bf) {
+    AmanziMesh::Entity_ID f = fmap.LID(bfmap.GID(bf));
+    mesh.face_get_cells(f, AmanziMesh::Parallel_type::ALL, &cells);
+    if (cells.size() != 1) {
+      Errors::Message msg;
+      msg << "BoundaryFaceTable: boundary face " << bf << " (face " << f
+          << ") has " << (int) cells.size() << " cells.";
+      Exceptions::amanzi_throw(msg);
+    }
+    mesh.cell_get_faces_and_dirs(cells[0], &faces, &fdirs);
+
+    faces_[bf] = f;
+    cells_[bf] = cells[0];
+    dirs_[bf] = fdirs[std::find(faces.begin(), faces.end(), f) - faces.begin()];
+    if (f < nfaces) face_to_bf_[f] = bf;
+  }
+}
+
+
+Teuchos::RCP<const BoundaryFaceTable>
+getBoundaryFaceTable(const Teuchos::RCP<const AmanziMesh::Mesh>& mesh)
+{
+  static MeshCache<BoundaryFaceTable> tables;
+  return tables.get(mesh, [](const AmanziMesh::Mesh& m) {
+      return Teuchos::rcp(new BoundaryFaceTable(m));
+    });
+}
+
+} // namespace Amanzi
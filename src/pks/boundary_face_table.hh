@@ -0,0 +1,72 @@
+/* -*-  mode: c++; indent-tabs-mode: nil -*- */
+/*
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+*/
+
+//! Cached boundary face connectivity of a mesh.
+
+/*
+  Evaluators and PKs that work with "boundary_face" components need, for each
+  boundary face, the corresponding face, the interior cell (e.g. to choose a
+  WRM region), and sometimes the orientation of the face.  Computing these
+  through the exterior face map and face_get_cells() costs two map lookups
+  and a connectivity query per boundary face per evaluation.
+
+  BoundaryFaceTable computes them once for the owned boundary faces, along
+  with the inverse map from owned faces to boundary faces.  There is one
+  table per mesh, built on first use by getBoundaryFaceTable() and shared by
+  all evaluators and PKs on that mesh.  Tables depend only on mesh topology,
+  so they remain valid if the mesh is deformed.
+*/
+
+#pragma once
+
+#include <vector>
+
+#include "Teuchos_RCP.hpp"
+
+#include "dbc.hh"
+#include "Mesh.hh"
+
+namespace Amanzi {
+
+class BoundaryFaceTable {
+ public:
+  explicit BoundaryFaceTable(const AmanziMesh::Mesh& mesh);
+
+  // number of owned boundary faces
+  int size() const { return faces_.size(); }
+
+  // face LID of boundary face bf
+  AmanziMesh::Entity_ID face(AmanziMesh::Entity_ID bf) const { return faces_[bf]; }
+
+  // LID of the (only) cell of boundary face bf
+  AmanziMesh::Entity_ID cell(AmanziMesh::Entity_ID bf) const { return cells_[bf]; }
+
+  // direction of the face normal of bf relative to the outward normal of the
+  // domain, i.e. of cell(bf)
+  int dir(AmanziMesh::Entity_ID bf) const { return dirs_[bf]; }
+
+  // boundary face LID of owned face f, or -1 if f is not on the boundary
+  AmanziMesh::Entity_ID boundary_face(AmanziMesh::Entity_ID f) const {
+    AMANZI_ASSERT(f >= 0 && f < face_to_bf_.size());
+    return face_to_bf_[f];
+  }
+
+ private:
+  std::vector<AmanziMesh::Entity_ID> faces_;
+  std::vector<AmanziMesh::Entity_ID> cells_;
+  std::vector<int> dirs_;
+  std::vector<AmanziMesh::Entity_ID> face_to_bf_;
+};
+
+
+// -----------------------------------------------------------------------------
+// Get the boundary face table of mesh, building it on first use.
+// -----------------------------------------------------------------------------
+Teuchos::RCP<const BoundaryFaceTable>
+getBoundaryFaceTable(const Teuchos::RCP<const AmanziMesh::Mesh>& mesh);
+
+} // namespace Amanzi
@@ -0,0 +1,222 @@
+/* -*-  mode: c++; indent-tabs-mode: nil -*- */
+/*
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+*/
+
+//! Optional interface for updating secondary variables on a subset of cells.
+
+/*
+  When a field evaluator sees a changed dependency, it recomputes its field
+  everywhere, even if the primary variables only changed on a few cells, e.g.
+  the top layer of cells below a surface system, or a set of columns that was
+  re-solved.
+
+  Evaluators whose values on an entity depend only on dependency values on
+  the same entity (or, for boundary faces, on the interior cell) may also
+  implement CellSubsetEvaluator.  HasFieldChangedOnCells() works like
+  HasFieldChanged(), but assumes that primary variables have changed only on
+  the given cells and on their faces, and recomputes the field only there.
+  The result says how far the field changed:
+
+  - NONE if it did not change for this request,
+  - CELLS if it changed only on the cells and their faces, and
+  - ALL if it may have changed anywhere.
+
+  A dependency that is neither a primary variable nor a CellSubsetEvaluator,
+  or an evaluator that cannot update the requested components on a subset,
+  results in a full evaluation and ALL, so partial updates propagate through
+  the dependency graph exactly as far as they are known to be partial.
+  Updated fields are marked as changed for all other requests as usual, so
+  consumers that only call HasFieldChanged() see the new values, and
+  derivatives are recomputed in full on their next request.
+
+  Callers use UpdateFieldsOnCells() after changing primary variables on a
+  subset of cells and marking them as changed.
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "Teuchos_RCP.hpp"
+
+#include "CompositeVector.hh"
+#include "Key.hh"
+#include "Mesh.hh"
+#include "State.hh"
+#include "primary_variable_field_evaluator.hh"
+
+namespace Amanzi {
+
+enum class CellSubsetChange {
+  NONE = 0,
+  CELLS,
+  ALL
+};
+
+
+class CellSubsetEvaluator {
+ public:
+  virtual ~CellSubsetEvaluator() = default;
+
+  // Like HasFieldChanged(), but updates the field only on cells (and their
+  // faces) if that is all that changed.
+  virtual CellSubsetChange HasFieldChangedOnCells(const Teuchos::Ptr<State>& S,
+          const Key& request, const AmanziMesh::Entity_ID_List& cells) = 0;
+
+ protected:
+  // Implementation of HasFieldChangedOnCells() for an evaluator with the
+  // given key, dependencies, and requests.  update_on_cells() recomputes the
+  // field on cells and returns false if it cannot do so, in which case
+  // update_all() recomputes the field everywhere.  Evaluators must clear
+  // changed_on_cells_ when they are updated through HasFieldChanged().
+  template<typename UpdateOnCells, typename UpdateAll>
+  CellSubsetChange
+  HasFieldChangedOnCells_(const Teuchos::Ptr<State>& S, const Key& request,
+                          const AmanziMesh::Entity_ID_List& cells,
+                          const Key& my_key, const KeySet& dependencies,
+                          KeySet& requests,
+                          const UpdateOnCells& update_on_cells,
+                          const UpdateAll& update_all);
+
+  // whether the last update was on a subset of cells only
+  bool changed_on_cells_ = false;
+};
+
+
+// -----------------------------------------------------------------------------
+// The owned entities of component comp of a field on mesh touched by cells:
+// the cells themselves, their faces, or their boundary faces.  Returns false
+// for other components.
+// -----------------------------------------------------------------------------
+inline bool
+getCellSubsetEntities(const AmanziMesh::Mesh& mesh, const std::string& comp,
+                      const AmanziMesh::Entity_ID_List& cells,
+                      AmanziMesh::Entity_ID_List& entities)
+{
+  entities.clear();
+  if (comp == "cell") {
+    int ncells = mesh.num_entities(AmanziMesh::CELL, AmanziMesh::Parallel_type::OWNED);
+    for (auto c : cells) {
+      if (c < ncells) entities.push_back(c);
+    }
+    return true;
+  }
+
+  if (comp != "face" && comp != "boundary_face") return false;
+
+  int nfaces = mesh.num_entities(AmanziMesh::FACE, AmanziMesh::Parallel_type::OWNED);
+  AmanziMesh::Entity_ID_List faces;
+  for (auto c : cells) {
+    mesh.cell_get_faces(c, &faces);
+    for (auto f : faces) {
+      if (f < nfaces) entities.push_back(f);
+    }
+  }
+  std::sort(entities.begin(), entities.end());
+  entities.erase(std::unique(entities.begin(), entities.end()), entities.end());
+
+  if (comp == "boundary_face") {
+    // only a few faces, so the map lookups are cheap here
+    const auto& fmap = mesh.face_map(false);
+    const auto& bfmap = mesh.exterior_face_map(false);
+    int nbf = 0;
+    for (auto f : entities) {
+      int bf = bfmap.LID(fmap.GID(f));
+      if (bf >= 0) entities[nbf++] = bf;
+    }
+    entities.resize(nbf);
+  }
+  return true;
+}
+
+
+// -----------------------------------------------------------------------------
+// The same for each component of cv, in the order of its components.
+// -----------------------------------------------------------------------------
+inline bool
+getCellSubsetEntities(const CompositeVector& cv,
+                      const AmanziMesh::Entity_ID_List& cells,
+                      std::vector<AmanziMesh::Entity_ID_List>& entities)
+{
+  entities.clear();
+  for (CompositeVector::name_iterator comp=cv.begin(); comp!=cv.end(); ++comp) {
+    entities.emplace_back();
+    if (!getCellSubsetEntities(*cv.Mesh(), *comp, cells, entities.back())) return false;
+  }
+  return true;
+}
+
+
+// -----------------------------------------------------------------------------
+// Update the fields of keys after primary variables they depend on changed
+// only on cells and their faces.  Fields whose evaluators do not implement
+// CellSubsetEvaluator are updated in full.
+// -----------------------------------------------------------------------------
+inline void
+UpdateFieldsOnCells(const Teuchos::Ptr<State>& S, const std::vector<Key>& keys,
+                    const Key& request, const AmanziMesh::Entity_ID_List& cells)
+{
+  for (const auto& key : keys) {
+    Teuchos::RCP<FieldEvaluator> eval = S->GetFieldEvaluator(key);
+    auto subset_eval = dynamic_cast<CellSubsetEvaluator*>(eval.get());
+    if (subset_eval) {
+      subset_eval->HasFieldChangedOnCells(S, request, cells);
+    } else {
+      eval->HasFieldChanged(S, request);
+    }
+  }
+}
+
+
+template<typename UpdateOnCells, typename UpdateAll>
+CellSubsetChange
+CellSubsetEvaluator::HasFieldChangedOnCells_(const Teuchos::Ptr<State>& S,
+        const Key& request, const AmanziMesh::Entity_ID_List& cells,
+        const Key& my_key, const KeySet& dependencies, KeySet& requests,
+        const UpdateOnCells& update_on_cells, const UpdateAll& update_all)
+{
+  // ask every dependency, as HasFieldChanged() does, so that all of them are
+  // up to date for this field
+  CellSubsetChange change = CellSubsetChange::NONE;
+  for (const auto& dep : dependencies) {
+    Teuchos::RCP<FieldEvaluator> dep_eval = S->GetFieldEvaluator(dep);
+    auto dep_subset = dynamic_cast<CellSubsetEvaluator*>(dep_eval.get());
+
+    CellSubsetChange dep_change = CellSubsetChange::NONE;
+    if (dep_subset) {
+      dep_change = dep_subset->HasFieldChangedOnCells(S, my_key, cells);
+    } else if (dep_eval->HasFieldChanged(S, my_key)) {
+      dep_change = dynamic_cast<PrimaryVariableFieldEvaluator*>(dep_eval.get()) ?
+          CellSubsetChange::CELLS : CellSubsetChange::ALL;
+    }
+    change = std::max(change, dep_change);
+  }
+
+  // a field that has never been evaluated must be evaluated everywhere
+  if (change == CellSubsetChange::CELLS && requests.empty()) {
+    change = CellSubsetChange::ALL;
+  }
+  if (change == CellSubsetChange::CELLS && !update_on_cells()) {
+    change = CellSubsetChange::ALL;
+  }
+  if (change == CellSubsetChange::ALL) update_all();
+
+  if (change != CellSubsetChange::NONE) {
+    changed_on_cells_ = change == CellSubsetChange::CELLS;
+    requests.clear();
+    requests.insert(request);
+    return change;
+  }
+
+  // nothing new, but this request may not have seen the last update
+  if (requests.count(request)) return CellSubsetChange::NONE;
+  requests.insert(request);
+  return changed_on_cells_ ? CellSubsetChange::CELLS : CellSubsetChange::ALL;
+}
+
+} // namespace Amanzi
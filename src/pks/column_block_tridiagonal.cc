@@ -0,0 +1,174 @@
+/* -*-  mode: c++; indent-tabs-mode: nil -*- */
+/*
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+*/
+
+//! Batched block-tridiagonal factorization and solve for independent columns.
+
+#include <algorithm>
+#include <cmath>
+
+#include "column_block_tridiagonal.hh"
+
+namespace Amanzi {
+
+BatchedBlockTridiagonal::BatchedBlockTridiagonal(int ncols, int ncells, int nvars) :
+    ncols_(ncols),
+    ncells_(ncells),
+    nvars_(nvars),
+    blocks_(3 * nvars * nvars * ncells * ncols, 0.),
+    singular_(ncols, 0)
+{}
+
+
+void
+BatchedBlockTridiagonal::PutScalar(double val)
+{
+  std::fill(blocks_.begin(), blocks_.end(), val);
+}
+
+
+void
+BatchedBlockTridiagonal::Apply(const double* x, double* y) const
+{
+  int n = ncols_;
+  int vstride = ncells_ * n;
+  std::fill(y, y + size(), 0.);
+  for (int k=0; k!=ncells_; ++k) {
+    for (int r=0; r!=nvars_; ++r) {
+      double* yk = y + r*vstride + k*n;
+      for (int s=0; s!=nvars_; ++s) {
+        const double* xs = x + s*vstride;
+        const double* D_rs = D(r,s) + k*n;
+        for (int i=0; i!=n; ++i) yk[i] += D_rs[i] * xs[k*n + i];
+        if (k > 0) {
+          const double* L_rs = L(r,s) + k*n;
+          for (int i=0; i!=n; ++i) yk[i] += L_rs[i] * xs[(k-1)*n + i];
+        }
+        if (k < ncells_-1) {
+          const double* U_rs = U(r,s) + k*n;
+          for (int i=0; i!=n; ++i) yk[i] += U_rs[i] * xs[(k+1)*n + i];
+        }
+      }
+    }
+  }
+}
+
+
+int
+BatchedBlockTridiagonal::Factor()
+{
+  int n = ncols_;
+  int bstride = nvars_ * ncells_ * n; // distance between block rows
+  std::fill(singular_.begin(), singular_.end(), 0);
+
+  FactorDiagonal_(0);
+  for (int k=0; k<ncells_-1; ++k) {
+    // U_k <-- D_k^-1 U_k
+    for (int s=0; s!=nvars_; ++s) SolveDiagonal_(k, U(0,s) + k*n, bstride);
+
+    // D_k+1 <-- D_k+1 - L_k+1 U_k
+    for (int r=0; r!=nvars_; ++r) {
+      for (int s=0; s!=nvars_; ++s) {
+        double* D_rs = D(r,s) + (k+1)*n;
+        for (int p=0; p!=nvars_; ++p) {
+          const double* L_rp = L(r,p) + (k+1)*n;
+          const double* U_ps = U(p,s) + k*n;
+          for (int i=0; i!=n; ++i) D_rs[i] -= L_rp[i] * U_ps[i];
+        }
+      }
+    }
+    FactorDiagonal_(k+1);
+  }
+  return std::count(singular_.begin(), singular_.end(), 1);
+}
+
+
+void
+BatchedBlockTridiagonal::Solve(double* x) const
+{
+  int n = ncols_;
+  int vstride = ncells_ * n;
+
+  // forward elimination
+  SolveDiagonal_(0, x, vstride);
+  for (int k=1; k!=ncells_; ++k) {
+    for (int r=0; r!=nvars_; ++r) {
+      double* xk = x + r*vstride + k*n;
+      for (int p=0; p!=nvars_; ++p) {
+        const double* L_rp = L(r,p) + k*n;
+        const double* xkm1 = x + p*vstride + (k-1)*n;
+        for (int i=0; i!=n; ++i) xk[i] -= L_rp[i] * xkm1[i];
+      }
+    }
+    SolveDiagonal_(k, x + k*n, vstride);
+  }
+
+  // back substitution
+  for (int k=ncells_-2; k>=0; --k) {
+    for (int r=0; r!=nvars_; ++r) {
+      double* xk = x + r*vstride + k*n;
+      for (int p=0; p!=nvars_; ++p) {
+        const double* U_rp = U(r,p) + k*n;
+        const double* xkp1 = x + p*vstride + (k+1)*n;
+        for (int i=0; i!=n; ++i) xk[i] -= U_rp[i] * xkp1[i];
+      }
+    }
+  }
+}
+
+
+void
+BatchedBlockTridiagonal::FactorDiagonal_(int k)
+{
+  int n = ncols_;
+  for (int p=0; p!=nvars_; ++p) {
+    const double* piv = D(p,p) + k*n;
+    for (int i=0; i!=n; ++i) {
+      if (piv[i] == 0. || !std::isfinite(piv[i])) singular_[i] = 1;
+    }
+
+    for (int r=p+1; r<nvars_; ++r) {
+      double* D_rp = D(r,p) + k*n;
+      for (int i=0; i!=n; ++i) D_rp[i] /= piv[i];
+      for (int s=p+1; s<nvars_; ++s) {
+        double* D_rs = D(r,s) + k*n;
+        const double* D_ps = D(p,s) + k*n;
+        for (int i=0; i!=n; ++i) D_rs[i] -= D_rp[i] * D_ps[i];
+      }
+    }
+  }
+}
+
+
+void
+BatchedBlockTridiagonal::SolveDiagonal_(int k, double* x, int stride) const
+{
+  int n = ncols_;
+
+  // unit lower triangular
+  for (int r=1; r<nvars_; ++r) {
+    double* xr = x + r*stride;
+    for (int p=0; p!=r; ++p) {
+      const double* D_rp = D(r,p) + k*n;
+      const double* xp = x + p*stride;
+      for (int i=0; i!=n; ++i) xr[i] -= D_rp[i] * xp[i];
+    }
+  }
+
+  // upper triangular
+  for (int r=nvars_-1; r>=0; --r) {
+    double* xr = x + r*stride;
+    for (int s=r+1; s<nvars_; ++s) {
+      const double* D_rs = D(r,s) + k*n;
+      const double* xs = x + s*stride;
+      for (int i=0; i!=n; ++i) xr[i] -= D_rs[i] * xs[i];
+    }
+    const double* D_rr = D(r,r) + k*n;
+    for (int i=0; i!=n; ++i) xr[i] /= D_rr[i];
+  }
+}
+
+} // namespace Amanzi
@@ -0,0 +1,88 @@
+/* -*-  mode: c++; indent-tabs-mode: nil -*- */
+/*
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+*/
+
+//! Batched block-tridiagonal factorization and solve for independent columns.
+
+/*
+  The Jacobian of a 1-D column problem with nvars unknowns per cell (1 for
+  Richards, 2 for pressure and temperature in permafrost) is block
+  tridiagonal, with nvars x nvars blocks.  For an ensemble of columns of the
+  same number of cells, BatchedBlockTridiagonal stores all of their Jacobians
+  together and factors and solves them at once by block Thomas elimination,
+  with the loop over columns innermost so that it vectorizes.
+
+  Storage follows ColumnEnsemble: entry (r,s) of the diagonal block of cell k
+  of column i is D(r,s)[k * num_columns() + i], and likewise for the
+  sub-diagonal block L (coupling cell k to cell k-1) and the super-diagonal
+  block U (coupling cell k to cell k+1).  Vectors are variable-major: unknown
+  r of cell k of column i is x[(r * num_cells() + k) * num_columns() + i],
+  i.e. nvars ColumnEnsemble-packed arrays back to back.
+
+  Blocks are factored without pivoting, which is appropriate for the
+  diagonally dominant (in the block sense) Jacobians of backward Euler
+  diffusion problems.  Factor() overwrites the blocks, and flags columns with
+  a zero or non-finite pivot as singular.
+*/
+
+#pragma once
+
+#include <vector>
+
+namespace Amanzi {
+
+class BatchedBlockTridiagonal {
+ public:
+  BatchedBlockTridiagonal(int ncols, int ncells, int nvars);
+
+  int num_columns() const { return ncols_; }
+  int num_cells() const { return ncells_; }
+  int num_vars() const { return nvars_; }
+
+  // length of a vector
+  int size() const { return ncols_ * ncells_ * nvars_; }
+
+  // block entries, each of length num_cells() * num_columns()
+  double* L(int r, int s) { return &blocks_[block_(0, r, s)]; }
+  double* D(int r, int s) { return &blocks_[block_(1, r, s)]; }
+  double* U(int r, int s) { return &blocks_[block_(2, r, s)]; }
+  const double* L(int r, int s) const { return &blocks_[block_(0, r, s)]; }
+  const double* D(int r, int s) const { return &blocks_[block_(1, r, s)]; }
+  const double* U(int r, int s) const { return &blocks_[block_(2, r, s)]; }
+
+  void PutScalar(double val);
+
+  // y = A * x, for the unfactored matrix
+  void Apply(const double* x, double* y) const;
+
+  // Factor all columns in place.  Returns the number of singular columns;
+  // solutions of those columns are not meaningful.
+  int Factor();
+
+  // was column i singular in the last Factor()?
+  bool singular(int i) const { return singular_[i]; }
+
+  // Solve in place, x <-- A^-1 x, after Factor().
+  void Solve(double* x) const;
+
+ private:
+  int block_(int which, int r, int s) const {
+    return ((which * nvars_ + r) * nvars_ + s) * ncells_ * ncols_;
+  }
+
+  // LU-factor the diagonal block of cell k, flagging singular columns
+  void FactorDiagonal_(int k);
+
+  // x <-- D_k^-1 x, where x holds nvars rows, each of stride stride
+  void SolveDiagonal_(int k, double* x, int stride) const;
+
+ private:
+  int ncols_, ncells_, nvars_;
+  std::vector<double> blocks_;
+  std::vector<char> singular_;
+};
+
+} // namespace Amanzi
@@ -0,0 +1,152 @@
+/* -*-  mode: c++; indent-tabs-mode: nil -*- */
+/*
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+*/
+
+//! Batched, column-interleaved storage for the columns of a column domain set.
+
+#include "column_ensemble.hh"
+
+namespace Amanzi {
+
+ColumnEnsemble::ColumnEnsemble(const State& S, const std::string& domain_set)
+{
+  if (!S.HasDomainSet(domain_set)) {
+    Errors::Message msg;
+    msg << "ColumnEnsemble: no domain set \"" << domain_set << "\".";
+    Exceptions::amanzi_throw(msg);
+  }
+
+  std::vector<Key> domains;
+  std::vector<int> ncells;
+  for (const auto& subdomain : *S.GetDomainSet(domain_set)) {
+    domains.emplace_back(subdomain);
+    ncells.emplace_back(S.GetMesh(subdomain)->num_entities(AmanziMesh::CELL,
+            AmanziMesh::Parallel_type::OWNED));
+  }
+  Init_(domains, ncells);
+}
+
+
+ColumnEnsemble::ColumnEnsemble(const std::vector<Key>& domains,
+                               const std::vector<int>& ncells)
+{
+  AMANZI_ASSERT(domains.size() == ncells.size());
+  Init_(domains, ncells);
+}
+
+
+void
+ColumnEnsemble::Init_(const std::vector<Key>& domains, const std::vector<int>& ncells)
+{
+  // group columns by number of cells
+  std::map<int, int> group_of_size;
+  for (int i=0; i!=domains.size(); ++i) {
+    auto lb = group_of_size.find(ncells[i]);
+    if (lb == group_of_size.end()) {
+      lb = group_of_size.emplace(ncells[i], groups_.size()).first;
+      groups_.emplace_back(Group_{ncells[i], {}});
+    }
+    Group_& group = groups_[lb->second];
+    positions_.emplace_back(lb->second, group.domains.size());
+    group.domains.emplace_back(domains[i]);
+  }
+  keys_cache_.resize(groups_.size());
+}
+
+
+const std::vector<Key>&
+ColumnEnsemble::keys_(int g, const std::string& var) const
+{
+  auto& keys = keys_cache_[g][var];
+  if (keys.empty()) {
+    keys.reserve(num_columns(g));
+    for (const auto& domain : groups_[g].domains) keys.emplace_back(Keys::getKey(domain, var));
+  }
+  return keys;
+}
+
+
+void
+ColumnEnsemble::Gather(const State& S, int g, const std::string& var, double* packed) const
+{
+  const auto& keys = keys_(g, var);
+  int ncols = num_columns(g);
+  for (int i=0; i!=ncols; ++i) {
+    const auto& v = *S.GetFieldData(keys[i])->ViewComponent("cell", false);
+    AMANZI_ASSERT(v.MyLength() == num_cells(g));
+    GatherColumn(v[0], g, i, packed);
+  }
+}
+
+
+void
+ColumnEnsemble::Scatter(const double* packed, int g, const std::string& var, State& S) const
+{
+  const auto& keys = keys_(g, var);
+  int ncols = num_columns(g);
+  for (int i=0; i!=ncols; ++i) {
+    auto& v = *S.GetFieldData(keys[i], S.GetField(keys[i])->owner())->ViewComponent("cell", false);
+    AMANZI_ASSERT(v.MyLength() == num_cells(g));
+    ScatterColumn(packed, g, i, v[0]);
+  }
+}
+
+
+void
+ColumnEnsemble::GatherColumn(const double* col, int g, int i, double* packed) const
+{
+  int ncols = num_columns(g);
+  for (int k=0; k!=num_cells(g); ++k) packed[k*ncols + i] = col[k];
+}
+
+
+void
+ColumnEnsemble::ScatterColumn(const double* packed, int g, int i, double* col) const
+{
+  int ncols = num_columns(g);
+  for (int k=0; k!=num_cells(g); ++k) col[k] = packed[k*ncols + i];
+}
+
+
+void
+ColumnEnsemble::GatherGeometry(const State& S, int g, double* cell_volume, double* cell_z,
+                               double* face_area, double* face_z) const
+{
+  int ncols = num_columns(g);
+  int ncells = num_cells(g);
+  AmanziMesh::Entity_ID_List faces, fcells;
+  for (int i=0; i!=ncols; ++i) {
+    const auto& domain = groups_[g].domains[i];
+    const AmanziMesh::Mesh& mesh = *S.GetMesh(domain);
+    int dim = mesh.space_dimension();
+
+    for (int k=0; k!=ncells; ++k) {
+      cell_volume[k*ncols + i] = mesh.cell_volume(k);
+      cell_z[k*ncols + i] = mesh.cell_centroid(k)[dim-1];
+
+      if (k == ncells-1) break;
+      bool found = false;
+      mesh.cell_get_faces(k, &faces);
+      for (auto f : faces) {
+        mesh.face_get_cells(f, AmanziMesh::Parallel_type::ALL, &fcells);
+        if (fcells.size() == 2 && (fcells[0] == k+1 || fcells[1] == k+1)) {
+          face_area[k*ncols + i] = mesh.face_area(f);
+          face_z[k*ncols + i] = mesh.face_centroid(f)[dim-1];
+          found = true;
+          break;
+        }
+      }
+      if (!found) {
+        Errors::Message msg;
+        msg << "ColumnEnsemble: cells " << k << " and " << k+1 << " of \""
+            << domain << "\" are not neighbors; column cells must be ordered along the column.";
+        Exceptions::amanzi_throw(msg);
+      }
+    }
+  }
+}
+
+} // namespace Amanzi
@@ -0,0 +1,99 @@
+/* -*-  mode: c++; indent-tabs-mode: nil -*- */
+/*
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+*/
+
+//! Batched, column-interleaved storage for the columns of a column domain set.
+
+/*
+  A column domain set (e.g. "column:*") holds one serial mesh, one set of
+  fields, and one PK per column.  Column physics is identical across the
+  columns, and for columns with the same topology (the same number of cells)
+  the same kernel may be applied to all of them at once, provided their data
+  is laid out together.
+
+  ColumnEnsemble groups the columns of a domain set on this rank by number of
+  cells and resolves, once, the field keys of each column.  Gather() copies a
+  cell field of every column in a group into a packed array, and Scatter()
+  copies it back.  Packed arrays are cell-major: cell k of the column mesh of
+  column i of a group is packed[k * num_columns(g) + i], so that loops over
+  the columns of a group are innermost and stride-one.
+
+  This is not an ensemble domain type: each column keeps its own mesh,
+  fields, evaluators, and PK, so the setup cost of a large domain set is
+  unchanged.  Only the solves are batched.
+
+  Scatter() writes the fields as their owners; callers are responsible for
+  marking primary variables as changed.  GatherColumn() and ScatterColumn()
+  do the same for one column held in plain storage.  Packed arrays of a group
+  are the vectors of a BatchedBlockTridiagonal of that group (one per
+  unknown), so ColumnNewton() can work on a group directly.  GatherGeometry()
+  packs the cell and face geometry a column discretization needs.
+*/
+
+#pragma once
+
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "Key.hh"
+#include "State.hh"
+
+namespace Amanzi {
+
+class ColumnEnsemble {
+ public:
+  ColumnEnsemble(const State& S, const std::string& domain_set);
+
+  // group the given subdomains, whose column meshes have ncells[i] cells
+  ColumnEnsemble(const std::vector<Key>& domains, const std::vector<int>& ncells);
+
+  int num_groups() const { return groups_.size(); }
+  int num_columns(int g) const { return groups_[g].domains.size(); }
+  int num_cells(int g) const { return groups_[g].ncells; }
+  int size(int g) const { return num_columns(g) * num_cells(g); }
+
+  // subdomains of group g, in domain set order
+  const std::vector<Key>& domains(int g) const { return groups_[g].domains; }
+
+  // (group, column in group) of the i-th subdomain of the domain set
+  const std::pair<int,int>& position(int i) const { return positions_[i]; }
+
+  // copy the cell component of DOMAIN-var of all columns of group g to/from a
+  // packed array of length size(g)
+  void Gather(const State& S, int g, const std::string& var, double* packed) const;
+  void Scatter(const double* packed, int g, const std::string& var, State& S) const;
+
+  // copy column i of group g, of length num_cells(g), to/from a packed array
+  void GatherColumn(const double* col, int g, int i, double* packed) const;
+  void ScatterColumn(const double* packed, int g, int i, double* col) const;
+
+  // Pack the geometry of the column meshes of group g: the volume and
+  // vertical centroid of each cell, each of length size(g), and the area and
+  // vertical centroid of the face between cells k and k+1, each of length
+  // (num_cells(g) - 1) * num_columns(g) and packed the same way.  Cells of
+  // each column must be ordered along the column.
+  void GatherGeometry(const State& S, int g, double* cell_volume, double* cell_z,
+                      double* face_area, double* face_z) const;
+
+ private:
+  void Init_(const std::vector<Key>& domains, const std::vector<int>& ncells);
+  const std::vector<Key>& keys_(int g, const std::string& var) const;
+
+ private:
+  struct Group_ {
+    int ncells;
+    std::vector<Key> domains;
+  };
+  std::vector<Group_> groups_;
+  std::vector<std::pair<int,int> > positions_;
+
+  // per-group column keys, by variable name
+  mutable std::vector<std::map<std::string, std::vector<Key> > > keys_cache_;
+};
+
+} // namespace Amanzi
@@ -0,0 +1,120 @@
+/* -*-  mode: c++; indent-tabs-mode: nil -*- */
+/*
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+*/
+
+//! Batched Newton iteration for an ensemble of independent 1-D columns.
+
+/*
+  Solves F(u) = 0 for all columns of an ensemble at once, where F is e.g. the
+  backward Euler residual of a column Richards or permafrost problem, using a
+  BatchedBlockTridiagonal Jacobian.  Unknowns and residuals use its
+  variable-major packed layout.  The model must provide:
+
+    // r <-- F(u) for all columns
+    void Residual(const double* u, double* r);
+
+    // J <-- dF/du at u, for all columns
+    void Jacobian(const double* u, BatchedBlockTridiagonal& J);
+
+  Each column converges independently, when the max norm of its residual is
+  below tol; a non-finite residual never counts as converged.  Converged
+  columns are no longer updated, and neither are columns whose Jacobian
+  Factor() flags as singular: those are left at their last iterate and
+  dropped from the iteration.  Returns the number of columns that did not
+  converge within max_its iterations (including the singular ones), and sets
+  its to the number of iterations taken.
+
+  The ColumnEnsemble overload solves all columns of group g of an ensemble,
+  with u holding nvars arrays packed by ColumnEnsemble::Gather(), back to
+  back.
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "column_block_tridiagonal.hh"
+#include "column_ensemble.hh"
+
+namespace Amanzi {
+
+template<class Model>
+int
+ColumnNewton(Model& model, BatchedBlockTridiagonal& J, double* u,
+             double tol, int max_its, int& its)
+{
+  int n = J.num_columns();
+  int nrows = J.num_cells() * J.num_vars();
+  std::vector<double> r(J.size());
+  std::vector<double> res_norm(n);
+  std::vector<char> singular(n, 0); // dropped after a singular Jacobian
+  std::vector<char> active(n, 1);   // neither converged nor singular
+
+  int nconverged = 0;
+  for (its=0; its<=max_its; ++its) {
+    model.Residual(u, r.data());
+
+    // per-column convergence; once NaN, a column's norm stays NaN
+    std::fill(res_norm.begin(), res_norm.end(), 0.);
+    for (int j=0; j!=nrows; ++j) {
+      const double* rj = &r[j*n];
+      for (int i=0; i!=n; ++i) {
+        double ar = std::abs(rj[i]);
+        if (std::isnan(ar) || ar > res_norm[i]) res_norm[i] = ar;
+      }
+    }
+    nconverged = 0;
+    int nactive = 0;
+    for (int i=0; i!=n; ++i) {
+      bool converged = !std::isnan(res_norm[i]) && res_norm[i] < tol;
+      if (converged) nconverged++;
+      active[i] = !converged && !singular[i];
+      if (active[i]) nactive++;
+    }
+    if (nactive == 0 || its == max_its) break;
+
+    model.Jacobian(u, J);
+    if (J.Factor() > 0) {
+      for (int i=0; i!=n; ++i) {
+        if (J.singular(i)) {
+          singular[i] = 1;
+          active[i] = 0;
+        }
+      }
+    }
+
+    // only active columns are solved for and updated
+    for (int j=0; j!=nrows; ++j) {
+      double* rj = &r[j*n];
+      for (int i=0; i!=n; ++i) {
+        if (!active[i]) rj[i] = 0.;
+      }
+    }
+    J.Solve(r.data());
+    for (int j=0; j!=nrows; ++j) {
+      double* uj = &u[j*n];
+      const double* rj = &r[j*n];
+      for (int i=0; i!=n; ++i) {
+        if (active[i]) uj[i] -= rj[i];
+      }
+    }
+  }
+  return n - nconverged;
+}
+
+
+template<class Model>
+int
+ColumnNewton(Model& model, const ColumnEnsemble& ensemble, int g, int nvars,
+             double* u, double tol, int max_its, int& its)
+{
+  BatchedBlockTridiagonal J(ensemble.num_columns(g), ensemble.num_cells(g), nvars);
+  return ColumnNewton(model, J, u, tol, max_its, its);
+}
+
+} // namespace Amanzi
@@ -140,6 +140,68 @@ Teuchos::RCP<const CompositeVector> cv = S->GetFieldData(cv_key_);
 }
 
 
+CellSubsetChange
+LiquidIceEnergyEvaluator::HasFieldChangedOnCells(const Teuchos::Ptr<State>& S,
+        const Key& request, const AmanziMesh::Entity_ID_List& cells)
+{
+  return HasFieldChangedOnCells_(S, request, cells, my_key_, dependencies_, requests_,
+          [&]() { return EvaluateFieldOnCells_(S, cells); },
+          [&]() { UpdateField_(S); });
+}
+
+
+void
+LiquidIceEnergyEvaluator::UpdateField_(const Teuchos::Ptr<State>& S)
+{
+  changed_on_cells_ = false;
+  SecondaryVariableFieldEvaluator::UpdateField_(S);
+}
+
+
+bool
+LiquidIceEnergyEvaluator::EvaluateFieldOnCells_(const Teuchos::Ptr<State>& S,
+        const AmanziMesh::Entity_ID_List& cells)
+{
+  Teuchos::RCP<CompositeVector> result = S->GetFieldData(my_key_, my_key_);
+  std::vector<AmanziMesh::Entity_ID_List> entities;
+  if (!getCellSubsetEntities(*result, cells, entities)) return false;
+
+Teuchos::RCP<const CompositeVector> phi = S->GetFieldData(phi_key_);
+Teuchos::RCP<const CompositeVector> phi0 = S->GetFieldData(phi0_key_);
+Teuchos::RCP<const CompositeVector> sl = S->GetFieldData(sl_key_);
+Teuchos::RCP<const CompositeVector> nl = S->GetFieldData(nl_key_);
+Teuchos::RCP<const CompositeVector> ul = S->GetFieldData(ul_key_);
+Teuchos::RCP<const CompositeVector> si = S->GetFieldData(si_key_);
+Teuchos::RCP<const CompositeVector> ni = S->GetFieldData(ni_key_);
+Teuchos::RCP<const CompositeVector> ui = S->GetFieldData(ui_key_);
+Teuchos::RCP<const CompositeVector> rho_r = S->GetFieldData(rho_r_key_);
+Teuchos::RCP<const CompositeVector> ur = S->GetFieldData(ur_key_);
+Teuchos::RCP<const CompositeVector> cv = S->GetFieldData(cv_key_);
+
+  int n = 0;
+  for (CompositeVector::name_iterator comp=result->begin();
+       comp!=result->end(); ++comp, ++n) {
+    const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
+    const Epetra_MultiVector& phi0_v = *phi0->ViewComponent(*comp, false);
+    const Epetra_MultiVector& sl_v = *sl->ViewComponent(*comp, false);
+    const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
+    const Epetra_MultiVector& ul_v = *ul->ViewComponent(*comp, false);
+    const Epetra_MultiVector& si_v = *si->ViewComponent(*comp, false);
+    const Epetra_MultiVector& ni_v = *ni->ViewComponent(*comp, false);
+    const Epetra_MultiVector& ui_v = *ui->ViewComponent(*comp, false);
+    const Epetra_MultiVector& rho_r_v = *rho_r->ViewComponent(*comp, false);
+    const Epetra_MultiVector& ur_v = *ur->ViewComponent(*comp, false);
+    const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
+    Epetra_MultiVector& result_v = *result->ViewComponent(*comp,false);
+
+    for (auto i : entities[n]) {
+      result_v[0][i] = model_->Energy(phi_v[0][i], phi0_v[0][i], sl_v[0][i], nl_v[0][i], ul_v[0][i], si_v[0][i], ni_v[0][i], ui_v[0][i], rho_r_v[0][i], ur_v[0][i], cv_v[0][i]);
+    }
+  }
+  return true;
+}
+
+
 void
 LiquidIceEnergyEvaluator::EvaluateFieldPartialDerivative_(const Teuchos::Ptr<State>& S,
         Key wrt_key, const Teuchos::Ptr<CompositeVector>& result)
@@ -47,6 +47,7 @@ Note that this ignores energy in the gas phase.
 
 #include "Factory.hh"
 #include "secondary_variable_field_evaluator.hh"
+#include "cell_subset_evaluator.hh"
 
 namespace Amanzi {
 namespace Energy {
@@ -54,7 +55,8 @@ namespace Relations {
 
 class LiquidIceEnergyModel;
 
-class LiquidIceEnergyEvaluator : public SecondaryVariableFieldEvaluator {
+class LiquidIceEnergyEvaluator : public SecondaryVariableFieldEvaluator,
+                                 public CellSubsetEvaluator {
 
  public:
   explicit
@@ -69,9 +71,17 @@ class LiquidIceEnergyEvaluator : public SecondaryVariableFieldEvaluator {
   virtual void EvaluateFieldPartialDerivative_(const Teuchos::Ptr<State>& S,
           Key wrt_key, const Teuchos::Ptr<CompositeVector>& result);
 
+  // Updates the field on cells only, see CellSubsetEvaluator.
+  virtual CellSubsetChange HasFieldChangedOnCells(const Teuchos::Ptr<State>& S,
+          const Key& request, const AmanziMesh::Entity_ID_List& cells);
+
   Teuchos::RCP<LiquidIceEnergyModel> get_model() { return model_; }
 
  protected:
+  virtual void UpdateField_(const Teuchos::Ptr<State>& S);
+  bool EvaluateFieldOnCells_(const Teuchos::Ptr<State>& S,
+          const AmanziMesh::Entity_ID_List& cells);
+
   void InitializeFromPlist_();
 
   Key phi_key_;
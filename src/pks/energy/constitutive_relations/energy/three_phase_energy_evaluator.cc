@@ -4,6 +4,9 @@ Energy for a three-phase, gas+liquid+ice evaluator.
   Generated via evaluator_generator.
 */
 
+#include <algorithm>
+#include <vector>
+
 #include "three_phase_energy_evaluator.hh"
 #include "three_phase_energy_model.hh"
 
@@ -154,10 +157,177 @@ Teuchos::RCP<const CompositeVector> cv = S->GetFieldData(cv_key_);
     Epetra_MultiVector& result_v = *result->ViewComponent(*comp,false);
 
     int ncomp = result->size(*comp, false);
-    for (int i=0; i!=ncomp; ++i) {
+    model_->EnergyBatch(phi_v[0], phi0_v[0], sl_v[0], nl_v[0], ul_v[0], si_v[0], ni_v[0], ui_v[0], sg_v[0], ng_v[0], ug_v[0], rho_r_v[0], ur_v[0], cv_v[0], result_v[0], ncomp);
+  }
+}
+
+
+CellSubsetChange
+ThreePhaseEnergyEvaluator::HasFieldChangedOnCells(const Teuchos::Ptr<State>& S,
+        const Key& request, const AmanziMesh::Entity_ID_List& cells)
+{
+  return HasFieldChangedOnCells_(S, request, cells, my_key_, dependencies_, requests_,
+          [&]() { return EvaluateFieldOnCells_(S, cells); },
+          [&]() { UpdateField_(S); });
+}
+
+
+void
+ThreePhaseEnergyEvaluator::UpdateField_(const Teuchos::Ptr<State>& S)
+{
+  changed_on_cells_ = false;
+  SecondaryVariableFieldEvaluator::UpdateField_(S);
+}
+
+
+bool
+ThreePhaseEnergyEvaluator::EvaluateFieldOnCells_(const Teuchos::Ptr<State>& S,
+        const AmanziMesh::Entity_ID_List& cells)
+{
+  Teuchos::RCP<CompositeVector> result = S->GetFieldData(my_key_, my_key_);
+  std::vector<AmanziMesh::Entity_ID_List> entities;
+  if (!getCellSubsetEntities(*result, cells, entities)) return false;
+
+Teuchos::RCP<const CompositeVector> phi = S->GetFieldData(phi_key_);
+Teuchos::RCP<const CompositeVector> phi0 = S->GetFieldData(phi0_key_);
+Teuchos::RCP<const CompositeVector> sl = S->GetFieldData(sl_key_);
+Teuchos::RCP<const CompositeVector> nl = S->GetFieldData(nl_key_);
+Teuchos::RCP<const CompositeVector> ul = S->GetFieldData(ul_key_);
+Teuchos::RCP<const CompositeVector> si = S->GetFieldData(si_key_);
+Teuchos::RCP<const CompositeVector> ni = S->GetFieldData(ni_key_);
+Teuchos::RCP<const CompositeVector> ui = S->GetFieldData(ui_key_);
+Teuchos::RCP<const CompositeVector> sg = S->GetFieldData(sg_key_);
+Teuchos::RCP<const CompositeVector> ng = S->GetFieldData(ng_key_);
+Teuchos::RCP<const CompositeVector> ug = S->GetFieldData(ug_key_);
+Teuchos::RCP<const CompositeVector> rho_r = S->GetFieldData(rho_r_key_);
+Teuchos::RCP<const CompositeVector> ur = S->GetFieldData(ur_key_);
+Teuchos::RCP<const CompositeVector> cv = S->GetFieldData(cv_key_);
+
+  int n = 0;
+  for (CompositeVector::name_iterator comp=result->begin();
+       comp!=result->end(); ++comp, ++n) {
+    const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
+    const Epetra_MultiVector& phi0_v = *phi0->ViewComponent(*comp, false);
+    const Epetra_MultiVector& sl_v = *sl->ViewComponent(*comp, false);
+    const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
+    const Epetra_MultiVector& ul_v = *ul->ViewComponent(*comp, false);
+    const Epetra_MultiVector& si_v = *si->ViewComponent(*comp, false);
+    const Epetra_MultiVector& ni_v = *ni->ViewComponent(*comp, false);
+    const Epetra_MultiVector& ui_v = *ui->ViewComponent(*comp, false);
+    const Epetra_MultiVector& sg_v = *sg->ViewComponent(*comp, false);
+    const Epetra_MultiVector& ng_v = *ng->ViewComponent(*comp, false);
+    const Epetra_MultiVector& ug_v = *ug->ViewComponent(*comp, false);
+    const Epetra_MultiVector& rho_r_v = *rho_r->ViewComponent(*comp, false);
+    const Epetra_MultiVector& ur_v = *ur->ViewComponent(*comp, false);
+    const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
+    Epetra_MultiVector& result_v = *result->ViewComponent(*comp,false);
+
+    for (auto i : entities[n]) {
       result_v[0][i] = model_->Energy(phi_v[0][i], phi0_v[0][i], sl_v[0][i], nl_v[0][i], ul_v[0][i], si_v[0][i], ni_v[0][i], ui_v[0][i], sg_v[0][i], ng_v[0][i], ug_v[0][i], rho_r_v[0][i], ur_v[0][i], cv_v[0][i]);
     }
   }
+  return true;
+}
+
+
+/* ******************************************************************
+* Fused chain rule for d(Energy)/d(wrt_key).
+*
+* The default implementation makes one sweep over the entities, and one
+* temporary vector, per dependency that depends upon wrt_key.  Here all
+* partial derivatives of the model are evaluated together, and the chain
+* rule is summed in a second pass, in the same order as the default.
+****************************************************************** */
+void
+ThreePhaseEnergyEvaluator::UpdateFieldDerivative_(const Teuchos::Ptr<State>& S,
+        Key wrt_key)
+{
+  Key dmy_key = Keys::getDerivKey(my_key_, wrt_key);
+
+  Teuchos::RCP<CompositeVector> dmy;
+  if (S->HasField(dmy_key)) {
+    dmy = S->GetFieldData(dmy_key, my_key_);
+  } else {
+    // or create the field.  Note we have to do extra work that is normally
+    // done by State in initialize.
+    Teuchos::RCP<CompositeVectorSpace> my_fac = S->RequireField(my_key_);
+    Teuchos::RCP<CompositeVectorSpace> new_fac = S->RequireField(dmy_key, my_key_);
+    new_fac->Update(*my_fac);
+    dmy = Teuchos::rcp(new CompositeVector(*my_fac));
+    S->SetData(dmy_key, my_key_, dmy);
+    S->GetField(dmy_key, my_key_)->set_initialized();
+    S->GetField(dmy_key, my_key_)->set_io_vis(false);
+    S->GetField(dmy_key, my_key_)->set_io_checkpoint(false);
+  }
+
+  // terms of the chain rule: the index of the partial derivative in model
+  // argument order, and ddep/dwrt_key, or null if dep is wrt_key
+  const std::vector<Key> arg_keys = { phi_key_, phi0_key_, sl_key_, nl_key_, ul_key_, si_key_, ni_key_, ui_key_, sg_key_, ng_key_, ug_key_, rho_r_key_, ur_key_, cv_key_ };
+  std::vector<int> term_index;
+  std::vector<Teuchos::RCP<const CompositeVector> > term_ddep;
+  for (const auto& dep : dependencies_) {
+    int j = std::find(arg_keys.begin(), arg_keys.end(), dep) - arg_keys.begin();
+    AMANZI_ASSERT(j < arg_keys.size());
+    if (dep == wrt_key) {
+      term_index.push_back(j);
+      term_ddep.push_back(Teuchos::null);
+    } else if (S->GetFieldEvaluator(dep)->IsDependency(S, wrt_key)) {
+      term_index.push_back(j);
+      term_ddep.push_back(S->GetFieldData(Keys::getDerivKey(dep, wrt_key)));
+    }
+  }
+  int nterms = term_index.size();
+
+  Teuchos::RCP<const CompositeVector> phi = S->GetFieldData(phi_key_);
+  Teuchos::RCP<const CompositeVector> phi0 = S->GetFieldData(phi0_key_);
+  Teuchos::RCP<const CompositeVector> sl = S->GetFieldData(sl_key_);
+  Teuchos::RCP<const CompositeVector> nl = S->GetFieldData(nl_key_);
+  Teuchos::RCP<const CompositeVector> ul = S->GetFieldData(ul_key_);
+  Teuchos::RCP<const CompositeVector> si = S->GetFieldData(si_key_);
+  Teuchos::RCP<const CompositeVector> ni = S->GetFieldData(ni_key_);
+  Teuchos::RCP<const CompositeVector> ui = S->GetFieldData(ui_key_);
+  Teuchos::RCP<const CompositeVector> sg = S->GetFieldData(sg_key_);
+  Teuchos::RCP<const CompositeVector> ng = S->GetFieldData(ng_key_);
+  Teuchos::RCP<const CompositeVector> ug = S->GetFieldData(ug_key_);
+  Teuchos::RCP<const CompositeVector> rho_r = S->GetFieldData(rho_r_key_);
+  Teuchos::RCP<const CompositeVector> ur = S->GetFieldData(ur_key_);
+  Teuchos::RCP<const CompositeVector> cv = S->GetFieldData(cv_key_);
+
+  std::vector<double> d;
+  for (CompositeVector::name_iterator comp=dmy->begin();
+       comp!=dmy->end(); ++comp) {
+    const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
+    const Epetra_MultiVector& phi0_v = *phi0->ViewComponent(*comp, false);
+    const Epetra_MultiVector& sl_v = *sl->ViewComponent(*comp, false);
+    const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
+    const Epetra_MultiVector& ul_v = *ul->ViewComponent(*comp, false);
+    const Epetra_MultiVector& si_v = *si->ViewComponent(*comp, false);
+    const Epetra_MultiVector& ni_v = *ni->ViewComponent(*comp, false);
+    const Epetra_MultiVector& ui_v = *ui->ViewComponent(*comp, false);
+    const Epetra_MultiVector& sg_v = *sg->ViewComponent(*comp, false);
+    const Epetra_MultiVector& ng_v = *ng->ViewComponent(*comp, false);
+    const Epetra_MultiVector& ug_v = *ug->ViewComponent(*comp, false);
+    const Epetra_MultiVector& rho_r_v = *rho_r->ViewComponent(*comp, false);
+    const Epetra_MultiVector& ur_v = *ur->ViewComponent(*comp, false);
+    const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
+    std::vector<const double*> ddep_v(nterms, nullptr);
+    for (int k=0; k!=nterms; ++k) {
+      if (term_ddep[k] != Teuchos::null) ddep_v[k] = (*term_ddep[k]->ViewComponent(*comp, false))[0];
+    }
+    Epetra_MultiVector& dmy_v = *dmy->ViewComponent(*comp, false);
+
+    int ncomp = dmy->size(*comp, false);
+    d.resize(14 * ncomp);
+    model_->EnergyDerivativesBatch(phi_v[0], phi0_v[0], sl_v[0], nl_v[0], ul_v[0], si_v[0], ni_v[0], ui_v[0], sg_v[0], ng_v[0], ug_v[0], rho_r_v[0], ur_v[0], cv_v[0], d.data(), ncomp);
+    for (int i=0; i!=ncomp; ++i) {
+      double dmy_i = 0.;
+      for (int k=0; k!=nterms; ++k) {
+        const double d_ik = d[term_index[k]*ncomp + i];
+        dmy_i += ddep_v[k] ? d_ik * ddep_v[k][i] : d_ik;
+      }
+      dmy_v[0][i] = dmy_i;
+    }
+  }
 }
 
 
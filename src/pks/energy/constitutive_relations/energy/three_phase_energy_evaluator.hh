@@ -48,6 +48,7 @@ the larger, compressible value when used with the energy in the water.
 
 #include "Factory.hh"
 #include "secondary_variable_field_evaluator.hh"
+#include "cell_subset_evaluator.hh"
 
 namespace Amanzi {
 namespace Energy {
@@ -55,7 +56,8 @@ namespace Relations {
 
 class ThreePhaseEnergyModel;
 
-class ThreePhaseEnergyEvaluator : public SecondaryVariableFieldEvaluator {
+class ThreePhaseEnergyEvaluator : public SecondaryVariableFieldEvaluator,
+                                  public CellSubsetEvaluator {
 
  public:
   explicit
@@ -70,11 +72,22 @@ class ThreePhaseEnergyEvaluator : public SecondaryVariableFieldEvaluator {
   virtual void EvaluateFieldPartialDerivative_(const Teuchos::Ptr<State>& S,
           Key wrt_key, const Teuchos::Ptr<CompositeVector>& result);
 
+  // Updates the field on cells only, see CellSubsetEvaluator.
+  virtual CellSubsetChange HasFieldChangedOnCells(const Teuchos::Ptr<State>& S,
+          const Key& request, const AmanziMesh::Entity_ID_List& cells);
+
   Teuchos::RCP<ThreePhaseEnergyModel> get_model() { return model_; }
 
  protected:
+  virtual void UpdateField_(const Teuchos::Ptr<State>& S);
+  bool EvaluateFieldOnCells_(const Teuchos::Ptr<State>& S,
+          const AmanziMesh::Entity_ID_List& cells);
+
   void InitializeFromPlist_();
 
+  // Assembles the chain rule in a single pass over all partial derivatives.
+  virtual void UpdateFieldDerivative_(const Teuchos::Ptr<State>& S, Key wrt_key);
+
   Key phi_key_;
   Key phi0_key_;
   Key sl_key_;
@@ -34,7 +34,7 @@ ThreePhaseEnergyModel::InitializeFromPlist_(Teuchos::ParameterList& plist)
 double
 ThreePhaseEnergyModel::Energy(double phi, double phi0, double sl, double nl, double ul, double si, double ni, double ui, double sg, double ng, double ug, double rho_r, double ur, double cv) const
 {
-  return cv*(phi*(ng*sg*ug + ni*si*ui + nl*sl*ul) + rho_r*ur*(-phi0 + 1));
+  return cv*(phi*(ng*sg*ug + ni*si*ui + nl*sl*ul) + rho_r*ur*(1 - phi0));
 }
 
 double
@@ -106,22 +106,92 @@ ThreePhaseEnergyModel::DEnergyDInternalEnergyGas(double phi, double phi0, double
 double
 ThreePhaseEnergyModel::DEnergyDDensityRock(double phi, double phi0, double sl, double nl, double ul, double si, double ni, double ui, double sg, double ng, double ug, double rho_r, double ur, double cv) const
 {
-  return cv*ur*(-phi0 + 1);
+  return cv*ur*(1 - phi0);
 }
 
 double
 ThreePhaseEnergyModel::DEnergyDInternalEnergyRock(double phi, double phi0, double sl, double nl, double ul, double si, double ni, double ui, double sg, double ng, double ug, double rho_r, double ur, double cv) const
 {
-  return cv*rho_r*(-phi0 + 1);
+  return cv*rho_r*(1 - phi0);
 }
 
 double
 ThreePhaseEnergyModel::DEnergyDCellVolume(double phi, double phi0, double sl, double nl, double ul, double si, double ni, double ui, double sg, double ng, double ug, double rho_r, double ur, double cv) const
 {
-  return phi*(ng*sg*ug + ni*si*ui + nl*sl*ul) + rho_r*ur*(-phi0 + 1);
+  return phi*(ng*sg*ug + ni*si*ui + nl*sl*ul) + rho_r*ur*(1 - phi0);
+}
+
+void
+ThreePhaseEnergyModel::EnergyDerivatives(double phi, double phi0, double sl, double nl, double ul, double si, double ni, double ui, double sg, double ng, double ug, double rho_r, double ur, double cv, double* d) const
+{
+  double t0 = ng*ug;
+  double t1 = ni*ui;
+  double t2 = nl*ul;
+  double t3 = sg*t0 + si*t1 + sl*t2;
+  double t4 = cv*ur;
+  double t5 = cv*phi;
+  double t6 = sl*t5;
+  double t7 = si*t5;
+  double t8 = sg*t5;
+  double t9 = 1 - phi0;
+  double t10 = rho_r*t9;
+  d[0] = cv*t3;
+  d[1] = -rho_r*t4;
+  d[2] = t2*t5;
+  d[3] = t6*ul;
+  d[4] = nl*t6;
+  d[5] = t1*t5;
+  d[6] = t7*ui;
+  d[7] = ni*t7;
+  d[8] = t0*t5;
+  d[9] = t8*ug;
+  d[10] = ng*t8;
+  d[11] = t4*t9;
+  d[12] = cv*t10;
+  d[13] = phi*t3 + t10*ur;
+}
+
+void
+ThreePhaseEnergyModel::EnergyBatch(const double* phi, const double* phi0, const double* sl, const double* nl, const double* ul, const double* si, const double* ni, const double* ui, const double* sg, const double* ng, const double* ug, const double* rho_r, const double* ur, const double* cv, double* out, int n) const
+{
+  for (int i=0; i!=n; ++i) {
+    out[i] = cv[i]*(phi[i]*(ng[i]*sg[i]*ug[i] + ni[i]*si[i]*ui[i] + nl[i]*sl[i]*ul[i]) + rho_r[i]*ur[i]*(1 - phi0[i]));
+  }
+}
+
+void
+ThreePhaseEnergyModel::EnergyDerivativesBatch(const double* phi, const double* phi0, const double* sl, const double* nl, const double* ul, const double* si, const double* ni, const double* ui, const double* sg, const double* ng, const double* ug, const double* rho_r, const double* ur, const double* cv, double* d, int n) const
+{
+  for (int i=0; i!=n; ++i) {
+    double t0 = ng[i]*ug[i];
+    double t1 = ni[i]*ui[i];
+    double t2 = nl[i]*ul[i];
+    double t3 = sg[i]*t0 + si[i]*t1 + sl[i]*t2;
+    double t4 = cv[i]*ur[i];
+    double t5 = cv[i]*phi[i];
+    double t6 = sl[i]*t5;
+    double t7 = si[i]*t5;
+    double t8 = sg[i]*t5;
+    double t9 = 1 - phi0[i];
+    double t10 = rho_r[i]*t9;
+    d[0*n + i] = cv[i]*t3;
+    d[1*n + i] = -rho_r[i]*t4;
+    d[2*n + i] = t2*t5;
+    d[3*n + i] = t6*ul[i];
+    d[4*n + i] = nl[i]*t6;
+    d[5*n + i] = t1*t5;
+    d[6*n + i] = t7*ui[i];
+    d[7*n + i] = ni[i]*t7;
+    d[8*n + i] = t0*t5;
+    d[9*n + i] = t8*ug[i];
+    d[10*n + i] = ng[i]*t8;
+    d[11*n + i] = t4*t9;
+    d[12*n + i] = cv[i]*t10;
+    d[13*n + i] = phi[i]*t3 + t10*ur[i];
+  }
 }
 
 } //namespace
 } //namespace
 } //namespace
-  
\ No newline at end of file
+  
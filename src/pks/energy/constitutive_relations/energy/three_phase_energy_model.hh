@@ -36,6 +36,14 @@ class ThreePhaseEnergyModel {
   double DEnergyDDensityRock(double phi, double phi0, double sl, double nl, double ul, double si, double ni, double ui, double sg, double ng, double ug, double rho_r, double ur, double cv) const;
   double DEnergyDInternalEnergyRock(double phi, double phi0, double sl, double nl, double ul, double si, double ni, double ui, double sg, double ng, double ug, double rho_r, double ur, double cv) const;
   double DEnergyDCellVolume(double phi, double phi0, double sl, double nl, double ul, double si, double ni, double ui, double sg, double ng, double ug, double rho_r, double ur, double cv) const;
+
+  // All of the above partial derivatives, in argument order, in one call.
+  void EnergyDerivatives(double phi, double phi0, double sl, double nl, double ul, double si, double ni, double ui, double sg, double ng, double ug, double rho_r, double ur, double cv, double* d) const;
+
+  // Batched versions of the above over n points, where each argument is an
+  // array of length n.  Partial derivative k at point i is d[k*n + i].
+  void EnergyBatch(const double* phi, const double* phi0, const double* sl, const double* nl, const double* ul, const double* si, const double* ni, const double* ui, const double* sg, const double* ng, const double* ug, const double* rho_r, const double* ur, const double* cv, double* out, int n) const;
+  void EnergyDerivativesBatch(const double* phi, const double* phi0, const double* sl, const double* nl, const double* ul, const double* si, const double* ni, const double* ui, const double* sg, const double* ng, const double* ug, const double* rho_r, const double* ur, const double* cv, double* d, int n) const;
   
  protected:
   void InitializeFromPlist_(Teuchos::ParameterList& plist);
@@ -50,4 +58,4 @@ class ThreePhaseEnergyModel {
 } //namespace
 } //namespace
 
-#endif
\ No newline at end of file
+#endif
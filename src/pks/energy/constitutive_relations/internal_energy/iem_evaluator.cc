@@ -72,6 +72,42 @@ void IEMEvaluator::EvaluateField_(const Teuchos::Ptr<State>& S,
 }
 
 
+CellSubsetChange IEMEvaluator::HasFieldChangedOnCells(const Teuchos::Ptr<State>& S,
+        const Key& request, const AmanziMesh::Entity_ID_List& cells) {
+  return HasFieldChangedOnCells_(S, request, cells, my_key_, dependencies_, requests_,
+          [&]() { return EvaluateFieldOnCells_(S, cells); },
+          [&]() { UpdateField_(S); });
+}
+
+
+void IEMEvaluator::UpdateField_(const Teuchos::Ptr<State>& S) {
+  changed_on_cells_ = false;
+  SecondaryVariableFieldEvaluator::UpdateField_(S);
+}
+
+
+bool IEMEvaluator::EvaluateFieldOnCells_(const Teuchos::Ptr<State>& S,
+        const AmanziMesh::Entity_ID_List& cells) {
+  Teuchos::RCP<CompositeVector> result = S->GetFieldData(my_key_, my_key_);
+  std::vector<AmanziMesh::Entity_ID_List> entities;
+  if (!getCellSubsetEntities(*result, cells, entities)) return false;
+
+  Teuchos::RCP<const CompositeVector> temp = S->GetFieldData(temp_key_);
+
+  int n = 0;
+  for (CompositeVector::name_iterator comp=result->begin();
+       comp!=result->end(); ++comp, ++n) {
+    const Epetra_MultiVector& temp_v = *temp->ViewComponent(*comp,false);
+    Epetra_MultiVector& result_v = *result->ViewComponent(*comp,false);
+
+    for (auto i : entities[n]) {
+      result_v[0][i] = iem_->InternalEnergy(temp_v[0][i]);
+    }
+  }
+  return true;
+}
+
+
 void IEMEvaluator::EvaluateFieldPartialDerivative_(const Teuchos::Ptr<State>& S,
         Key wrt_key, const Teuchos::Ptr<CompositeVector>& result) {
   AMANZI_ASSERT(wrt_key == temp_key_);
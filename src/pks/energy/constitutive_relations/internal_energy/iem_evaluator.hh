@@ -12,11 +12,13 @@
 #include "Factory.hh"
 #include "iem.hh"
 #include "secondary_variable_field_evaluator.hh"
+#include "cell_subset_evaluator.hh"
 
 namespace Amanzi {
 namespace Energy {
 
-class IEMEvaluator : public SecondaryVariableFieldEvaluator {
+class IEMEvaluator : public SecondaryVariableFieldEvaluator,
+                     public CellSubsetEvaluator {
 
  public:
   // constructor format for all derived classes
@@ -33,9 +35,17 @@ class IEMEvaluator : public SecondaryVariableFieldEvaluator {
   virtual void EvaluateFieldPartialDerivative_(const Teuchos::Ptr<State>& S,
           Key wrt_key, const Teuchos::Ptr<CompositeVector>& results);
 
+  // Updates the field on cells only, see CellSubsetEvaluator.
+  virtual CellSubsetChange HasFieldChangedOnCells(const Teuchos::Ptr<State>& S,
+          const Key& request, const AmanziMesh::Entity_ID_List& cells);
+
   Teuchos::RCP<IEM> get_IEM() { return iem_; }
 
  protected:
+  virtual void UpdateField_(const Teuchos::Ptr<State>& S);
+  bool EvaluateFieldOnCells_(const Teuchos::Ptr<State>& S,
+          const AmanziMesh::Entity_ID_List& cells);
+
   void InitializeFromPlist_();
 
   Key temp_key_;
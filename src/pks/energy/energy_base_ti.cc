@@ -45,12 +45,14 @@ void EnergyBase::FunctionalResidual(double t_old, double t_new, Teuchos::RCP<Tre
                << " t1 = " << t_new << " h = " << h << std::endl;
 
   // dump u_old, u_new
-  db_->WriteCellInfo(true);
-  std::vector<std::string> vnames;
-  vnames.push_back("T_old"); vnames.push_back("T_new");
-  std::vector< Teuchos::Ptr<const CompositeVector> > vecs;
-  vecs.push_back(S_inter_->GetFieldData(key_).ptr()); vecs.push_back(u.ptr());
-  db_->WriteVectors(vnames, vecs, true);
+  if (debugging_) {
+    db_->WriteCellInfo(true);
+    std::vector<std::string> vnames;
+    vnames.push_back("T_old"); vnames.push_back("T_new");
+    std::vector< Teuchos::Ptr<const CompositeVector> > vecs;
+    vecs.push_back(S_inter_->GetFieldData(key_).ptr()); vecs.push_back(u.ptr());
+    db_->WriteVectors(vnames, vecs, true);
+  }
 
   // vnames[0] = "sl"; vnames[1] = "si";
   // vecs[0] = S_next_->GetFieldData("saturation_liquid").ptr();
@@ -63,7 +65,7 @@ void EnergyBase::FunctionalResidual(double t_old, double t_new, Teuchos::RCP<Tre
   bc_diff_flux_->Compute(t_new);
   bc_flux_->Compute(t_new);
   UpdateBoundaryConditions_(S_next_.ptr());
-  db_->WriteBoundaryConditions(bc_markers(), bc_values());
+  if (debugging_) db_->WriteBoundaryConditions(bc_markers(), bc_values());
 
   // zero out residual
   Teuchos::RCP<CompositeVector> res = g->Data();
@@ -72,19 +74,24 @@ void EnergyBase::FunctionalResidual(double t_old, double t_new, Teuchos::RCP<Tre
   // diffusion term, implicit
   ApplyDiffusion_(S_next_.ptr(), res.ptr());
 #if DEBUG_FLAG
-  db_->WriteVector("K",S_next_->GetFieldData(conductivity_key_).ptr(),true);
-  db_->WriteVector("res (diff)", res.ptr(), true);
+  if (debugging_) {
+    db_->WriteVector("K",S_next_->GetFieldData(conductivity_key_).ptr(),true);
+    db_->WriteVector("res (diff)", res.ptr(), true);
+  }
 #endif
 
   // accumulation term
   AddAccumulation_(res.ptr());
 #if DEBUG_FLAG
-  vnames[0] = "e_old";
-  vnames[1] = "e_new";
-  vecs[0] = S_inter_->GetFieldData(conserved_key_).ptr();
-  vecs[1] = S_next_->GetFieldData(conserved_key_).ptr();
-  db_->WriteVectors(vnames, vecs, true);
-  db_->WriteVector("res (acc)", res.ptr());
+  if (debugging_) {
+    std::vector<std::string> vnames;
+    vnames.push_back("e_old"); vnames.push_back("e_new");
+    std::vector< Teuchos::Ptr<const CompositeVector> > vecs;
+    vecs.push_back(S_inter_->GetFieldData(conserved_key_).ptr());
+    vecs.push_back(S_next_->GetFieldData(conserved_key_).ptr());
+    db_->WriteVectors(vnames, vecs, true);
+    db_->WriteVector("res (acc)", res.ptr());
+  }
 #endif
 
   // advection term
@@ -95,14 +102,14 @@ void EnergyBase::FunctionalResidual(double t_old, double t_new, Teuchos::RCP<Tre
       AddAdvection_(S_inter_.ptr(), res.ptr(), true);
     }
 #if DEBUG_FLAG
-  db_->WriteVector("res (adv)", res.ptr(), true);
+  if (debugging_) db_->WriteVector("res (adv)", res.ptr(), true);
 #endif
   }
 
   // source terms
   AddSources_(S_next_.ptr(), res.ptr());
 #if DEBUG_FLAG
-  db_->WriteVector("res (src)", res.ptr());
+  if (debugging_) db_->WriteVector("res (src)", res.ptr());
 #endif
 
   // Dump residual to state for visual debugging.
@@ -130,14 +137,14 @@ int EnergyBase::ApplyPreconditioner(Teuchos::RCP<const TreeVector> u, Teuchos::R
   Teuchos::OSTab tab = vo_->getOSTab();
   if (vo_->os_OK(Teuchos::VERB_HIGH))
     *vo_->os() << "Precon application:" << std::endl;
-  db_->WriteVector("T_res", u->Data().ptr(), true);
+  if (debugging_) db_->WriteVector("T_res", u->Data().ptr(), true);
 #endif
 
   // apply the preconditioner
   int ierr = preconditioner_->ApplyInverse(*u->Data(), *Pu->Data());
 
 #if DEBUG_FLAG
-  db_->WriteVector("PC*T_res", Pu->Data().ptr(), true);
+  if (debugging_) db_->WriteVector("PC*T_res", Pu->Data().ptr(), true);
 #endif
 
   return (ierr > 0) ? 0 : 1;
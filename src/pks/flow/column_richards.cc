@@ -0,0 +1,186 @@
+/* -*-  mode: c++; indent-tabs-mode: nil -*- */
+/*
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+*/
+
+//! Batched backward Euler Richards equation on a group of 1-D columns.
+
+#include <cmath>
+
+#include "column_newton.hh"
+#include "column_richards.hh"
+
+namespace Amanzi {
+namespace Flow {
+
+ColumnRichards::ColumnRichards(Teuchos::ParameterList& plist, const Teuchos::RCP<WRM>& wrm,
+                               int ncols, int ncells) :
+    wrm_(wrm),
+    ncols_(ncols),
+    ncells_(ncells),
+    dt_(0.),
+    J_(ncols, ncells, 1)
+{
+  n_liq_ = plist.get<double>("molar density of liquid [mol m^-3]", 55508.);
+  rho_ = plist.get<double>("mass density of liquid [kg m^-3]", 1000.);
+  visc_ = plist.get<double>("viscosity of liquid [Pa s]", 8.9e-4);
+  gravity_ = plist.get<double>("gravity [m s^-2]", 9.80665);
+  p_atm_ = plist.get<double>("atmospheric pressure [Pa]", 101325.);
+  tol_ = plist.get<double>("nonlinear tolerance [-]", 1.e-10);
+  max_its_ = plist.get<int>("max nonlinear iterations", 20);
+
+  int n = ncols * ncells;
+  wc_coef_.resize(n);
+  scale_.resize(n);
+  cond_.resize(ncols * (ncells-1));
+  gz_.resize(ncols * (ncells-1));
+  q_first_.assign(ncols, 0.);
+  q_last_.assign(ncols, 0.);
+  wc_old_.resize(n);
+  pc_.resize(n);
+  sat_.resize(n);
+  dsat_.resize(n);
+  kr_.resize(n);
+  dkr_.resize(n);
+}
+
+
+void
+ColumnRichards::SetColumns(const double* cell_volume, const double* cell_z,
+                           const double* face_area, const double* face_z,
+                           const double* porosity, const double* permeability)
+{
+  int n = ncols_ * ncells_;
+  for (int j=0; j!=n; ++j) {
+    wc_coef_[j] = n_liq_ * porosity[j] * cell_volume[j];
+    scale_[j] = 1. / (n_liq_ * cell_volume[j]);
+  }
+
+  // two-point transmissibility, harmonic in the permeability
+  int nf = ncols_ * (ncells_-1);
+  for (int f=0; f!=nf; ++f) {
+    int j0 = f, j1 = f + ncols_;
+    double resist = std::abs(cell_z[j0] - face_z[f]) / permeability[j0]
+                  + std::abs(cell_z[j1] - face_z[f]) / permeability[j1];
+    cond_[f] = n_liq_ / visc_ * face_area[f] / resist;
+    gz_[f] = rho_ * gravity_ * (cell_z[j1] - cell_z[j0]);
+  }
+}
+
+
+void
+ColumnRichards::SetBoundaryFluxes(const double* q_first, const double* q_last)
+{
+  q_first_.assign(q_first, q_first + ncols_);
+  q_last_.assign(q_last, q_last + ncols_);
+}
+
+
+void
+ColumnRichards::WaterContent(const double* p, double* wc)
+{
+  UpdateRelations_(p, false);
+  int n = ncols_ * ncells_;
+  for (int j=0; j!=n; ++j) wc[j] = wc_coef_[j] * sat_[j];
+}
+
+
+int
+ColumnRichards::AdvanceStep(double dt, double* p, int& its)
+{
+  dt_ = dt;
+  WaterContent(p, wc_old_.data());
+  return ColumnNewton(*this, J_, p, tol_, max_its_, its);
+}
+
+
+void
+ColumnRichards::Residual(const double* p, double* r)
+{
+  UpdateRelations_(p, true);
+
+  int n = ncols_ * ncells_;
+  for (int j=0; j!=n; ++j) r[j] = wc_coef_[j] * sat_[j] - wc_old_[j];
+
+  // flux from cell k to cell k+1, upwinding kr
+  int nf = ncols_ * (ncells_-1);
+  for (int f=0; f!=nf; ++f) {
+    int j0 = f, j1 = f + ncols_;
+    double dphi = p[j1] - p[j0] + gz_[f];
+    double kr = dphi <= 0. ? kr_[j0] : kr_[j1];
+    double flux = -dt_ * cond_[f] * kr * dphi;
+    r[j0] += flux;
+    r[j1] -= flux;
+  }
+
+  double* r_last = r + (ncells_-1) * ncols_;
+  for (int i=0; i!=ncols_; ++i) {
+    r[i] -= dt_ * q_first_[i];
+    r_last[i] -= dt_ * q_last_[i];
+  }
+
+  for (int j=0; j!=n; ++j) r[j] *= scale_[j];
+}
+
+
+void
+ColumnRichards::Jacobian(const double* p, BatchedBlockTridiagonal& J)
+{
+  UpdateRelations_(p, true);
+  J.PutScalar(0.);
+  double* D = J.D(0,0);
+  double* L = J.L(0,0);
+  double* U = J.U(0,0);
+
+  int n = ncols_ * ncells_;
+  for (int j=0; j!=n; ++j) D[j] = wc_coef_[j] * dsat_[j];
+
+  int nf = ncols_ * (ncells_-1);
+  for (int f=0; f!=nf; ++f) {
+    int j0 = f, j1 = f + ncols_;
+    double dphi = p[j1] - p[j0] + gz_[f];
+    double coef = dt_ * cond_[f];
+
+    // derivatives of the flux from cell k to cell k+1
+    double dflux0, dflux1;
+    if (dphi <= 0.) {
+      dflux0 = coef * (kr_[j0] - dkr_[j0] * dphi);
+      dflux1 = -coef * kr_[j0];
+    } else {
+      dflux0 = coef * kr_[j1];
+      dflux1 = -coef * (kr_[j1] + dkr_[j1] * dphi);
+    }
+    D[j0] += dflux0;
+    U[j0] += dflux1;
+    L[j1] -= dflux0;
+    D[j1] -= dflux1;
+  }
+
+  for (int j=0; j!=n; ++j) {
+    D[j] *= scale_[j];
+    L[j] *= scale_[j];
+    U[j] *= scale_[j];
+  }
+}
+
+
+void
+ColumnRichards::UpdateRelations_(const double* p, bool derivs)
+{
+  int n = ncols_ * ncells_;
+  for (int j=0; j!=n; ++j) pc_[j] = p_atm_ - p[j];
+  wrm_->saturation_batch(n, pc_.data(), sat_.data());
+  if (!derivs) return;
+
+  // derivatives with respect to p = p_atm - pc
+  wrm_->d_saturation_batch(n, pc_.data(), dsat_.data());
+  for (int j=0; j!=n; ++j) dsat_[j] = -dsat_[j];
+  wrm_->k_relative_batch(n, sat_.data(), kr_.data());
+  wrm_->d_k_relative_batch(n, sat_.data(), dkr_.data());
+  for (int j=0; j!=n; ++j) dkr_[j] *= dsat_[j];
+}
+
+} // namespace Flow
+} // namespace Amanzi
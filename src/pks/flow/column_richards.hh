@@ -0,0 +1,116 @@
+/* -*-  mode: c++; indent-tabs-mode: nil -*- */
+/*
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+*/
+
+//! Batched backward Euler Richards equation on a group of 1-D columns.
+
+/*
+  Discretizes Richards equation,
+
+    d(phi n_l s)/dt - div( (kr n_l / mu) K (grad p + rho g z) ) = 0,
+
+  on all columns of a ColumnEnsemble group at once, with two-point fluxes
+  between neighboring cells and upwinded relative permeability, and advances
+  it by one backward Euler step with ColumnNewton().  The Jacobian is
+  assembled directly into a BatchedBlockTridiagonal, and the water retention
+  model is evaluated with its batched methods on whole packed arrays, so a
+  step is a handful of streaming loops over the group instead of one
+  BDF1_TI/Operator solve per column.
+
+  One WRM is shared by all columns.  Porosity, (vertical, absolute)
+  permeability, and the geometry from ColumnEnsemble::GatherGeometry() are
+  per cell, and are held constant over a step.  Liquid density and viscosity
+  are constant.  Boundary conditions are fluxes into the first and last cell
+  of each column, in mol s^-1; a column that is fully saturated under flux
+  conditions is singular and is dropped by ColumnNewton().
+
+  Residuals are the mass balance of each cell over the step, divided by
+  n_l times the cell volume, i.e. a volumetric water content, and converge
+  when their max norm is below the tolerance.
+
+  .. _column-richards-spec:
+  .. admonition:: column-richards-spec
+
+    * `"molar density of liquid [mol m^-3]`" ``[double]`` **55508.**
+    * `"mass density of liquid [kg m^-3]`" ``[double]`` **1000.**
+    * `"viscosity of liquid [Pa s]`" ``[double]`` **8.9e-4**
+    * `"gravity [m s^-2]`" ``[double]`` **9.80665**
+    * `"atmospheric pressure [Pa]`" ``[double]`` **101325.**
+    * `"nonlinear tolerance [-]`" ``[double]`` **1.e-10**
+    * `"max nonlinear iterations`" ``[int]`` **20**
+*/
+
+#pragma once
+
+#include <vector>
+
+#include "Teuchos_ParameterList.hpp"
+#include "Teuchos_RCP.hpp"
+
+#include "column_block_tridiagonal.hh"
+#include "wrm.hh"
+
+namespace Amanzi {
+namespace Flow {
+
+class ColumnRichards {
+ public:
+  ColumnRichards(Teuchos::ParameterList& plist, const Teuchos::RCP<WRM>& wrm,
+                 int ncols, int ncells);
+
+  int num_columns() const { return ncols_; }
+  int num_cells() const { return ncells_; }
+
+  // Geometry, as packed by ColumnEnsemble::GatherGeometry(), and porosity
+  // and permeability, packed as by ColumnEnsemble::Gather().
+  void SetColumns(const double* cell_volume, const double* cell_z,
+                  const double* face_area, const double* face_z,
+                  const double* porosity, const double* permeability);
+
+  // fluxes into the first and last cell of each column [mol s^-1]
+  void SetBoundaryFluxes(const double* q_first, const double* q_last);
+
+  // wc <-- water content of each cell at pressure p [mol]
+  void WaterContent(const double* p, double* wc);
+
+  // Advances the pressure p of all columns by dt.  Returns the number of
+  // columns that did not converge, which are left at their last iterate.
+  int AdvanceStep(double dt, double* p, int& its);
+
+  // model interface of ColumnNewton()
+  void Residual(const double* p, double* r);
+  void Jacobian(const double* p, BatchedBlockTridiagonal& J);
+
+ private:
+  // saturation, and with derivs also its derivative and relative
+  // permeability and its derivative, at p
+  void UpdateRelations_(const double* p, bool derivs);
+
+ private:
+  Teuchos::RCP<WRM> wrm_;
+  int ncols_, ncells_;
+
+  double n_liq_, rho_, visc_, gravity_, p_atm_;
+  double tol_;
+  int max_its_;
+  double dt_;
+
+  // per cell: n_l * phi * V, and 1 / (n_l V)
+  std::vector<double> wc_coef_, scale_;
+
+  // per face between cells k and k+1: n_l / mu times the transmissibility,
+  // and rho g (z_k+1 - z_k)
+  std::vector<double> cond_, gz_;
+
+  std::vector<double> q_first_, q_last_;
+  std::vector<double> wc_old_;
+  std::vector<double> pc_, sat_, dsat_, kr_, dkr_;
+
+  BatchedBlockTridiagonal J_;
+};
+
+} // namespace Flow
+} // namespace Amanzi
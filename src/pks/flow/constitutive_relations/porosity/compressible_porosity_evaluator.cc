@@ -74,6 +74,46 @@ void CompressiblePorosityEvaluator::EvaluateField_(const Teuchos::Ptr<State>& S,
 }
 
 
+CellSubsetChange CompressiblePorosityEvaluator::HasFieldChangedOnCells(const Teuchos::Ptr<State>& S,
+        const Key& request, const AmanziMesh::Entity_ID_List& cells) {
+  return HasFieldChangedOnCells_(S, request, cells, my_key_, dependencies_, requests_,
+          [&]() { return EvaluateFieldOnCells_(S, cells); },
+          [&]() { UpdateField_(S); });
+}
+
+
+void CompressiblePorosityEvaluator::UpdateField_(const Teuchos::Ptr<State>& S) {
+  changed_on_cells_ = false;
+  SecondaryVariableFieldEvaluator::UpdateField_(S);
+}
+
+
+bool CompressiblePorosityEvaluator::EvaluateFieldOnCells_(const Teuchos::Ptr<State>& S,
+        const AmanziMesh::Entity_ID_List& cells) {
+  Teuchos::RCP<CompositeVector> result = S->GetFieldData(my_key_, my_key_);
+  std::vector<AmanziMesh::Entity_ID_List> entities;
+  if (!getCellSubsetEntities(*result, cells, entities)) return false;
+
+  Teuchos::RCP<const CompositeVector> pres = S->GetFieldData(pres_key_);
+  Teuchos::RCP<const CompositeVector> poro = S->GetFieldData(poro_key_);
+  const double& patm = *S->GetScalarData("atmospheric_pressure");
+
+  int n = 0;
+  for (CompositeVector::name_iterator comp=result->begin();
+       comp!=result->end(); ++comp, ++n) {
+    AMANZI_ASSERT(*comp == "cell");
+    const Epetra_MultiVector& pres_v = *(pres->ViewComponent(*comp,false));
+    const Epetra_MultiVector& poro_v = *(poro->ViewComponent(*comp,false));
+    Epetra_MultiVector& result_v = *(result->ViewComponent(*comp,false));
+
+    for (auto id : entities[n]) {
+      result_v[0][id] = models_->second[(*models_->first)[id]]->Porosity(poro_v[0][id], pres_v[0][id], patm);
+    }
+  }
+  return true;
+}
+
+
 void CompressiblePorosityEvaluator::EvaluateFieldPartialDerivative_(
     const Teuchos::Ptr<State>& S,
     Key wrt_key, const Teuchos::Ptr<CompositeVector>& result) {
@@ -15,12 +15,14 @@
 
 #include "Factory.hh"
 #include "secondary_variable_field_evaluator.hh"
+#include "cell_subset_evaluator.hh"
 #include "compressible_porosity_model_partition.hh"
 
 namespace Amanzi {
 namespace Flow {
 
-class CompressiblePorosityEvaluator : public SecondaryVariableFieldEvaluator {
+class CompressiblePorosityEvaluator : public SecondaryVariableFieldEvaluator,
+                                      public CellSubsetEvaluator {
  public:
   explicit
   CompressiblePorosityEvaluator(Teuchos::ParameterList& plist);
@@ -33,9 +35,17 @@ class CompressiblePorosityEvaluator : public SecondaryVariableFieldEvaluator {
   virtual void EvaluateFieldPartialDerivative_(const Teuchos::Ptr<State>& S,
           Key wrt_key, const Teuchos::Ptr<CompositeVector>& result);
 
+  // Updates the field on cells only, see CellSubsetEvaluator.
+  virtual CellSubsetChange HasFieldChangedOnCells(const Teuchos::Ptr<State>& S,
+          const Key& request, const AmanziMesh::Entity_ID_List& cells);
+
   Teuchos::RCP<CompressiblePorosityModelPartition> get_Models() { return models_; }
 
 protected:
+  virtual void UpdateField_(const Teuchos::Ptr<State>& S);
+  bool EvaluateFieldOnCells_(const Teuchos::Ptr<State>& S,
+          const AmanziMesh::Entity_ID_List& cells);
+
   Key poro_key_;
   Key pres_key_;
 
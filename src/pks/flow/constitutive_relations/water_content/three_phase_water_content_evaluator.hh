@@ -36,6 +36,7 @@ Specified with evaluator type: `"three phase water content`"
 
 #include "Factory.hh"
 #include "secondary_variable_field_evaluator.hh"
+#include "cell_subset_evaluator.hh"
 
 namespace Amanzi {
 namespace Flow {
@@ -43,7 +44,8 @@ namespace Relations {
 
 class ThreePhaseWaterContentModel;
 
-class ThreePhaseWaterContentEvaluator : public SecondaryVariableFieldEvaluator {
+class ThreePhaseWaterContentEvaluator : public SecondaryVariableFieldEvaluator,
+                                        public CellSubsetEvaluator {
 
  public:
   explicit
@@ -58,11 +60,22 @@ class ThreePhaseWaterContentEvaluator : public SecondaryVariableFieldEvaluator {
   virtual void EvaluateFieldPartialDerivative_(const Teuchos::Ptr<State>& S,
           Key wrt_key, const Teuchos::Ptr<CompositeVector>& result);
 
+  // Updates the field on cells only, see CellSubsetEvaluator.
+  virtual CellSubsetChange HasFieldChangedOnCells(const Teuchos::Ptr<State>& S,
+          const Key& request, const AmanziMesh::Entity_ID_List& cells);
+
   Teuchos::RCP<ThreePhaseWaterContentModel> get_model() { return model_; }
 
  protected:
+  virtual void UpdateField_(const Teuchos::Ptr<State>& S);
+  bool EvaluateFieldOnCells_(const Teuchos::Ptr<State>& S,
+          const AmanziMesh::Entity_ID_List& cells);
+
   void InitializeFromPlist_();
 
+  // Assembles the chain rule in a single pass over all partial derivatives.
+  virtual void UpdateFieldDerivative_(const Teuchos::Ptr<State>& S, Key wrt_key);
+
   Key phi_key_;
   Key sl_key_;
   Key nl_key_;
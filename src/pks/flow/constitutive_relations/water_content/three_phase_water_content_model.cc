@@ -91,7 +91,53 @@ ThreePhaseWaterContentModel::DWaterContentDCellVolume(double phi, double sl, dou
   return phi*(ng*omega*sg + ni*si + nl*sl);
 }
 
+void
+ThreePhaseWaterContentModel::WaterContentDerivatives(double phi, double sl, double nl, double si, double ni, double sg, double ng, double omega, double cv, double* d) const
+{
+  double t0 = ng*omega;
+  double t1 = ni*si + nl*sl + sg*t0;
+  double t2 = cv*phi;
+  double t3 = sg*t2;
+  d[0] = cv*t1;
+  d[1] = nl*t2;
+  d[2] = sl*t2;
+  d[3] = ni*t2;
+  d[4] = si*t2;
+  d[5] = t0*t2;
+  d[6] = omega*t3;
+  d[7] = ng*t3;
+  d[8] = phi*t1;
+}
+
+void
+ThreePhaseWaterContentModel::WaterContentBatch(const double* phi, const double* sl, const double* nl, const double* si, const double* ni, const double* sg, const double* ng, const double* omega, const double* cv, double* out, int n) const
+{
+  for (int i=0; i!=n; ++i) {
+    out[i] = cv[i]*phi[i]*(ng[i]*omega[i]*sg[i] + ni[i]*si[i] + nl[i]*sl[i]);
+  }
+}
+
+void
+ThreePhaseWaterContentModel::WaterContentDerivativesBatch(const double* phi, const double* sl, const double* nl, const double* si, const double* ni, const double* sg, const double* ng, const double* omega, const double* cv, double* d, int n) const
+{
+  for (int i=0; i!=n; ++i) {
+    double t0 = ng[i]*omega[i];
+    double t1 = ni[i]*si[i] + nl[i]*sl[i] + sg[i]*t0;
+    double t2 = cv[i]*phi[i];
+    double t3 = sg[i]*t2;
+    d[0*n + i] = cv[i]*t1;
+    d[1*n + i] = nl[i]*t2;
+    d[2*n + i] = sl[i]*t2;
+    d[3*n + i] = ni[i]*t2;
+    d[4*n + i] = si[i]*t2;
+    d[5*n + i] = t0*t2;
+    d[6*n + i] = omega[i]*t3;
+    d[7*n + i] = ng[i]*t3;
+    d[8*n + i] = phi[i]*t1;
+  }
+}
+
 } //namespace
 } //namespace
 } //namespace
-  
\ No newline at end of file
+  
@@ -31,6 +31,14 @@ class ThreePhaseWaterContentModel {
   double DWaterContentDMolarDensityGas(double phi, double sl, double nl, double si, double ni, double sg, double ng, double omega, double cv) const;
   double DWaterContentDMolFracGas(double phi, double sl, double nl, double si, double ni, double sg, double ng, double omega, double cv) const;
   double DWaterContentDCellVolume(double phi, double sl, double nl, double si, double ni, double sg, double ng, double omega, double cv) const;
+
+  // All of the above partial derivatives, in argument order, in one call.
+  void WaterContentDerivatives(double phi, double sl, double nl, double si, double ni, double sg, double ng, double omega, double cv, double* d) const;
+
+  // Batched versions of the above over n points, where each argument is an
+  // array of length n.  Partial derivative k at point i is d[k*n + i].
+  void WaterContentBatch(const double* phi, const double* sl, const double* nl, const double* si, const double* ni, const double* sg, const double* ng, const double* omega, const double* cv, double* out, int n) const;
+  void WaterContentDerivativesBatch(const double* phi, const double* sl, const double* nl, const double* si, const double* ni, const double* sg, const double* ng, const double* omega, const double* cv, double* d, int n) const;
   
  protected:
   void InitializeFromPlist_(Teuchos::ParameterList& plist);
@@ -45,4 +53,4 @@ class ThreePhaseWaterContentModel {
 } //namespace
 } //namespace
 
-#endif
\ No newline at end of file
+#endif
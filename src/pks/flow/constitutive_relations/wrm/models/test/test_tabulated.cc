@@ -0,0 +1,147 @@
+/*
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+*/
+
+// Tests of the tabulated WRM curves.
+
+#include <cmath>
+#include <iostream>
+#include "UnitTest++.h"
+
+#include "monotone_cubic_table.hh"
+#include "wrm_van_genuchten.hh"
+#include "wrm_implicit_permafrost_model.hh"
+#include "pc_ice_water.hh"
+
+
+TEST(monotoneCubicTable) {
+  using namespace Amanzi::Flow;
+
+  // a steep, monotone curve, tabulated in log(x)
+  auto f = [](double x) { return 1. / (1. + std::pow(1.e-3 * x, 4.)); };
+  MonotoneCubicTable table;
+  CHECK(table.Fit(f, std::function<double(double)>(), 1., 1.e6, true, 1.e-6, 17, 4097));
+
+  double prev = table(1.);
+  for (double x = 1.; x <= 1.e6; x *= 1.001) {
+    CHECK_CLOSE(f(x), table(x), 1.e-5);
+    double val = table(x);
+    CHECK(val <= prev);
+    CHECK(table.Derivative(x) <= 0.);
+    prev = val;
+  }
+}
+
+
+TEST(monotoneCubicTable2D) {
+  using namespace Amanzi::Flow;
+
+  // monotone in both arguments
+  auto f = [](double x, double y) {
+    return 1. / (1. + std::pow(1.e-3 * x, 2.)) * std::exp(-y*y) + std::tanh(4*y);
+  };
+  MonotoneCubicTable2D table;
+  CHECK(table.Fit(f, 1., 1.e5, true, 0., 1., false, 1.e-5, 17, 1025));
+
+  for (double y = 0.; y <= 1.; y += 0.0137) {
+    for (double x = 1.; x <= 1.e5; x *= 1.37) {
+      CHECK_CLOSE(f(x,y), table(x,y), 1.e-4);
+    }
+  }
+
+  // along grid lines, the table is monotone wherever the data is
+  for (int j=0; j!=17; ++j) {
+    double y = j / 16.;
+    double prev = table(1., y);
+    for (double x = 1.; x <= 1.e5; x *= 1.001) {
+      double val = table(x,y);
+      CHECK(val <= prev + 1.e-14);
+      prev = val;
+    }
+  }
+}
+
+
+TEST(vanGenuchten_tabulated) {
+  using namespace Amanzi::Flow;
+
+  Teuchos::ParameterList plist;
+  plist.set("van Genuchten m [-]", 0.5);
+  plist.set("van Genuchten alpha [Pa^-1]", 1.e-4);
+  plist.set("residual saturation [-]", 0.1);
+  WRMVanGenuchten vG(plist);
+
+  Teuchos::ParameterList plist_tab(plist);
+  plist_tab.set("tabulate", true);
+  plist_tab.set("tabulation tolerance [-]", 1.e-8);
+  WRMVanGenuchten vG_tab(plist_tab);
+
+  // tabulated values are within tolerance, derivatives are close
+  for (double pc = 1.; pc < 1.e8; pc *= 1.7) {
+    CHECK_CLOSE(vG.saturation(pc), vG_tab.saturation(pc), 1.e-8);
+    CHECK_CLOSE(vG.d_saturation(pc), vG_tab.d_saturation(pc),
+                1.e-4 * std::abs(vG.d_saturation(pc)) + 1.e-14);
+  }
+  for (double s = 0.1; s < 1.; s += 0.0137) {
+    CHECK_CLOSE(vG.k_relative(s), vG_tab.k_relative(s), 1.e-8);
+  }
+}
+
+
+TEST(implicitPermafrost_tabulated) {
+  using namespace Amanzi::Flow;
+
+  Teuchos::ParameterList plist;
+  plist.set("van Genuchten m [-]", 0.8);
+  plist.set("van Genuchten alpha [Pa^-1]", 1.5e-4);
+  plist.set("residual saturation [-]", 0.);
+  Teuchos::RCP<WRMVanGenuchten> wrm = Teuchos::rcp(new WRMVanGenuchten(plist));
+
+  Teuchos::ParameterList plist3;
+  PCIceWater pcice(plist3);
+  double rho = 1000.;
+
+  Teuchos::ParameterList plist2;
+  plist2.set("solver algorithm [bisection/toms]", "toms");
+  WRMImplicitPermafrostModel p1(plist2);
+  p1.set_WRM(wrm);
+
+  Teuchos::ParameterList plist2_tab(plist2);
+  plist2_tab.set("tabulate", true);
+  WRMImplicitPermafrostModel p1_tab(plist2_tab);
+  p1_tab.set_WRM(wrm);
+
+  double sats[3], sats_tab[3], sats2[3], sats3[3];
+  for (double T : {273.1, 272.5, 271., 268., 263.}) {
+    double pc_ice = pcice.CapillaryPressure(T, rho);
+    for (double pc_liq = 1.e3; pc_liq < 1.e5; pc_liq *= 1.9) {
+      // tabulated saturations are within (a small multiple of) the tolerance
+      p1.saturations(pc_liq, pc_ice, sats);
+      p1_tab.saturations(pc_liq, pc_ice, sats_tab);
+      CHECK_CLOSE(sats[0], sats_tab[0], 1.e-3);
+      CHECK_CLOSE(sats[1], sats_tab[1], 1.e-3);
+      CHECK_CLOSE(sats[2], sats_tab[2], 1.e-3);
+
+      // derivatives are derivatives of the tabulated saturations
+      double eps = 1.e-5 * pc_liq;
+      p1_tab.saturations(pc_liq+eps, pc_ice, sats2);
+      p1_tab.saturations(pc_liq-eps, pc_ice, sats3);
+      p1_tab.dsaturations_dpc_liq(pc_liq, pc_ice, sats);
+      for (int i=0; i!=3; ++i) {
+        double fd = (sats2[i] - sats3[i]) / (2*eps);
+        CHECK_CLOSE(fd, sats[i], std::abs(fd)/1.e3 + 1.e-10);
+      }
+
+      eps = 1.e-5 * pc_ice;
+      p1_tab.saturations(pc_liq, pc_ice+eps, sats2);
+      p1_tab.saturations(pc_liq, pc_ice-eps, sats3);
+      p1_tab.dsaturations_dpc_ice(pc_liq, pc_ice, sats);
+      for (int i=0; i!=3; ++i) {
+        double fd = (sats2[i] - sats3[i]) / (2*eps);
+        CHECK_CLOSE(fd, sats[i], std::abs(fd)/1.e3 + 1.e-10);
+      }
+    }
+  }
+}
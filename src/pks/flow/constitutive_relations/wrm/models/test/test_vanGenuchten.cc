@@ -59,3 +59,33 @@ TEST(vanGenuchten) {
   CHECK_CLOSE(vG.d_capillaryPressure( vG.saturation(pc) ),
               1.0 / vG.d_saturation(pc), 1.);
 }
+
+
+TEST(vanGenuchten_batch) {
+  using namespace Amanzi::Flow;
+
+  Teuchos::ParameterList plist;
+  plist.set("van Genuchten m [-]", 0.5);
+  plist.set("van Genuchten alpha [Pa^-1]", 1.e-4);
+  plist.set("residual saturation [-]", 0.1);
+  plist.set("smoothing interval width [saturation]", 0.05);
+  plist.set("saturation smoothing interval [Pa]", 100.);
+  WRMVanGenuchten vG(plist);
+
+  // batched evaluation must match the scalar evaluation, including on the
+  // smoothing intervals and at the end points
+  const int n = 101;
+  std::vector<double> pc(n), sat(n), res(n);
+  for (int i=0; i!=n; ++i) pc[i] = -1.e4 + i * 1.e3;
+  for (int i=0; i!=n; ++i) sat[i] = 0.1 + i * 0.9 / (n-1);
+
+  vG.saturation_batch(n, &pc[0], &res[0]);
+  for (int i=0; i!=n; ++i) CHECK_CLOSE(vG.saturation(pc[i]), res[i], 1.e-14);
+  vG.d_saturation_batch(n, &pc[0], &res[0]);
+  for (int i=0; i!=n; ++i) CHECK_CLOSE(vG.d_saturation(pc[i]), res[i], 1.e-14);
+  vG.k_relative_batch(n, &sat[0], &res[0]);
+  for (int i=0; i!=n; ++i) CHECK_CLOSE(vG.k_relative(sat[i]), res[i], 1.e-14);
+  vG.d_k_relative_batch(n, &sat[0], &res[0]);
+  for (int i=0; i!=n; ++i) CHECK_CLOSE(vG.d_k_relative(sat[i]), res[i], 1.e-12);
+}
+
@@ -0,0 +1,318 @@
+/* -*-  mode: c++; indent-tabs-mode: nil -*- */
+/*
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors: Ethan Coon (ecoon@lanl.gov)
+*/
+//! Tabulated, monotone piecewise cubic approximations of constitutive curves.
+
+#include <algorithm>
+
+#include "dbc.hh"
+#include "monotone_cubic_table.hh"
+
+namespace Amanzi {
+namespace Flow {
+
+namespace {
+
+// Slopes estimated from uniformly spaced data.  Interior slopes use
+// fourth-order centered differences where the stencil fits, and are zeroed at
+// local extrema of the data so that the limiter can preserve its shape.
+void
+EstimateSlopes_(const double* y, int stride, int n, double dt, double* m)
+{
+  if (n == 2) {
+    m[0] = m[stride] = (y[stride] - y[0]) / dt;
+    return;
+  }
+
+  for (int k=1; k!=n-1; ++k) {
+    double dl = (y[k*stride] - y[(k-1)*stride]) / dt;
+    double dr = (y[(k+1)*stride] - y[k*stride]) / dt;
+    if (dl * dr <= 0.) {
+      m[k*stride] = 0.;
+    } else if (k > 1 && k < n-2) {
+      m[k*stride] = (8. * (y[(k+1)*stride] - y[(k-1)*stride])
+                     - (y[(k+2)*stride] - y[(k-2)*stride])) / (12. * dt);
+    } else {
+      m[k*stride] = (dl + dr) / 2.;
+    }
+  }
+
+  // one-sided, shape-preserving end point slopes
+  auto endslope = [](double d0, double d1) {
+    double m0 = (3.*d0 - d1) / 2.;
+    if (m0 * d0 <= 0.) return 0.;
+    if (d0 * d1 <= 0. && std::abs(m0) > 3.*std::abs(d0)) return 3.*d0;
+    return m0;
+  };
+  m[0] = endslope((y[stride] - y[0]) / dt, (y[2*stride] - y[stride]) / dt);
+  m[(n-1)*stride] = endslope((y[(n-1)*stride] - y[(n-2)*stride]) / dt,
+                             (y[(n-2)*stride] - y[(n-3)*stride]) / dt);
+}
+
+
+// Fritsch-Carlson limiting of nodal slopes to ensure the interpolant is
+// monotone on every interval on which the data is monotone.
+void
+LimitSlopes_(const double* y, int stride, int n, double dt, double* m)
+{
+  for (int k=0; k!=n-1; ++k) {
+    double delta = (y[(k+1)*stride] - y[k*stride]) / dt;
+    double& ml = m[k*stride];
+    double& mr = m[(k+1)*stride];
+    if (delta == 0.) {
+      ml = 0.;
+      mr = 0.;
+    } else {
+      double alpha = ml / delta;
+      double beta = mr / delta;
+      if (alpha < 0.) { ml = 0.; alpha = 0.; }
+      if (beta < 0.) { mr = 0.; beta = 0.; }
+      double r2 = alpha*alpha + beta*beta;
+      if (r2 > 9.) {
+        double tau = 3. / std::sqrt(r2);
+        ml = tau * alpha * delta;
+        mr = tau * beta * delta;
+      }
+    }
+  }
+}
+
+} // namespace
+
+
+// -----------------------------------------------------------------------------
+// 1D table
+// -----------------------------------------------------------------------------
+bool
+MonotoneCubicTable::Fit(const std::function<double(double)>& f,
+                        const std::function<double(double)>& df,
+                        double x0, double x1, bool log_x,
+                        double tol, int min_points, int max_points)
+{
+  AMANZI_ASSERT(x1 > x0);
+  AMANZI_ASSERT(!log_x || x0 > 0.);
+  AMANZI_ASSERT(min_points > 2);
+
+  log_x_ = log_x;
+  x0_ = x0;
+  x1_ = x1;
+  t0_ = log_x_ ? std::log(x0_) : x0_;
+
+  int n = min_points;
+  while (true) {
+    Setup_(f, df, n);
+
+    // check the error at the quarter points of all intervals
+    double scale = 0.;
+    for (double y : y_) scale = std::max(scale, std::abs(y));
+
+    error_ = 0.;
+    for (int i=0; i!=n-1; ++i) {
+      for (double q : {0.25, 0.5, 0.75}) {
+        double t = t0_ + (i + q) * dt_;
+        double x = log_x_ ? std::exp(t) : t;
+        error_ = std::max(error_, std::abs(f(x) - (*this)(x)));
+      }
+    }
+    if (error_ <= tol * scale) return true;
+
+    n = 2*n - 1;
+    if (n > max_points) return false;
+  }
+}
+
+
+void
+MonotoneCubicTable::Setup_(const std::function<double(double)>& f,
+                           const std::function<double(double)>& df, int n)
+{
+  double t1 = log_x_ ? std::log(x1_) : x1_;
+  dt_ = (t1 - t0_) / (n-1);
+
+  y_.resize(n);
+  m_.resize(n);
+  for (int i=0; i!=n; ++i) {
+    // avoid roundoff taking the end point out of the valid range
+    double x = i == 0 ? x0_ : i == n-1 ? x1_ :
+               (log_x_ ? std::exp(t0_ + i*dt_) : t0_ + i*dt_);
+    y_[i] = f(x);
+    if (df) m_[i] = log_x_ ? df(x) * x : df(x);
+  }
+
+  if (!df) EstimateSlopes_(&y_[0], 1, n, dt_, &m_[0]);
+  LimitSlopes_(&y_[0], 1, n, dt_, &m_[0]);
+}
+
+
+// -----------------------------------------------------------------------------
+// 2D table
+// -----------------------------------------------------------------------------
+bool
+MonotoneCubicTable2D::Fit(const std::function<double(double,double)>& f,
+                          double x0, double x1, bool log_x,
+                          double y0, double y1, bool log_y,
+                          double tol, int min_points, int max_points)
+{
+  AMANZI_ASSERT(x1 > x0 && y1 > y0);
+  AMANZI_ASSERT(!log_x || x0 > 0.);
+  AMANZI_ASSERT(!log_y || y0 > 0.);
+  AMANZI_ASSERT(min_points > 2);
+
+  log_x_ = log_x;
+  log_y_ = log_y;
+  x0_ = x0; x1_ = x1;
+  y0_ = y0; y1_ = y1;
+  tx0_ = log_x_ ? std::log(x0_) : x0_;
+  ty0_ = log_y_ ? std::log(y0_) : y0_;
+
+  int n = min_points;
+  while (true) {
+    Setup_(f, n, n);
+
+    double scale = 0.;
+    for (double v : f_) scale = std::max(scale, std::abs(v));
+
+    // check the error at edge midpoints, cell centers, and the four interior
+    // quarter points of each cell
+    auto check = [&](double tx, double ty) {
+      double x = log_x_ ? std::exp(tx) : tx;
+      double y = log_y_ ? std::exp(ty) : ty;
+      x = std::min(std::max(x, x0_), x1_);
+      y = std::min(std::max(y, y0_), y1_);
+      error_ = std::max(error_, std::abs(f(x,y) - (*this)(x,y)));
+    };
+
+    error_ = 0.;
+    for (int j=0; j!=2*ny_-1; ++j) {
+      for (int i=0; i!=2*nx_-1; ++i) {
+        if (i % 2 == 0 && j % 2 == 0) continue; // a node
+        check(tx0_ + 0.5 * i * dtx_, ty0_ + 0.5 * j * dty_);
+      }
+    }
+    for (int j=0; j!=ny_-1; ++j) {
+      for (int i=0; i!=nx_-1; ++i) {
+        for (double qy : {0.25, 0.75}) {
+          for (double qx : {0.25, 0.75}) {
+            check(tx0_ + (i + qx) * dtx_, ty0_ + (j + qy) * dty_);
+          }
+        }
+      }
+    }
+    if (error_ <= tol * scale) return true;
+
+    n = 2*n - 1;
+    if (n > max_points) return false;
+  }
+}
+
+
+void
+MonotoneCubicTable2D::Setup_(const std::function<double(double,double)>& f,
+                             int nx, int ny)
+{
+  nx_ = nx;
+  ny_ = ny;
+  double tx1 = log_x_ ? std::log(x1_) : x1_;
+  double ty1 = log_y_ ? std::log(y1_) : y1_;
+  dtx_ = (tx1 - tx0_) / (nx_-1);
+  dty_ = (ty1 - ty0_) / (ny_-1);
+
+  f_.resize(nx_*ny_);
+  fx_.resize(nx_*ny_);
+  fy_.resize(nx_*ny_);
+  fxy_.resize(nx_*ny_);
+
+  for (int j=0; j!=ny_; ++j) {
+    double y = j == 0 ? y0_ : j == ny_-1 ? y1_ :
+               (log_y_ ? std::exp(ty0_ + j*dty_) : ty0_ + j*dty_);
+    for (int i=0; i!=nx_; ++i) {
+      double x = i == 0 ? x0_ : i == nx_-1 ? x1_ :
+                 (log_x_ ? std::exp(tx0_ + i*dtx_) : tx0_ + i*dtx_);
+      f_[j*nx_ + i] = f(x,y);
+    }
+  }
+
+  // slopes in x along rows, in y along columns
+  for (int j=0; j!=ny_; ++j) {
+    EstimateSlopes_(&f_[j*nx_], 1, nx_, dtx_, &fx_[j*nx_]);
+    LimitSlopes_(&f_[j*nx_], 1, nx_, dtx_, &fx_[j*nx_]);
+  }
+  for (int i=0; i!=nx_; ++i) {
+    EstimateSlopes_(&f_[i], nx_, ny_, dty_, &fy_[i]);
+    LimitSlopes_(&f_[i], nx_, ny_, dty_, &fy_[i]);
+  }
+
+  // Unlimited cross derivatives can undo the limiting of fx and fy inside a
+  // cell, so the twist is zeroed.
+  std::fill(fxy_.begin(), fxy_.end(), 0.);
+}
+
+
+double
+MonotoneCubicTable2D::operator()(double x, double y) const {
+  return Evaluate_(x, y, 0);
+}
+
+double
+MonotoneCubicTable2D::DerivativeX(double x, double y) const {
+  return Evaluate_(x, y, 1);
+}
+
+double
+MonotoneCubicTable2D::DerivativeY(double x, double y) const {
+  return Evaluate_(x, y, 2);
+}
+
+
+double
+MonotoneCubicTable2D::Evaluate_(double x, double y, int deriv) const
+{
+  double tx = log_x_ ? std::log(x) : x;
+  double ty = log_y_ ? std::log(y) : y;
+  double rx = (tx - tx0_) / dtx_;
+  double ry = (ty - ty0_) / dty_;
+  int i = std::min(std::max((int) std::floor(rx), 0), nx_ - 2);
+  int j = std::min(std::max((int) std::floor(ry), 0), ny_ - 2);
+  double u = rx - i;
+  double v = ry - j;
+
+  // Hermite basis (H: values, G: slopes) and derivatives in each direction
+  double u2 = u*u, u3 = u2*u;
+  double v2 = v*v, v3 = v2*v;
+  double Hu[2], Gu[2], Hv[2], Gv[2];
+  if (deriv == 1) {
+    Hu[0] = (6*u2 - 6*u) / dtx_;      Hu[1] = (-6*u2 + 6*u) / dtx_;
+    Gu[0] = (3*u2 - 4*u + 1) / dtx_;  Gu[1] = (3*u2 - 2*u) / dtx_;
+  } else {
+    Hu[0] = 2*u3 - 3*u2 + 1;          Hu[1] = -2*u3 + 3*u2;
+    Gu[0] = u3 - 2*u2 + u;            Gu[1] = u3 - u2;
+  }
+  if (deriv == 2) {
+    Hv[0] = (6*v2 - 6*v) / dty_;      Hv[1] = (-6*v2 + 6*v) / dty_;
+    Gv[0] = (3*v2 - 4*v + 1) / dty_;  Gv[1] = (3*v2 - 2*v) / dty_;
+  } else {
+    Hv[0] = 2*v3 - 3*v2 + 1;          Hv[1] = -2*v3 + 3*v2;
+    Gv[0] = v3 - 2*v2 + v;            Gv[1] = v3 - v2;
+  }
+
+  double result = 0.;
+  for (int b=0; b!=2; ++b) {
+    for (int a=0; a!=2; ++a) {
+      int k = (j+b)*nx_ + i+a;
+      result += Hu[a]*Hv[b]*f_[k] + dtx_*Gu[a]*Hv[b]*fx_[k]
+          + dty_*Hu[a]*Gv[b]*fy_[k] + dtx_*dty_*Gu[a]*Gv[b]*fxy_[k];
+    }
+  }
+
+  if (deriv == 1 && log_x_) result /= x;
+  if (deriv == 2 && log_y_) result /= y;
+  return result;
+}
+
+} // namespace
+} // namespace
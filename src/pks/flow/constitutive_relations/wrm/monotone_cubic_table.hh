@@ -0,0 +1,144 @@
+/* -*-  mode: c++; indent-tabs-mode: nil -*- */
+/*
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors: Ethan Coon (ecoon@lanl.gov)
+*/
+//! Tabulated, monotone piecewise cubic approximations of constitutive curves.
+
+/*!
+
+These tables replace expensive constitutive functions (transcendental math or
+implicit root-finding) by piecewise cubic Hermite interpolants on a uniform
+grid, optionally uniform in the logarithm of the abscissa.  Nodal slopes are
+either provided by the exact derivative or estimated from the data, and are
+then limited following Fritsch and Carlson so that the interpolant preserves
+monotonicity of the tabulated data.
+
+Tables are fit adaptively: the grid is doubled until the interpolation error,
+checked against the true function at the quarter points of every interval
+(in 2D, at edge midpoints, cell centers, and the four interior quarter points
+of every cell), is below `tol * max |f|`.  The error is not checked
+elsewhere, so this is a sampled, not a guaranteed, bound.  If this cannot be
+achieved within the maximum number of points, fitting fails and the caller
+should not use the table.
+
+In 2D, slopes are limited along each grid line and the cross derivative is
+zero, so the table is monotone along grid lines wherever the data is.  This
+is not sufficient for monotonicity in the interior of a cell, which is not
+guaranteed.
+
+Outside of the tabulated range, the caller is responsible for evaluating the
+original function.
+
+*/
+
+#ifndef AMANZI_FLOWRELATIONS_MONOTONE_CUBIC_TABLE_
+#define AMANZI_FLOWRELATIONS_MONOTONE_CUBIC_TABLE_
+
+#include <cmath>
+#include <functional>
+#include <vector>
+
+namespace Amanzi {
+namespace Flow {
+
+class MonotoneCubicTable {
+ public:
+  MonotoneCubicTable() : log_x_(false), x0_(0.), x1_(0.), t0_(0.), dt_(1.) {}
+
+  // Fit the function f on [x0, x1].  If df is provided, it is used for the
+  // nodal slopes.  Returns true if the tolerance was met.
+  bool Fit(const std::function<double(double)>& f,
+           const std::function<double(double)>& df,
+           double x0, double x1, bool log_x,
+           double tol, int min_points, int max_points);
+
+  bool initialized() const { return y_.size() > 1; }
+  bool InRange(double x) const { return x >= x0_ && x <= x1_; }
+  int size() const { return y_.size(); }
+  double error() const { return error_; }
+
+  double operator()(double x) const {
+    int i; double s;
+    Locate_(x, i, s);
+    double s2 = s*s, s3 = s2*s;
+    return (2*s3 - 3*s2 + 1) * y_[i] + (s3 - 2*s2 + s) * dt_ * m_[i]
+        + (-2*s3 + 3*s2) * y_[i+1] + (s3 - s2) * dt_ * m_[i+1];
+  }
+
+  double Derivative(double x) const {
+    int i; double s;
+    Locate_(x, i, s);
+    double s2 = s*s;
+    double dfdt = ((6*s2 - 6*s) * (y_[i] - y_[i+1])) / dt_
+        + (3*s2 - 4*s + 1) * m_[i] + (3*s2 - 2*s) * m_[i+1];
+    return log_x_ ? dfdt / x : dfdt;
+  }
+
+ private:
+  void Locate_(double x, int& i, double& s) const {
+    double t = log_x_ ? std::log(x) : x;
+    double r = (t - t0_) / dt_;
+    i = std::min(std::max((int) std::floor(r), 0), (int) y_.size() - 2);
+    s = r - i;
+  }
+
+  void Setup_(const std::function<double(double)>& f,
+              const std::function<double(double)>& df, int n);
+
+ private:
+  bool log_x_;
+  double x0_, x1_;  // tabulated range
+  double t0_, dt_;  // uniform grid in the (possibly transformed) coordinate
+  double error_;
+  std::vector<double> y_;  // nodal values
+  std::vector<double> m_;  // nodal slopes, w.r.t. the grid coordinate
+};
+
+
+//
+// A tensor-product bicubic Hermite table of a function of two variables, with
+// nodal slopes estimated from the data and limited in each direction, and
+// zero cross derivatives.  Only monotone along grid lines, see above.
+//
+class MonotoneCubicTable2D {
+ public:
+  MonotoneCubicTable2D() : log_x_(false), log_y_(false) {}
+
+  bool Fit(const std::function<double(double,double)>& f,
+           double x0, double x1, bool log_x,
+           double y0, double y1, bool log_y,
+           double tol, int min_points, int max_points);
+
+  bool initialized() const { return nx_ > 1; }
+  bool InRange(double x, double y) const {
+    return x >= x0_ && x <= x1_ && y >= y0_ && y <= y1_;
+  }
+  double error() const { return error_; }
+
+  double operator()(double x, double y) const;
+  double DerivativeX(double x, double y) const;
+  double DerivativeY(double x, double y) const;
+
+ private:
+  void Setup_(const std::function<double(double,double)>& f, int nx, int ny);
+  double Evaluate_(double x, double y, int deriv) const;
+
+ private:
+  bool log_x_, log_y_;
+  double x0_, x1_, y0_, y1_;
+  double tx0_, dtx_, ty0_, dty_;
+  int nx_ = 0, ny_ = 0;
+  double error_;
+
+  // nodal values and slopes, stored row-major with x varying fastest
+  std::vector<double> f_, fx_, fy_, fxy_;
+};
+
+} // namespace
+} // namespace
+
+#endif
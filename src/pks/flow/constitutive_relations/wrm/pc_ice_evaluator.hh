@@ -11,6 +11,7 @@
 #define AMANZI_RELATIONS_PC_ICE_EVALUATOR_HH_
 
 #include "secondary_variable_field_evaluator.hh"
+#include "cell_subset_evaluator.hh"
 #include "Factory.hh"
 
 namespace Amanzi {
@@ -18,7 +19,8 @@ namespace Flow {
 
 class PCIceWater;
 
-class PCIceEvaluator : public SecondaryVariableFieldEvaluator {
+class PCIceEvaluator : public SecondaryVariableFieldEvaluator,
+                       public CellSubsetEvaluator {
 
  public:
 
@@ -34,9 +36,17 @@ class PCIceEvaluator : public SecondaryVariableFieldEvaluator {
   virtual void EvaluateFieldPartialDerivative_(const Teuchos::Ptr<State>& S,
           Key wrt_key, const Teuchos::Ptr<CompositeVector>& result);
 
+  // Updates the field on cells only, see CellSubsetEvaluator.
+  virtual CellSubsetChange HasFieldChangedOnCells(const Teuchos::Ptr<State>& S,
+          const Key& request, const AmanziMesh::Entity_ID_List& cells);
+
   Teuchos::RCP<PCIceWater> get_PCIceWater() { return model_; }
 
  protected:
+  virtual void UpdateField_(const Teuchos::Ptr<State>& S);
+  bool EvaluateFieldOnCells_(const Teuchos::Ptr<State>& S,
+          const AmanziMesh::Entity_ID_List& cells);
+
   // the actual model
   Teuchos::RCP<PCIceWater> model_;
 
@@ -11,6 +11,7 @@
 #define AMANZI_RELATIONS_PC_LIQUID_EVALUATOR_HH_
 
 #include "secondary_variable_field_evaluator.hh"
+#include "cell_subset_evaluator.hh"
 #include "Factory.hh"
 
 namespace Amanzi {
@@ -18,7 +19,8 @@ namespace Flow {
 
 class PCLiqAtm;
 
-class PCLiquidEvaluator : public SecondaryVariableFieldEvaluator {
+class PCLiquidEvaluator : public SecondaryVariableFieldEvaluator,
+                          public CellSubsetEvaluator {
 
  public:
 
@@ -35,6 +37,10 @@ class PCLiquidEvaluator : public SecondaryVariableFieldEvaluator {
   virtual void EvaluateFieldPartialDerivative_(const Teuchos::Ptr<State>& S,
           Key wrt_key, const Teuchos::Ptr<CompositeVector>& result);
 
+  // Updates the field on cells only, see CellSubsetEvaluator.
+  virtual CellSubsetChange HasFieldChangedOnCells(const Teuchos::Ptr<State>& S,
+          const Key& request, const AmanziMesh::Entity_ID_List& cells);
+
   virtual void EnsureCompatibility(const Teuchos::Ptr<State>& S) {
     S->RequireScalar("atmospheric_pressure");
     SecondaryVariableFieldEvaluator::EnsureCompatibility(S);
@@ -44,6 +50,10 @@ class PCLiquidEvaluator : public SecondaryVariableFieldEvaluator {
   Teuchos::RCP<PCLiqAtm> get_PCLiqAtm() { return model_; }
 
  protected:
+  virtual void UpdateField_(const Teuchos::Ptr<State>& S);
+  bool EvaluateFieldOnCells_(const Teuchos::Ptr<State>& S,
+          const AmanziMesh::Entity_ID_List& cells);
+
   // the actual model
   Teuchos::RCP<PCLiqAtm> model_;
 
@@ -8,6 +8,7 @@
 //! RelPermEvaluator: evaluates relative permeability using water retention models.
 
 #include "rel_perm_evaluator.hh"
+#include "boundary_face_table.hh"
 
 namespace Amanzi {
 namespace Flow {
@@ -160,6 +161,11 @@ void RelPermEvaluator::EvaluateField_(const Teuchos::Ptr<State>& S,
     wrms_->first->Initialize(result->Mesh(), -1);
     wrms_->first->Verify();
   }
+  if (wrm_index_.empty()) {
+    createWRMPartitionIndex(*wrms_,
+            result->Mesh()->num_entities(AmanziMesh::CELL, AmanziMesh::Parallel_type::OWNED),
+            wrm_index_);
+  }
 
   // Evaluate k_rel.
   // -- Evaluate the model to calculate krel on cells.
@@ -168,9 +174,14 @@ void RelPermEvaluator::EvaluateField_(const Teuchos::Ptr<State>& S,
   Epetra_MultiVector& res_c = *result->ViewComponent("cell",false);
 
   int ncells = res_c.MyLength();
+  for (int index=0; index!=wrm_index_.size(); ++index) {
+    for (const auto& range : wrm_index_[index]) {
+      wrms_->second[index]->k_relative_batch(range.second - range.first,
+              &sat_c[0][range.first], &res_c[0][range.first]);
+    }
+  }
   for (unsigned int c=0; c!=ncells; ++c) {
-    int index = (*wrms_->first)[c];
-    res_c[0][c] = std::max(wrms_->second[index]->k_relative(sat_c[0][c]), min_val_);
+    res_c[0][c] = std::max(res_c[0][c], min_val_);
   }
 
   // -- Potentially evaluate the model on boundary faces as well.
@@ -179,37 +190,14 @@ void RelPermEvaluator::EvaluateField_(const Teuchos::Ptr<State>& S,
                                        ->ViewComponent("boundary_face",false);
     Epetra_MultiVector& res_bf = *result->ViewComponent("boundary_face",false);
 
-    Teuchos::RCP<const AmanziMesh::Mesh> mesh = result->Mesh();
-    const Epetra_Map& vandelay_map = mesh->exterior_face_map(false);
-    const Epetra_Map& face_map = mesh->face_map(false);
+    auto bfaces = getBoundaryFaceTable(result->Mesh());
 
     // Evaluate the model to calculate krel.
-    AmanziMesh::Entity_ID_List cells;
     int nbfaces = res_bf.MyLength();
     for (unsigned int bf=0; bf!=nbfaces; ++bf) {
       // given a boundary face, we need the internal cell to choose the right WRM
-      AmanziMesh::Entity_ID f = face_map.LID(vandelay_map.GID(bf));
-      mesh->face_get_cells(f, AmanziMesh::Parallel_type::ALL, &cells);
-      AMANZI_ASSERT(cells.size() == 1);
-
-      int index = (*wrms_->first)[cells[0]];
-      double krel;
-      if (boundary_krel_ == BoundaryRelPerm::HARMONIC_MEAN) {
-        double krelb = std::max(wrms_->second[index]->k_relative(sat_bf[0][bf]),min_val_);
-        double kreli = std::max(wrms_->second[index]->k_relative(sat_c[0][cells[0]]), min_val_);
-        krel = 1.0 / (1.0/krelb + 1.0/kreli);
-      } else if (boundary_krel_ == BoundaryRelPerm::ARITHMETIC_MEAN) {
-        double krelb = std::max(wrms_->second[index]->k_relative(sat_bf[0][bf]),min_val_);
-        double kreli = std::max(wrms_->second[index]->k_relative(sat_c[0][cells[0]]), min_val_);
-        krel = (krelb + kreli)/2.0;
-      } else if (boundary_krel_ == BoundaryRelPerm::INTERIOR_PRESSURE) {
-        krel = wrms_->second[index]->k_relative(sat_c[0][cells[0]]);
-      } else if (boundary_krel_ == BoundaryRelPerm::ONE) {
-        krel = 1.;
-      } else {
-        krel = wrms_->second[index]->k_relative(sat_bf[0][bf]);
-      }
-      res_bf[0][bf] = std::max(krel, min_val_);
+      AmanziMesh::Entity_ID c = bfaces->cell(bf);
+      res_bf[0][bf] = BoundaryRelPerm_((*wrms_->first)[c], sat_bf[0][bf], sat_c[0][c]);
     }
   }
 
@@ -220,15 +208,13 @@ void RelPermEvaluator::EvaluateField_(const Teuchos::Ptr<State>& S,
     Epetra_MultiVector& res_bf = *result->ViewComponent("boundary_face",false);
 
     Teuchos::RCP<const AmanziMesh::Mesh> surf_mesh = S->GetMesh(surf_domain_);
-    Teuchos::RCP<const AmanziMesh::Mesh> mesh = result->Mesh();
-    const Epetra_Map& vandelay_map = mesh->exterior_face_map(false);
-    const Epetra_Map& face_map = mesh->face_map(false);
+    auto bfaces = getBoundaryFaceTable(result->Mesh());
 
     unsigned int nsurf_cells = surf_mesh->num_entities(AmanziMesh::CELL, AmanziMesh::Parallel_type::OWNED);
     for (unsigned int sc=0; sc!=nsurf_cells; ++sc) {
       // need to map from surface quantity on cells to subsurface boundary_face quantity
       AmanziMesh::Entity_ID f = surf_mesh->entity_get_parent(AmanziMesh::CELL, sc);
-      AmanziMesh::Entity_ID bf = vandelay_map.LID(face_map.GID(f));
+      AmanziMesh::Entity_ID bf = bfaces->boundary_face(f);
 
       res_bf[0][bf] = std::max(surf_kr[0][sc], min_val_);
     }
@@ -267,6 +253,102 @@ void RelPermEvaluator::EvaluateField_(const Teuchos::Ptr<State>& S,
 }
 
 
+double RelPermEvaluator::BoundaryRelPerm_(int index, double sat_bf, double sat_c) const {
+  double krel;
+  if (boundary_krel_ == BoundaryRelPerm::HARMONIC_MEAN) {
+    double krelb = std::max(wrms_->second[index]->k_relative(sat_bf),min_val_);
+    double kreli = std::max(wrms_->second[index]->k_relative(sat_c), min_val_);
+    krel = 1.0 / (1.0/krelb + 1.0/kreli);
+  } else if (boundary_krel_ == BoundaryRelPerm::ARITHMETIC_MEAN) {
+    double krelb = std::max(wrms_->second[index]->k_relative(sat_bf),min_val_);
+    double kreli = std::max(wrms_->second[index]->k_relative(sat_c), min_val_);
+    krel = (krelb + kreli)/2.0;
+  } else if (boundary_krel_ == BoundaryRelPerm::INTERIOR_PRESSURE) {
+    krel = wrms_->second[index]->k_relative(sat_c);
+  } else if (boundary_krel_ == BoundaryRelPerm::ONE) {
+    krel = 1.;
+  } else {
+    krel = wrms_->second[index]->k_relative(sat_bf);
+  }
+  return std::max(krel, min_val_);
+}
+
+
+CellSubsetChange RelPermEvaluator::HasFieldChangedOnCells(const Teuchos::Ptr<State>& S,
+        const Key& request, const AmanziMesh::Entity_ID_List& cells) {
+  return HasFieldChangedOnCells_(S, request, cells, my_key_, dependencies_, requests_,
+          [&]() { return EvaluateFieldOnCells_(S, cells); },
+          [&]() { UpdateField_(S); });
+}
+
+
+void RelPermEvaluator::UpdateField_(const Teuchos::Ptr<State>& S) {
+  changed_on_cells_ = false;
+  SecondaryVariableFieldEvaluator::UpdateField_(S);
+}
+
+
+bool RelPermEvaluator::EvaluateFieldOnCells_(const Teuchos::Ptr<State>& S,
+        const AmanziMesh::Entity_ID_List& cells) {
+  // surface rel perm is not local to the subsurface cells
+  if (boundary_krel_ == BoundaryRelPerm::SURF_REL_PERM) return false;
+
+  Teuchos::RCP<CompositeVector> result = S->GetFieldData(my_key_, my_key_);
+  for (CompositeVector::name_iterator comp=result->begin();
+       comp!=result->end(); ++comp) {
+    if (*comp != "cell" && *comp != "boundary_face") return false;
+  }
+
+  // Initialize the MeshPartition
+  if (!wrms_->first->initialized()) {
+    wrms_->first->Initialize(result->Mesh(), -1);
+    wrms_->first->Verify();
+  }
+
+  // scaled as in EvaluateField_
+  double scale = 1./perm_scale_;
+  const Epetra_MultiVector& sat_c = *S->GetFieldData(sat_key_)
+      ->ViewComponent("cell",false);
+  Epetra_MultiVector& res_c = *result->ViewComponent("cell",false);
+  Teuchos::RCP<const CompositeVector> dens, visc;
+  if (is_dens_visc_) {
+    dens = S->GetFieldData(dens_key_);
+    visc = S->GetFieldData(visc_key_);
+  }
+
+  AmanziMesh::Entity_ID_List entities;
+  getCellSubsetEntities(*result->Mesh(), "cell", cells, entities);
+  for (auto c : entities) {
+    int index = (*wrms_->first)[c];
+    double krel = std::max(wrms_->second[index]->k_relative(sat_c[0][c]), min_val_);
+    if (is_dens_visc_) {
+      krel *= (*dens->ViewComponent("cell",false))[0][c]
+          / (*visc->ViewComponent("cell",false))[0][c];
+    }
+    res_c[0][c] = krel * scale;
+  }
+
+  if (result->HasComponent("boundary_face")) {
+    const Epetra_MultiVector& sat_bf = *S->GetFieldData(sat_key_)
+                                       ->ViewComponent("boundary_face",false);
+    Epetra_MultiVector& res_bf = *result->ViewComponent("boundary_face",false);
+
+    auto bfaces = getBoundaryFaceTable(result->Mesh());
+    getCellSubsetEntities(*result->Mesh(), "boundary_face", cells, entities);
+    for (auto bf : entities) {
+      AmanziMesh::Entity_ID c = bfaces->cell(bf);
+      double krel = BoundaryRelPerm_((*wrms_->first)[c], sat_bf[0][bf], sat_c[0][c]);
+      if (is_dens_visc_) {
+        krel *= (*dens->ViewComponent("boundary_face",false))[0][bf]
+            / (*visc->ViewComponent("boundary_face",false))[0][bf];
+      }
+      res_bf[0][bf] = krel * scale;
+    }
+  }
+  return true;
+}
+
+
 void RelPermEvaluator::EvaluateFieldPartialDerivative_(const Teuchos::Ptr<State>& S,
         Key wrt_key, const Teuchos::Ptr<CompositeVector>& result) {
 
@@ -275,6 +357,11 @@ void RelPermEvaluator::EvaluateFieldPartialDerivative_(const Teuchos::Ptr<State>
     wrms_->first->Initialize(result->Mesh(), -1);
     wrms_->first->Verify();
   }
+  if (wrm_index_.empty()) {
+    createWRMPartitionIndex(*wrms_,
+            result->Mesh()->num_entities(AmanziMesh::CELL, AmanziMesh::Parallel_type::OWNED),
+            wrm_index_);
+  }
 
   if (wrt_key == sat_key_) {
     // dkr / dsl = rho/mu * dkr/dpc * dpc/dsl
@@ -286,11 +373,17 @@ void RelPermEvaluator::EvaluateFieldPartialDerivative_(const Teuchos::Ptr<State>
     Epetra_MultiVector& res_c = *result->ViewComponent("cell",false);
 
     int ncells = res_c.MyLength();
+    for (int index=0; index!=wrm_index_.size(); ++index) {
+      for (const auto& range : wrm_index_[index]) {
+        wrms_->second[index]->d_k_relative_batch(range.second - range.first,
+                &sat_c[0][range.first], &res_c[0][range.first]);
+      }
+    }
+#ifdef ENABLE_DBC
     for (unsigned int c=0; c!=ncells; ++c) {
-      int index = (*wrms_->first)[c];
-      res_c[0][c] = wrms_->second[index]->d_k_relative(sat_c[0][c]);
       AMANZI_ASSERT(res_c[0][c] >= 0.);
     }
+#endif
 
     // -- Potentially evaluate the model on boundary faces as well.
     if (result->HasComponent("boundary_face")) {
@@ -346,15 +439,13 @@ void RelPermEvaluator::EvaluateFieldPartialDerivative_(const Teuchos::Ptr<State>
       Epetra_MultiVector& res_bf = *result->ViewComponent("boundary_face",false);
 
       Teuchos::RCP<const AmanziMesh::Mesh> surf_mesh = S->GetMesh(surf_domain_);
-      Teuchos::RCP<const AmanziMesh::Mesh> mesh = result->Mesh();
-      const Epetra_Map& vandelay_map = mesh->exterior_face_map(false);
-      const Epetra_Map& face_map = mesh->face_map(false);
+      auto bfaces = getBoundaryFaceTable(result->Mesh());
 
       unsigned int nsurf_cells = surf_mesh->num_entities(AmanziMesh::CELL, AmanziMesh::Parallel_type::OWNED);
       for (unsigned int sc=0; sc!=nsurf_cells; ++sc) {
         // need to map from surface quantity on cells to subsurface boundary_face quantity
         AmanziMesh::Entity_ID f = surf_mesh->entity_get_parent(AmanziMesh::CELL, sc);
-        AmanziMesh::Entity_ID bf = vandelay_map.LID(face_map.GID(f));
+        AmanziMesh::Entity_ID bf = bfaces->boundary_face(f);
 
         //        res_bf[0][bf] = std::max(surf_kr[0][sc], min_val_);
         res_bf[0][bf] = 0.;
@@ -58,6 +58,7 @@ Some additional parameters are available.
 #include "wrm.hh"
 #include "wrm_partition.hh"
 #include "secondary_variable_field_evaluator.hh"
+#include "cell_subset_evaluator.hh"
 #include "Factory.hh"
 
 namespace Amanzi {
@@ -72,7 +73,8 @@ enum class BoundaryRelPerm {
   SURF_REL_PERM
 };
 
-class RelPermEvaluator : public SecondaryVariableFieldEvaluator {
+class RelPermEvaluator : public SecondaryVariableFieldEvaluator,
+                         public CellSubsetEvaluator {
 
  public:
   // constructor format for all derived classes
@@ -89,6 +91,10 @@ class RelPermEvaluator : public SecondaryVariableFieldEvaluator {
 
   Teuchos::RCP<WRMPartition> get_WRMs() { return wrms_; }
 
+  // Updates the field on cells only, see CellSubsetEvaluator.
+  virtual CellSubsetChange HasFieldChangedOnCells(const Teuchos::Ptr<State>& S,
+          const Key& request, const AmanziMesh::Entity_ID_List& cells);
+
  protected:
 
   // Required methods from SecondaryVariableFieldEvaluator
@@ -98,9 +104,18 @@ class RelPermEvaluator : public SecondaryVariableFieldEvaluator {
           Key wrt_key, const Teuchos::Ptr<CompositeVector>& result);
 
  protected:
+  virtual void UpdateField_(const Teuchos::Ptr<State>& S);
+  bool EvaluateFieldOnCells_(const Teuchos::Ptr<State>& S,
+          const AmanziMesh::Entity_ID_List& cells);
+
+  // k_rel on boundary face with saturation sat_bf, whose interior cell has
+  // WRM index and saturation sat_c, before scaling
+  double BoundaryRelPerm_(int index, double sat_bf, double sat_c) const;
+
   void InitializeFromPlist_();
 
   Teuchos::RCP<WRMPartition> wrms_;
+  WRMPartitionIndex wrm_index_;
   Key sat_key_;
   Key dens_key_;
   Key visc_key_;
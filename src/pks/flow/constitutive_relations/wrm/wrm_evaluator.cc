@@ -9,6 +9,7 @@
 
 #include "wrm_evaluator.hh"
 #include "wrm_factory.hh"
+#include "boundary_face_table.hh"
 
 namespace Amanzi {
 namespace Flow {
@@ -80,15 +81,22 @@ void WRMEvaluator::EvaluateField_(const Teuchos::Ptr<State>& S,
     wrms_->first->Initialize(results[0]->Mesh(), -1);
     wrms_->first->Verify();
   }
+  if (wrm_index_.empty()) {
+    createWRMPartitionIndex(*wrms_,
+            results[0]->Mesh()->num_entities(AmanziMesh::CELL, AmanziMesh::Parallel_type::OWNED),
+            wrm_index_);
+  }
 
   Epetra_MultiVector& sat_c = *results[0]->ViewComponent("cell",false);
   const Epetra_MultiVector& pres_c = *S->GetFieldData(cap_pres_key_)
       ->ViewComponent("cell",false);
 
   // calculate cell values
-  AmanziMesh::Entity_ID ncells = sat_c.MyLength();
-  for (AmanziMesh::Entity_ID c=0; c!=ncells; ++c) {
-    sat_c[0][c] = wrms_->second[(*wrms_->first)[c]]->saturation(pres_c[0][c]);
+  for (int index=0; index!=wrm_index_.size(); ++index) {
+    for (const auto& range : wrm_index_[index]) {
+      wrms_->second[index]->saturation_batch(range.second - range.first,
+              &pres_c[0][range.first], &sat_c[0][range.first]);
+    }
   }
 
   // Potentially do face values as well.
@@ -98,20 +106,13 @@ void WRMEvaluator::EvaluateField_(const Teuchos::Ptr<State>& S,
         ->ViewComponent("boundary_face",false);
 
     // Need to get boundary face's inner cell to specify the WRM.
-    Teuchos::RCP<const AmanziMesh::Mesh> mesh = results[0]->Mesh();
-    const Epetra_Map& vandelay_map = mesh->exterior_face_map(false);
-    const Epetra_Map& face_map = mesh->face_map(false);
-    AmanziMesh::Entity_ID_List cells;
+    auto bfaces = getBoundaryFaceTable(results[0]->Mesh());
 
     // calculate boundary face values
     int nbfaces = sat_bf.MyLength();
     for (int bf=0; bf!=nbfaces; ++bf) {
       // given a boundary face, we need the internal cell to choose the right WRM
-      AmanziMesh::Entity_ID f = face_map.LID(vandelay_map.GID(bf));
-      mesh->face_get_cells(f, AmanziMesh::Parallel_type::ALL, &cells);
-      AMANZI_ASSERT(cells.size() == 1);
-
-      int index = (*wrms_->first)[cells[0]];
+      int index = (*wrms_->first)[bfaces->cell(bf)];
       sat_bf[0][bf] = wrms_->second[index]->saturation(pres_bf[0][bf]);
     }
   }
@@ -145,6 +146,11 @@ void WRMEvaluator::EvaluateFieldPartialDerivative_(const Teuchos::Ptr<State>& S,
     wrms_->first->Initialize(results[0]->Mesh(), -1);
     wrms_->first->Verify();
   }
+  if (wrm_index_.empty()) {
+    createWRMPartitionIndex(*wrms_,
+            results[0]->Mesh()->num_entities(AmanziMesh::CELL, AmanziMesh::Parallel_type::OWNED),
+            wrm_index_);
+  }
 
   AMANZI_ASSERT(wrt_key == cap_pres_key_);
 
@@ -153,9 +159,11 @@ void WRMEvaluator::EvaluateFieldPartialDerivative_(const Teuchos::Ptr<State>& S,
       ->ViewComponent("cell",false);
 
   // calculate cell values
-  AmanziMesh::Entity_ID ncells = sat_c.MyLength();
-  for (AmanziMesh::Entity_ID c=0; c!=ncells; ++c) {
-    sat_c[0][c] = wrms_->second[(*wrms_->first)[c]]->d_saturation(pres_c[0][c]);
+  for (int index=0; index!=wrm_index_.size(); ++index) {
+    for (const auto& range : wrm_index_[index]) {
+      wrms_->second[index]->d_saturation_batch(range.second - range.first,
+              &pres_c[0][range.first], &sat_c[0][range.first]);
+    }
   }
 
   // Potentially do face values as well.
@@ -165,20 +173,13 @@ void WRMEvaluator::EvaluateFieldPartialDerivative_(const Teuchos::Ptr<State>& S,
         ->ViewComponent("boundary_face",false);
 
     // Need to get boundary face's inner cell to specify the WRM.
-    Teuchos::RCP<const AmanziMesh::Mesh> mesh = results[0]->Mesh();
-    const Epetra_Map& vandelay_map = mesh->exterior_face_map(false);
-    const Epetra_Map& face_map = mesh->face_map(false);
-    AmanziMesh::Entity_ID_List cells;
+    auto bfaces = getBoundaryFaceTable(results[0]->Mesh());
 
     // calculate boundary face values
     int nbfaces = sat_bf.MyLength();
     for (int bf=0; bf!=nbfaces; ++bf) {
       // given a boundary face, we need the internal cell to choose the right WRM
-      AmanziMesh::Entity_ID f = face_map.LID(vandelay_map.GID(bf));
-      mesh->face_get_cells(f, AmanziMesh::Parallel_type::ALL, &cells);
-      AMANZI_ASSERT(cells.size() == 1);
-
-      int index = (*wrms_->first)[cells[0]];
+      int index = (*wrms_->first)[bfaces->cell(bf)];
       sat_bf[0][bf] = wrms_->second[index]->d_saturation(pres_bf[0][bf]);
     }
   }
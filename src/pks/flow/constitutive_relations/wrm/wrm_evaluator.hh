@@ -66,6 +66,7 @@ class WRMEvaluator : public SecondaryVariablesFieldEvaluator {
 
  protected:
   Teuchos::RCP<WRMPartition> wrms_;
+  WRMPartitionIndex wrm_index_;
   bool calc_other_sat_;
   Key cap_pres_key_;
 
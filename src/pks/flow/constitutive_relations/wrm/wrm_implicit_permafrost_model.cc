@@ -30,6 +30,7 @@ WRMImplicitPermafrostModel::WRMImplicitPermafrostModel(Teuchos::ParameterList& p
   max_it_ = plist_.get<int>("max iterations", 100);
   deriv_regularization_ = plist_.get<double>("minimum dsi_dpressure magnitude", 1.e-10);
   solver_ = plist_.get<std::string>("solver algorithm [bisection/toms]", "bisection");
+  tabulate_ = plist_.get<bool>("tabulate", false);
 }
 
 // Above freezing calculation methods:
@@ -308,8 +309,29 @@ bool WRMImplicitPermafrostModel::FitSpline_(double pc_ice, double cutoff,
 // -- si calculation, outside of the splined region
 double WRMImplicitPermafrostModel::si_frozen_unsaturated_nospline_(double pc_liq,
         double pc_ice, bool throw_ok) {
+  if (InTable_(pc_liq, pc_ice)) {
+    return std::min(std::max(table_si_(pc_liq, pc_ice), 0.), 1.);
+  }
+  return si_frozen_unsaturated_implicit_(pc_liq, pc_ice, throw_ok);
+}
+
+
+// -- is si (and its derivatives) evaluated from the table?
+bool WRMImplicitPermafrostModel::InTable_(double pc_liq, double pc_ice) {
+  if (!tabulate_) return false;
+
+  // the WRM is not available at construction, so tabulate on first use,
+  // which may be from multiple threads
+  std::call_once(tabulated_, [this]() { Tabulate_(); });
+  return table_si_.InRange(pc_liq, pc_ice);
+}
+
+
+// -- si calculation by solving the implicit equation
+double WRMImplicitPermafrostModel::si_frozen_unsaturated_implicit_(double pc_liq,
+        double pc_ice, bool throw_ok) {
   // solve implicit equation for s_i
-  SatIceFunctor_ func(pc_liq, pc_ice, wrm_);
+  SatIceFunctor_ func(pc_liq, pc_ice, wrm_.get());
   Tol_ tol(eps_);
   boost::uintmax_t max_it(max_it_);
   double left = 0.;
@@ -352,9 +374,46 @@ double WRMImplicitPermafrostModel::si_frozen_unsaturated_nospline_(double pc_liq
 }
 
 
+// -- Fit the table of si, outside of the splined region
+void WRMImplicitPermafrostModel::Tabulate_() {
+  AMANZI_ASSERT(wrm_ != Teuchos::null);
+  double tol = plist_.get<double>("tabulation tolerance [-]", 1.e-4);
+  int max_points = plist_.get<int>("tabulation maximum points", 513);
+
+  Teuchos::Array<double> pc_liq_range(2), pc_ice_range(2);
+  pc_liq_range[0] = 1.e1; pc_liq_range[1] = 1.e5;
+  pc_ice_range[0] = 1.e1; pc_ice_range[1] = 1.e8;
+  pc_liq_range = plist_.get<Teuchos::Array<double> >(
+      "tabulation liquid capillary pressure range [Pa]", pc_liq_range);
+  pc_ice_range = plist_.get<Teuchos::Array<double> >(
+      "tabulation ice capillary pressure range [Pa]", pc_ice_range);
+
+  bool success = table_si_.Fit([this](double pc_liq, double pc_ice) {
+        return si_frozen_unsaturated_implicit_(pc_liq, pc_ice); },
+      pc_liq_range[0], pc_liq_range[1], true,
+      pc_ice_range[0], pc_ice_range[1], true,
+      tol, 17, max_points);
+
+  if (!success) {
+    std::stringstream estream;
+    estream << "WRMImplicitPermafrostModel: ice saturation table did not meet \"tabulation tolerance [-]\" = "
+            << tol << " within \"tabulation maximum points\" (error = " << table_si_.error()
+            << "); loosen the tolerance, narrow the tabulated ranges, or increase the maximum number of points.";
+    Errors::Message emsg(estream.str());
+    Exceptions::amanzi_throw(emsg);
+  }
+}
+
+
 // -- dsi_dpcliq calculation, outside of the splined region
 double WRMImplicitPermafrostModel::dsi_dpc_liq_frozen_unsaturated_nospline_(double pc_liq,
         double pc_ice, double si) {
+  // differentiate the table, so that the derivative is consistent with si
+  if (InTable_(pc_liq, pc_ice)) {
+    double si_tab = table_si_(pc_liq, pc_ice);
+    return (si_tab < 0. || si_tab > 1.) ? 0. : table_si_.DerivativeX(pc_liq, pc_ice);
+  }
+
   // differentiate the implicit functor, solve for dsi_dpcliq
   double sstar =  wrm_->saturation(pc_liq);
   double sstarprime = wrm_->d_saturation(pc_liq);
@@ -373,6 +432,12 @@ double WRMImplicitPermafrostModel::dsi_dpc_liq_frozen_unsaturated_nospline_(doub
 // -- dsi_pcice calculation, outside of the splined region
 double WRMImplicitPermafrostModel::dsi_dpc_ice_frozen_unsaturated_nospline_(double pc_liq,
         double pc_ice, double si) {
+  // differentiate the table, so that the derivative is consistent with si
+  if (InTable_(pc_liq, pc_ice)) {
+    double si_tab = table_si_(pc_liq, pc_ice);
+    return (si_tab < 0. || si_tab > 1.) ? 0. : table_si_.DerivativeY(pc_liq, pc_ice);
+  }
+
   // differentiate the implicit functor, solve for dsi_dpcice
   double sstar =  wrm_->saturation(pc_liq);
   double tmp = (1.0 - si) * sstar;
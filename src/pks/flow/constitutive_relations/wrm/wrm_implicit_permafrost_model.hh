@@ -16,17 +16,35 @@
     * `"max iterations`" ``[int]`` **100** Maximum allowable iterations of the implicit solve.
     * `"solver algorithm [bisection/toms]`" ``[string]`` **bisection** Use bisection or the TOMS algorithm from boost.
 
+    * `"tabulate`" ``[bool]`` **false** If true, the implicit solve for ice
+      saturation is replaced by lookup in a bicubic table, fit once (on first
+      use) by solving the implicit equation at the table nodes.  Derivatives
+      of ice saturation are then derivatives of the table.  Outside of the
+      tabulated range the implicit solve is used.
+    * `"tabulation tolerance [-]`" ``[double]`` **1.e-4** Maximum error in ice
+      saturation of the table.  Note that ice saturation varies sharply with
+      the ice capillary pressure, so tight tolerances require large tables.
+    * `"tabulation maximum points`" ``[int]`` **513** Maximum number of
+      points in each dimension; it is an error if the tolerance is not met.
+    * `"tabulation liquid capillary pressure range [Pa]`" ``[Array(double)]``
+      **{1.e1, 1.e5}** Range of gas-liquid capillary pressure tabulated.
+    * `"tabulation ice capillary pressure range [Pa]`" ``[Array(double)]``
+      **{1.e1, 1.e8}** Range of liquid-ice capillary pressure tabulated.
+
 */
 
 #ifndef AMANZI_FLOWRELATIONS_WRM_IMPLICIT_PERMAFROST_MODEL_
 #define AMANZI_FLOWRELATIONS_WRM_IMPLICIT_PERMAFROST_MODEL_
 
+#include <mutex>
+
 #include "boost/cstdint.hpp"
 #include "boost/math/tools/roots.hpp"
 #include "boost/cstdint.hpp"
 
 #include "wrm_permafrost_model.hh"
 #include "wrm_permafrost_factory.hh"
+#include "monotone_cubic_table.hh"
 
 namespace Amanzi {
 namespace Flow {
@@ -69,6 +87,7 @@ class WRMImplicitPermafrostModel : public WRMPermafrostModel {
   double dsi_dpc_ice_frozen_unsaturated_(double pc_liq, double pc_ice, double si);
 
   double si_frozen_unsaturated_nospline_(double pc_liq, double pc_ice, bool throw_ok=false);
+  double si_frozen_unsaturated_implicit_(double pc_liq, double pc_ice, bool throw_ok=false);
   double dsi_dpc_liq_frozen_unsaturated_nospline_(double pc_liq, double pc_ice,
           double si);
   double dsi_dpc_ice_frozen_unsaturated_nospline_(double pc_liq, double pc_ice,
@@ -76,6 +95,8 @@ class WRMImplicitPermafrostModel : public WRMPermafrostModel {
 
   bool DetermineSplineCutoff_(double pc_liq, double pc_ice, double& cutoff, double& si);
   bool FitSpline_(double pc_ice, double cutoff, double si_cutoff, double (&coefs)[4]);
+  bool InTable_(double pc_liq, double pc_ice);
+  void Tabulate_();
 
 
  protected:
@@ -84,12 +105,15 @@ class WRMImplicitPermafrostModel : public WRMPermafrostModel {
   double deriv_regularization_;
   std::string solver_;
 
+  bool tabulate_;
+  std::once_flag tabulated_;
+  MonotoneCubicTable2D table_si_;
+
  private:
   // Functor for ice saturation, gets used within a root-finding algorithm
   class SatIceFunctor_ {
    public:
-    SatIceFunctor_(double pc_liq, double pc_ice,
-                   const Teuchos::RCP<WRM>& wrm) :
+    SatIceFunctor_(double pc_liq, double pc_ice, WRM* wrm) :
         pc_liq_(pc_liq), pc_ice_(pc_ice), wrm_(wrm) {}
 
     double operator()(double si) {
@@ -101,7 +125,7 @@ class WRMImplicitPermafrostModel : public WRMPermafrostModel {
    private:
     double pc_liq_;
     double pc_ice_;
-    Teuchos::RCP<WRM> wrm_;
+    WRM* wrm_;
   };
 
   // Convergence criteria for root-finding
@@ -57,5 +57,23 @@ createWRMPermafrostModelPartition(Teuchos::ParameterList& plist,
   return Teuchos::rcp(new WRMPermafrostModelPartition(wrms->first, pm_list));
 }
 
+
+// Non-member factory for the region-sorted index
+void
+createWRMPartitionIndex(const WRMPartition& wrms, int n_entities,
+                        WRMPartitionIndex& index) {
+  AMANZI_ASSERT(wrms.first->initialized());
+  index.clear();
+  index.resize(wrms.second.size());
+
+  int c = 0;
+  while (c < n_entities) {
+    int region = (*wrms.first)[c];
+    int begin = c;
+    while (c < n_entities && (*wrms.first)[c] == region) ++c;
+    if (region >= 0) index[region].push_back(std::make_pair(begin, c));
+  }
+}
+
 } // namespace
 } // namespace
@@ -35,6 +35,12 @@ namespace Flow {
 typedef std::vector<Teuchos::RCP<WRM> > WRMList;
 typedef std::pair<Teuchos::RCP<Functions::MeshPartition>, WRMList> WRMPartition;
 
+// A region-sorted index of a WRMPartition: for each WRM in the list, the
+// half-open ranges [begin,end) of contiguous entity LIDs on which it is used.
+// This allows batched WRM calls directly on contiguous spans of vectors.
+typedef std::vector<std::pair<int,int> > EntityRangeList;
+typedef std::vector<EntityRangeList> WRMPartitionIndex;
+
 typedef std::vector<Teuchos::RCP<WRMPermafrostModel> > WRMPermafrostModelList;
 typedef std::pair<Teuchos::RCP<Functions::MeshPartition>, WRMPermafrostModelList> WRMPermafrostModelPartition;
 
@@ -46,6 +52,12 @@ Teuchos::RCP<WRMPermafrostModelPartition>
 createWRMPermafrostModelPartition(Teuchos::ParameterList& plist,
         Teuchos::RCP<WRMPartition>& wrms);
 
+// Non-member factory for the region-sorted index.  The partition must
+// already be initialized.
+void
+createWRMPartitionIndex(const WRMPartition& wrms, int n_entities,
+                        WRMPartitionIndex& index);
+
 } // namespace
 } // namespace
 
@@ -9,6 +9,7 @@
 
 #include "wrm_permafrost_evaluator.hh"
 #include "wrm_partition.hh"
+#include "boundary_face_table.hh"
 
 namespace Amanzi {
 namespace Flow {
@@ -188,20 +189,87 @@ void WRMPermafrostEvaluator::EvaluateField_(const Teuchos::Ptr<State>& S,
         ->ViewComponent("boundary_face",false);
 
     // Need to get boundary face's inner cell to specify the WRM.
-    Teuchos::RCP<const AmanziMesh::Mesh> mesh = results[0]->Mesh();
-    const Epetra_Map& vandelay_map = mesh->exterior_face_map(false);
-    const Epetra_Map& face_map = mesh->face_map(false);
-    AmanziMesh::Entity_ID_List cells;
+    auto bfaces = getBoundaryFaceTable(results[0]->Mesh());
 
     // calculate boundary face values
     int nbfaces = satg_bf.MyLength();
     for (int bf=0; bf!=nbfaces; ++bf) {
       // given a boundary face, we need the internal cell to choose the right WRM
-      AmanziMesh::Entity_ID f = face_map.LID(vandelay_map.GID(bf));
-      mesh->face_get_cells(f, AmanziMesh::Parallel_type::ALL, &cells);
-      AMANZI_ASSERT(cells.size() == 1);
+      int i = (*permafrost_models_->first)[bfaces->cell(bf)];
+      permafrost_models_->second[i]
+          ->saturations(pc_liq_bf[0][bf], pc_ice_bf[0][bf], sats);
+      satg_bf[0][bf] = sats[0];
+      satl_bf[0][bf] = sats[1];
+      sati_bf[0][bf] = sats[2];
+    }
+  }
+}
+
+
+CellSubsetChange WRMPermafrostEvaluator::HasFieldChangedOnCells(const Teuchos::Ptr<State>& S,
+        const Key& request, const AmanziMesh::Entity_ID_List& cells) {
+  return HasFieldChangedOnCells_(S, request, cells, my_keys_[0], dependencies_, requests_,
+          [&]() { return EvaluateFieldOnCells_(S, cells); },
+          [&]() { UpdateField_(S); });
+}
+
+
+void WRMPermafrostEvaluator::UpdateField_(const Teuchos::Ptr<State>& S) {
+  changed_on_cells_ = false;
+  SecondaryVariablesFieldEvaluator::UpdateField_(S);
+}
+
+
+bool WRMPermafrostEvaluator::EvaluateFieldOnCells_(const Teuchos::Ptr<State>& S,
+        const AmanziMesh::Entity_ID_List& cells) {
+  std::vector<Teuchos::RCP<CompositeVector> > results;
+  for (const auto& key : my_keys_) results.push_back(S->GetFieldData(key, key));
+  for (CompositeVector::name_iterator comp=results[0]->begin();
+       comp!=results[0]->end(); ++comp) {
+    if (*comp != "cell" && *comp != "boundary_face") return false;
+  }
+
+  // Initialize the MeshPartition
+  if (!permafrost_models_->first->initialized()) {
+    permafrost_models_->first->Initialize(results[0]->Mesh(), -1);
+    permafrost_models_->first->Verify();
+  }
+
+  // Cell values
+  Epetra_MultiVector& satg_c = *results[0]->ViewComponent("cell",false);
+  Epetra_MultiVector& satl_c = *results[1]->ViewComponent("cell",false);
+  Epetra_MultiVector& sati_c = *results[2]->ViewComponent("cell",false);
+
+  const Epetra_MultiVector& pc_liq_c = *S->GetFieldData(pc_liq_key_)
+      ->ViewComponent("cell",false);
+  const Epetra_MultiVector& pc_ice_c = *S->GetFieldData(pc_ice_key_)
+      ->ViewComponent("cell",false);
+
+  double sats[3];
+  AmanziMesh::Entity_ID_List entities;
+  getCellSubsetEntities(*results[0]->Mesh(), "cell", cells, entities);
+  for (auto c : entities) {
+    int i = (*permafrost_models_->first)[c];
+    permafrost_models_->second[i]->saturations(pc_liq_c[0][c], pc_ice_c[0][c], sats);
+    satg_c[0][c] = sats[0];
+    satl_c[0][c] = sats[1];
+    sati_c[0][c] = sats[2];
+  }
 
-      int i = (*permafrost_models_->first)[cells[0]];
+  // Boundary faces of those cells
+  if (results[0]->HasComponent("boundary_face")) {
+    Epetra_MultiVector& satg_bf = *results[0]->ViewComponent("boundary_face",false);
+    Epetra_MultiVector& satl_bf = *results[1]->ViewComponent("boundary_face",false);
+    Epetra_MultiVector& sati_bf = *results[2]->ViewComponent("boundary_face",false);
+    const Epetra_MultiVector& pc_liq_bf = *S->GetFieldData(pc_liq_key_)
+        ->ViewComponent("boundary_face",false);
+    const Epetra_MultiVector& pc_ice_bf = *S->GetFieldData(pc_ice_key_)
+        ->ViewComponent("boundary_face",false);
+
+    auto bfaces = getBoundaryFaceTable(results[0]->Mesh());
+    getCellSubsetEntities(*results[0]->Mesh(), "boundary_face", cells, entities);
+    for (auto bf : entities) {
+      int i = (*permafrost_models_->first)[bfaces->cell(bf)];
       permafrost_models_->second[i]
           ->saturations(pc_liq_bf[0][bf], pc_ice_bf[0][bf], sats);
       satg_bf[0][bf] = sats[0];
@@ -209,6 +277,7 @@ void WRMPermafrostEvaluator::EvaluateField_(const Teuchos::Ptr<State>& S,
       sati_bf[0][bf] = sats[2];
     }
   }
+  return true;
 }
 
 
@@ -270,21 +339,14 @@ WRMPermafrostEvaluator::EvaluateFieldPartialDerivative_(const Teuchos::Ptr<State
         ->ViewComponent("boundary_face",false);
 
     // Need to get boundary face's inner cell to specify the WRM.
-    Teuchos::RCP<const AmanziMesh::Mesh> mesh = results[0]->Mesh();
-    const Epetra_Map& face_map = mesh->face_map(false);
-    const Epetra_Map& vandelay_map = mesh->exterior_face_map(false);
-    AmanziMesh::Entity_ID_List cells;
+    auto bfaces = getBoundaryFaceTable(results[0]->Mesh());
 
     if (wrt_key == pc_liq_key_) {
       // calculate boundary face values
       int nbfaces = satl_bf.MyLength();
       for (int bf=0; bf!=nbfaces; ++bf) {
         // given a boundary face, we need the internal cell to choose the right WRM
-        AmanziMesh::Entity_ID f = face_map.LID(vandelay_map.GID(bf));
-        mesh->face_get_cells(f, AmanziMesh::Parallel_type::ALL, &cells);
-        AMANZI_ASSERT(cells.size() == 1);
-
-        int i = (*permafrost_models_->first)[cells[0]];
+        int i = (*permafrost_models_->first)[bfaces->cell(bf)];
         permafrost_models_->second[i]->dsaturations_dpc_liq(
             pc_liq_bf[0][bf], pc_ice_bf[0][bf], dsats);
         satg_bf[0][bf] = dsats[0];
@@ -297,11 +359,7 @@ WRMPermafrostEvaluator::EvaluateFieldPartialDerivative_(const Teuchos::Ptr<State
       int nbfaces = satl_bf.MyLength();
       for (int bf=0; bf!=nbfaces; ++bf) {
         // given a boundary face, we need the internal cell to choose the right WRM
-        AmanziMesh::Entity_ID f = face_map.LID(vandelay_map.GID(bf));
-        mesh->face_get_cells(f, AmanziMesh::Parallel_type::ALL, &cells);
-        AMANZI_ASSERT(cells.size() == 1);
-
-        int i = (*permafrost_models_->first)[cells[0]];
+        int i = (*permafrost_models_->first)[bfaces->cell(bf)];
         permafrost_models_->second[i]->dsaturations_dpc_ice(
             pc_liq_bf[0][bf], pc_ice_bf[0][bf], dsats);
         satg_bf[0][bf] = dsats[0];
@@ -13,12 +13,14 @@
 #include "wrm_partition.hh"
 #include "wrm_permafrost_model.hh"
 #include "secondary_variables_field_evaluator.hh"
+#include "cell_subset_evaluator.hh"
 #include "Factory.hh"
 
 namespace Amanzi {
 namespace Flow {
 
-class WRMPermafrostEvaluator : public SecondaryVariablesFieldEvaluator {
+class WRMPermafrostEvaluator : public SecondaryVariablesFieldEvaluator,
+                               public CellSubsetEvaluator {
  public:
 
   explicit
@@ -34,6 +36,10 @@ class WRMPermafrostEvaluator : public SecondaryVariablesFieldEvaluator {
   Teuchos::RCP<WRMPartition> get_WRMs() { return wrms_; }
   Teuchos::RCP<WRMPermafrostModelPartition> get_WRMPermafrostModels() { return permafrost_models_; }
 
+  // Updates the field on cells only, see CellSubsetEvaluator.
+  virtual CellSubsetChange HasFieldChangedOnCells(const Teuchos::Ptr<State>& S,
+          const Key& request, const AmanziMesh::Entity_ID_List& cells);
+
  protected:
   // Required methods from SecondaryVariableFieldEvaluator
   virtual void EvaluateField_(const Teuchos::Ptr<State>& S,
@@ -41,6 +47,10 @@ class WRMPermafrostEvaluator : public SecondaryVariablesFieldEvaluator {
   virtual void EvaluateFieldPartialDerivative_(const Teuchos::Ptr<State>& S,
           Key wrt_key, const std::vector<Teuchos::Ptr<CompositeVector> > & results);
 
+  virtual void UpdateField_(const Teuchos::Ptr<State>& S);
+  bool EvaluateFieldOnCells_(const Teuchos::Ptr<State>& S,
+          const AmanziMesh::Entity_ID_List& cells);
+
   void InitializeFromPlist_();
 
  protected:
@@ -21,7 +21,8 @@ const double FLOW_WRM_TOLERANCE = 1e-10;
  * Setup fundamental parameters for this model.
  ****************************************************************** */
 WRMVanGenuchten::WRMVanGenuchten(Teuchos::ParameterList& plist) :
-    plist_(plist) {
+    plist_(plist),
+    tabulated_(false) {
   InitializeFromPlist_();
 };
 
@@ -32,7 +33,9 @@ WRMVanGenuchten::WRMVanGenuchten(Teuchos::ParameterList& plist) :
 * Hermite interpolant of order 3. Formulas (3.11)-(3.12).
 ****************************************************************** */
 double WRMVanGenuchten::k_relative(double s) {
-  if (s <= s0_) {
+  if (tabulated_ && table_kr_.InRange(s)) {
+    return table_kr_(s);
+  } else if (s <= s0_) {
     double se = (s - sr_)/(1-sr_);
     if (function_ == FLOW_WRM_MUALEM) {
       return pow(se, l_) * pow(1.0 - pow(1.0 - pow(se, 1.0/m_), m_), 2.0);
@@ -51,7 +54,9 @@ double WRMVanGenuchten::k_relative(double s) {
  * D Relative permeability / D capillary pressure pc.
  ****************************************************************** */
 double WRMVanGenuchten::d_k_relative(double s) {
-  if (s <= s0_) {
+  if (tabulated_ && table_kr_.InRange(s)) {
+    return table_kr_.Derivative(s);
+  } else if (s <= s0_) {
     double se = (s - sr_)/(1-sr_);
 
     double x = pow(se, 1.0 / m_);
@@ -79,7 +84,9 @@ double WRMVanGenuchten::d_k_relative(double s) {
  * Saturation formula (3.5)-(3.6).
  ****************************************************************** */
 double WRMVanGenuchten::saturation(double pc) {
-  if (pc > pc0_) {
+  if (tabulated_ && table_s_.InRange(pc)) {
+    return table_s_(pc);
+  } else if (pc > pc0_) {
     return std::pow(1.0 + std::pow(alpha_*pc, n_), -m_) * (1.0 - sr_) + sr_;
   } else if (pc <= 0.) {
     return 1.0;
@@ -93,7 +100,9 @@ double WRMVanGenuchten::saturation(double pc) {
  * Derivative of the saturation formula w.r.t. capillary pressure.
  ****************************************************************** */
 double WRMVanGenuchten::d_saturation(double pc) {
-  if (pc > pc0_) {
+  if (tabulated_ && table_s_.InRange(pc)) {
+    return table_s_.Derivative(pc);
+  } else if (pc > pc0_) {
     return -m_*n_ * std::pow(1.0 + std::pow(alpha_*pc, n_), -m_-1.0) * std::pow(alpha_*pc, n_-1) * alpha_ * (1.0 - sr_);
   } else if (pc <= 0.) {
     return 0.0;
@@ -133,6 +142,121 @@ double WRMVanGenuchten::d_capillaryPressure(double s) {
 }
 
 
+/* ******************************************************************
+* Batched relative permeability.  The van Genuchten branch is evaluated
+* for all values in a branch-free loop, and values in the smoothing
+* interval are patched afterward, so the main loop vectorizes.
+****************************************************************** */
+void WRMVanGenuchten::k_relative_batch(int n, const double* s, double* kr) {
+  if (tabulated_) {
+    for (int i=0; i!=n; ++i) kr[i] = WRMVanGenuchten::k_relative(s[i]);
+    return;
+  }
+
+  const double one_on_m = 1.0 / m_;
+  const double one_on_dsr = 1.0 / (1.0 - sr_);
+  if (function_ == FLOW_WRM_MUALEM) {
+    for (int i=0; i!=n; ++i) {
+      double se = (s[i] - sr_) * one_on_dsr;
+      double y = 1.0 - std::pow(1.0 - std::pow(se, one_on_m), m_);
+      kr[i] = std::pow(se, l_) * y * y;
+    }
+  } else {
+    for (int i=0; i!=n; ++i) {
+      double se = (s[i] - sr_) * one_on_dsr;
+      kr[i] = se * se * (1.0 - std::pow(1.0 - std::pow(se, one_on_m), m_));
+    }
+  }
+
+  for (int i=0; i!=n; ++i) {
+    if (s[i] > s0_) kr[i] = s[i] == 1.0 ? 1.0 : fit_kr_(s[i]);
+  }
+}
+
+
+/* ******************************************************************
+* Batched derivative of relative permeability w.r.t. saturation.
+****************************************************************** */
+void WRMVanGenuchten::d_k_relative_batch(int n, const double* s, double* dkr) {
+  if (tabulated_) {
+    for (int i=0; i!=n; ++i) dkr[i] = WRMVanGenuchten::d_k_relative(s[i]);
+    return;
+  }
+
+  const double one_on_m = 1.0 / m_;
+  const double one_on_dsr = 1.0 / (1.0 - sr_);
+  if (function_ == FLOW_WRM_MUALEM) {
+    for (int i=0; i!=n; ++i) {
+      double se = (s[i] - sr_) * one_on_dsr;
+      double x = std::pow(se, one_on_m);
+      double y = std::pow(1.0 - x, m_);
+      double dkdse = (1.0 - y) * (l_ * (1.0 - y) + 2 * x * y / (1.0 - x)) * std::pow(se, l_ - 1.0);
+      bool degenerate = (fabs(1.0 - x) < FLOW_WRM_TOLERANCE) || (fabs(x) < FLOW_WRM_TOLERANCE);
+      dkr[i] = degenerate ? 0.0 : dkdse * one_on_dsr;
+    }
+  } else {
+    for (int i=0; i!=n; ++i) {
+      double se = (s[i] - sr_) * one_on_dsr;
+      double x = std::pow(se, one_on_m);
+      double y = std::pow(1.0 - x, m_);
+      double dkdse = (2 * (1.0 - y) + x / (1.0 - x)) * se;
+      bool degenerate = (fabs(1.0 - x) < FLOW_WRM_TOLERANCE) || (fabs(x) < FLOW_WRM_TOLERANCE);
+      dkr[i] = degenerate ? 0.0 : dkdse * one_on_dsr;
+    }
+  }
+
+  for (int i=0; i!=n; ++i) {
+    if (s[i] > s0_) dkr[i] = s[i] == 1.0 ? 0.0 : fit_kr_.Derivative(s[i]);
+  }
+}
+
+
+/* ******************************************************************
+* Batched saturation.
+****************************************************************** */
+void WRMVanGenuchten::saturation_batch(int n, const double* pc, double* sat) {
+  if (tabulated_) {
+    for (int i=0; i!=n; ++i) sat[i] = WRMVanGenuchten::saturation(pc[i]);
+    return;
+  }
+
+  for (int i=0; i!=n; ++i) {
+    double apc = alpha_ * std::max(pc[i], 0.0);
+    double se = std::pow(1.0 + std::pow(apc, n_), -m_);
+    sat[i] = pc[i] <= 0. ? 1.0 : se * (1.0 - sr_) + sr_;
+  }
+
+  if (pc0_ > 0.) {
+    for (int i=0; i!=n; ++i) {
+      if (pc[i] > 0. && pc[i] <= pc0_) sat[i] = fit_s_(pc[i]);
+    }
+  }
+}
+
+
+/* ******************************************************************
+* Batched derivative of saturation w.r.t. capillary pressure.
+****************************************************************** */
+void WRMVanGenuchten::d_saturation_batch(int n, const double* pc, double* dsat) {
+  if (tabulated_) {
+    for (int i=0; i!=n; ++i) dsat[i] = WRMVanGenuchten::d_saturation(pc[i]);
+    return;
+  }
+
+  for (int i=0; i!=n; ++i) {
+    double apc = alpha_ * std::max(pc[i], 0.0);
+    double dse = -m_*n_ * std::pow(1.0 + std::pow(apc, n_), -m_-1.0) * std::pow(apc, n_-1) * alpha_;
+    dsat[i] = pc[i] <= 0. ? 0.0 : dse * (1.0 - sr_);
+  }
+
+  if (pc0_ > 0.) {
+    for (int i=0; i!=n; ++i) {
+      if (pc[i] > 0. && pc[i] <= pc0_) dsat[i] = fit_s_.Derivative(pc[i]);
+    }
+  }
+}
+
+
 void WRMVanGenuchten::InitializeFromPlist_() {
   std::string fname = plist_.get<std::string>("Krel function name", "Mualem");
   if (fname == std::string("Mualem")) {
@@ -203,9 +327,44 @@ void WRMVanGenuchten::InitializeFromPlist_() {
   pc0_ = plist_.get<double>("saturation smoothing interval [Pa]", 0.0);
   if (pc0_ > 0.) {
     fit_s_.Setup(0.0, 1.0, 0.0, pc0_, saturation(pc0_), d_saturation(pc0_));
-  }  
+  }
+
+  if (plist_.get<bool>("tabulate", false)) Tabulate_();
 };
 
+
+/* ******************************************************************
+* Fit monotone cubic tables to saturation and relative permeability.
+* The tables are fit to the closed forms, so this must be called with
+* tabulated_ false.
+****************************************************************** */
+void WRMVanGenuchten::Tabulate_() {
+  double tol = plist_.get<double>("tabulation tolerance [-]", 1.e-8);
+  int max_points = plist_.get<int>("tabulation maximum points", 8193);
+
+  // saturation, tabulated in log(pc) to the start of the smoothing interval
+  double pc_min = std::max(pc0_, 1.e-3 / alpha_);
+  double pc_max = 1.e3 / alpha_;
+  bool success = table_s_.Fit([this](double pc) { return saturation(pc); },
+          [this](double pc) { return d_saturation(pc); },
+          pc_min, pc_max, true, tol, 33, max_points);
+
+  // relative permeability, tabulated in s to the start of the smoothing interval
+  double s_max = std::min(s0_, plist_.get<double>("tabulation maximum saturation [-]", 0.95));
+  if (success && s_max > sr_) {
+    success = table_kr_.Fit([this](double s) { return k_relative(s); },
+            [this](double s) { return d_k_relative(s); },
+            sr_, s_max, false, tol, 33, max_points);
+  }
+
+  if (!success) {
+    Errors::Message message("WRM: van Genuchten tables did not meet \"tabulation tolerance [-]\" within \"tabulation maximum points\"; loosen the tolerance or increase the maximum number of points.");
+    Exceptions::amanzi_throw(message);
+  }
+  tabulated_ = true;
+}
+
+
 /* ******************************************************************
 * Suction formula: input is liquid saturation.
 ****************************************************************** */
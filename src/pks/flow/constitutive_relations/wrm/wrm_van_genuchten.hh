@@ -30,6 +30,21 @@ van Genuchten's water retention curve.
     * `"Mualem exponent l [-]`" ``[double]`` **0.5**
     * `"Krel function name`" ``[string]`` **Mualem**  `"Mualem`" or `"Burdine`"
 
+    * `"tabulate`" ``[bool]`` **false** If true, saturation and relative
+      permeability are evaluated from precomputed monotone cubic tables
+      instead of from the closed form.  Derivatives are the exact derivatives
+      of the tables, so are consistent with the values.  Saturation is
+      tabulated for capillary pressures within [1.e-3, 1.e3] / alpha, and
+      relative permeability for saturations within [residual saturation,
+      maximum tabulated saturation]; outside of these the closed form is used.
+    * `"tabulation tolerance [-]`" ``[double]`` **1.e-8** Maximum error of the
+      tables, relative to the maximum tabulated value.
+    * `"tabulation maximum points`" ``[int]`` **8193** The tables are refined
+      until the tolerance is met; it is an error if this takes more points.
+    * `"tabulation maximum saturation [-]`" ``[double]`` **0.95** Upper limit
+      of the relative permeability table, as the Mualem curve is singular at
+      saturation 1.  The smoothing interval, if any, is always excluded.
+
 Example:
 
 .. code-block:: xml
@@ -52,6 +67,7 @@ Example:
 #include "Spline.hh"
 
 #include "wrm.hh"
+#include "monotone_cubic_table.hh"
 #include "Factory.hh"
 
 namespace Amanzi {
@@ -73,8 +89,15 @@ public:
   double suction_head(double saturation);
   double d_suction_head(double saturation);
 
+  // batched methods, vectorizable loops over contiguous values
+  void k_relative_batch(int n, const double* saturation, double* kr);
+  void d_k_relative_batch(int n, const double* saturation, double* dkr);
+  void saturation_batch(int n, const double* pc, double* sat);
+  void d_saturation_batch(int n, const double* pc, double* dsat);
+
  private:
   void InitializeFromPlist_();
+  void Tabulate_();
 
   Teuchos::ParameterList& plist_;
 
@@ -91,6 +114,9 @@ public:
   double pc0_;
   Amanzi::Utils::Spline fit_s_;
 
+  bool tabulated_;
+  MonotoneCubicTable table_kr_;
+  MonotoneCubicTable table_s_;
 
   static Utils::RegisteredFactory<WRM,WRMVanGenuchten> factory_;
 };
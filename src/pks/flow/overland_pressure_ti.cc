@@ -59,33 +59,35 @@ void OverlandPressureFlow::FunctionalResidual( double t_old,
   S_next_->GetFieldEvaluator(potential_key_)->HasFieldChanged(S_next_.ptr(), name_);
 
   // dump u_old, u_new
-  db_->WriteCellInfo(true);
-  std::vector<std::string> vnames;
-  vnames.push_back("p_old");
-  vnames.push_back("p_new");
-  vnames.push_back("z");
-  vnames.push_back("h_old");
-  vnames.push_back("h_new");
-  vnames.push_back("h+z");
-  if (plist_->isSublist("overland conductivity subgrid evaluator")) {
-    vnames.push_back("pd - dd");
-    vnames.push_back("frac_cond");
-  }
+  if (debugging_) {
+    db_->WriteCellInfo(true);
+    std::vector<std::string> vnames;
+    vnames.push_back("p_old");
+    vnames.push_back("p_new");
+    vnames.push_back("z");
+    vnames.push_back("h_old");
+    vnames.push_back("h_new");
+    vnames.push_back("h+z");
+    if (plist_->isSublist("overland conductivity subgrid evaluator")) {
+      vnames.push_back("pd - dd");
+      vnames.push_back("frac_cond");
+    }
 
-  std::vector< Teuchos::Ptr<const CompositeVector> > vecs;
-  vecs.push_back(S_inter_->GetFieldData(key_).ptr());
-  vecs.push_back(u.ptr());
+    std::vector< Teuchos::Ptr<const CompositeVector> > vecs;
+    vecs.push_back(S_inter_->GetFieldData(key_).ptr());
+    vecs.push_back(u.ptr());
 
-  vecs.push_back(S_inter_->GetFieldData(elev_key_).ptr());
-  vecs.push_back(S_inter_->GetFieldData(pd_key_).ptr());
-  vecs.push_back(S_next_->GetFieldData(pd_key_).ptr());
-  vecs.push_back(S_next_->GetFieldData(potential_key_).ptr());
+    vecs.push_back(S_inter_->GetFieldData(elev_key_).ptr());
+    vecs.push_back(S_inter_->GetFieldData(pd_key_).ptr());
+    vecs.push_back(S_next_->GetFieldData(pd_key_).ptr());
+    vecs.push_back(S_next_->GetFieldData(potential_key_).ptr());
 
-  if (plist_->isSublist("overland conductivity subgrid evaluator")) {
-    vecs.push_back(S_next_->GetFieldData(Keys::getKey(domain_,"mobile_depth")).ptr());
-    vecs.push_back(S_next_->GetFieldData(Keys::getKey(domain_,"fractional_conductance")).ptr());
+    if (plist_->isSublist("overland conductivity subgrid evaluator")) {
+      vecs.push_back(S_next_->GetFieldData(Keys::getKey(domain_,"mobile_depth")).ptr());
+      vecs.push_back(S_next_->GetFieldData(Keys::getKey(domain_,"fractional_conductance")).ptr());
+    }
+    db_->WriteVectors(vnames, vecs, true);
   }
-  db_->WriteVectors(vnames, vecs, true);
 
   // update boundary conditions
   bc_head_->Compute(S_next_->time());
@@ -104,31 +106,35 @@ void OverlandPressureFlow::FunctionalResidual( double t_old,
   // diffusion term, treated implicitly
   ApplyDiffusion_(S_next_.ptr(), res.ptr());
 
-  db_->WriteBoundaryConditions(bc_markers(), bc_values());
-  if (S_next_->HasField(Keys::getKey(domain_,"unfrozen_fraction"))) {
-    Key uf_key = Keys::getKey(domain_,"unfrozen_fraction");
+  Key uf_key = Keys::getKey(domain_,"unfrozen_fraction");
+  if (S_next_->HasField(uf_key))
     S_next_->GetFieldEvaluator(uf_key)->HasFieldChanged(S_next_.ptr(), name_);
-    vnames.resize(2);
-    vecs.resize(2);
-    vnames[0] = "uf_frac_old";
-    vnames[1] = "uf_frac_new";
-    vecs[0] = S_inter_->GetFieldData(uf_key).ptr();
-    vecs[1] = S_next_->GetFieldData(uf_key).ptr();
-    db_->WriteVectors(vnames, vecs, true);
+
+  if (debugging_) {
+    db_->WriteBoundaryConditions(bc_markers(), bc_values());
+    if (S_next_->HasField(uf_key)) {
+      std::vector<std::string> vnames;
+      vnames.push_back("uf_frac_old");
+      vnames.push_back("uf_frac_new");
+      std::vector< Teuchos::Ptr<const CompositeVector> > vecs;
+      vecs.push_back(S_inter_->GetFieldData(uf_key).ptr());
+      vecs.push_back(S_next_->GetFieldData(uf_key).ptr());
+      db_->WriteVectors(vnames, vecs, true);
+    }
+    db_->WriteVector("uw_dir", S_next_->GetFieldData(flux_dir_key_).ptr(), true);
+    db_->WriteVector("k_s", S_next_->GetFieldData(cond_key_).ptr(), true);
+    db_->WriteVector("k_s_uw", S_next_->GetFieldData(uw_cond_key_).ptr(), true);
+    db_->WriteVector("q_s", S_next_->GetFieldData(flux_key_).ptr(), true);
+    db_->WriteVector("res (diff)", res.ptr(), true);
   }
-  db_->WriteVector("uw_dir", S_next_->GetFieldData(flux_dir_key_).ptr(), true);
-  db_->WriteVector("k_s", S_next_->GetFieldData(cond_key_).ptr(), true);
-  db_->WriteVector("k_s_uw", S_next_->GetFieldData(uw_cond_key_).ptr(), true);
-  db_->WriteVector("q_s", S_next_->GetFieldData(flux_key_).ptr(), true);
-  db_->WriteVector("res (diff)", res.ptr(), true);
 
   // accumulation term
   AddAccumulation_(res.ptr());
-  db_->WriteVector("res (acc)", res.ptr(), true);
+  if (debugging_) db_->WriteVector("res (acc)", res.ptr(), true);
 
   // add rhs load value
   AddSourceTerms_(res.ptr());
-  db_->WriteVector("res (src)", res.ptr(), true);
+  if (debugging_) db_->WriteVector("res (src)", res.ptr(), true);
 
 #if DEBUG_RES_FLAG
   if (vo_->os_OK(Teuchos::VERB_HIGH)) {
@@ -168,9 +174,9 @@ int OverlandPressureFlow::ApplyPreconditioner(Teuchos::RCP<const TreeVector> u,
   AMANZI_ASSERT(!precon_scaled_); // otherwise this factor was built into the matrix
 
   // apply the preconditioner
-  db_->WriteVector("h_res", u->Data().ptr(), true);
+  if (debugging_) db_->WriteVector("h_res", u->Data().ptr(), true);
   int ierr = preconditioner_->ApplyInverse(*u->Data(), *Pu->Data());
-  db_->WriteVector("PC*h_res (h-coords)", Pu->Data().ptr(), true);
+  if (debugging_) db_->WriteVector("PC*h_res (h-coords)", Pu->Data().ptr(), true);
 
   // tack on the variable change
   const Epetra_MultiVector& dh_dp =
@@ -182,7 +188,7 @@ int OverlandPressureFlow::ApplyPreconditioner(Teuchos::RCP<const TreeVector> u,
     Pu_c[0][c] /= dh_dp[0][c];
   }
 
-  db_->WriteVector("PC*h_res (p-coords)", Pu->Data().ptr(), true);
+  if (debugging_) db_->WriteVector("PC*h_res (p-coords)", Pu->Data().ptr(), true);
   return (ierr > 0) ? 0 : 1;
 };
 
@@ -57,20 +57,22 @@ void OverlandFlow::FunctionalResidual( double t_old,
 
 #if DEBUG_FLAG
   // dump u_old, u_new
-  db_->WriteCellInfo(true);
-  std::vector<std::string> vnames;
-  vnames.push_back("z");
-  vnames.push_back("h_old");
-  vnames.push_back("h_new");
-  vnames.push_back("h+z");
-
-  std::vector< Teuchos::Ptr<const CompositeVector> > vecs;
-  vecs.push_back(S_inter_->GetFieldData(Keys::getKey(domain_,"elevation")).ptr());
-  vecs.push_back(S_inter_->GetFieldData(Keys::getKey(domain_,"ponded_depth")).ptr());
-  vecs.push_back(S_next_->GetFieldData(Keys::getKey(domain_,"ponded_depth")).ptr());
-  vecs.push_back(S_next_->GetFieldData(Keys::getKey(domain_, "pres_elev")).ptr());
-
-  db_->WriteVectors(vnames, vecs, true);
+  if (debugging_) {
+    db_->WriteCellInfo(true);
+    std::vector<std::string> vnames;
+    vnames.push_back("z");
+    vnames.push_back("h_old");
+    vnames.push_back("h_new");
+    vnames.push_back("h+z");
+
+    std::vector< Teuchos::Ptr<const CompositeVector> > vecs;
+    vecs.push_back(S_inter_->GetFieldData(Keys::getKey(domain_,"elevation")).ptr());
+    vecs.push_back(S_inter_->GetFieldData(Keys::getKey(domain_,"ponded_depth")).ptr());
+    vecs.push_back(S_next_->GetFieldData(Keys::getKey(domain_,"ponded_depth")).ptr());
+    vecs.push_back(S_next_->GetFieldData(Keys::getKey(domain_, "pres_elev")).ptr());
+
+    db_->WriteVectors(vnames, vecs, true);
+  }
 #endif
 
   // pointer-copy temperature into state and update any auxilary data
@@ -86,24 +88,27 @@ void OverlandFlow::FunctionalResidual( double t_old,
   ApplyDiffusion_(S_next_.ptr(), res.ptr());
 
 #if DEBUG_FLAG
-  vnames.resize(2); vecs.resize(2);
-  vnames[0] = "k_s"; vnames[1] = "uw k_s";
-  vecs[0] = S_next_->GetFieldData(Keys::getKey(domain_,"overland_conductivity")).ptr();
-  vecs[1] = S_next_->GetFieldData(Keys::getKey(domain_,"upwind_overland_conductivity")).ptr();
-  db_->WriteVectors(vnames, vecs, true);
-  db_->WriteVector("res (diff)", res.ptr(), true);
+  if (debugging_) {
+    std::vector<std::string> vnames;
+    vnames.push_back("k_s"); vnames.push_back("uw k_s");
+    std::vector< Teuchos::Ptr<const CompositeVector> > vecs;
+    vecs.push_back(S_next_->GetFieldData(Keys::getKey(domain_,"overland_conductivity")).ptr());
+    vecs.push_back(S_next_->GetFieldData(Keys::getKey(domain_,"upwind_overland_conductivity")).ptr());
+    db_->WriteVectors(vnames, vecs, true);
+    db_->WriteVector("res (diff)", res.ptr(), true);
+  }
 #endif
 
   // accumulation term
   AddAccumulation_(res.ptr());
 #if DEBUG_FLAG
-  db_->WriteVector("res (acc)", res.ptr(), true);
+  if (debugging_) db_->WriteVector("res (acc)", res.ptr(), true);
 #endif
 
   // add rhs load value
   AddSourceTerms_(res.ptr());
 #if DEBUG_FLAG
-  db_->WriteVector("res (src)", res.ptr(), true);
+  if (debugging_) db_->WriteVector("res (src)", res.ptr(), true);
 #endif
 };
 
@@ -117,14 +122,14 @@ int OverlandFlow::ApplyPreconditioner(Teuchos::RCP<const TreeVector> u, Teuchos:
     *vo_->os() << "Precon application:" << std::endl;
 
 #if DEBUG_FLAG
-  db_->WriteVector("h_res", u->Data().ptr(), true);
+  if (debugging_) db_->WriteVector("h_res", u->Data().ptr(), true);
 #endif
 
   // apply the preconditioner
   int ierr = preconditioner_->ApplyInverse(*u->Data(), *Pu->Data());
 
 #if DEBUG_FLAG
-  db_->WriteVector("PC*h_res (h-coords)", Pu->Data().ptr(), true);
+  if (debugging_) db_->WriteVector("PC*h_res (h-coords)", Pu->Data().ptr(), true);
 #endif
 
   return (ierr > 0) ? 0 : 1;
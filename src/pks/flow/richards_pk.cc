@@ -28,6 +28,7 @@ Authors: Neil Carlson (version 1)
 #include "predictor_delegate_bc_flux.hh"
 #include "wrm_evaluator.hh"
 #include "rel_perm_evaluator.hh"
+#include "boundary_face_table.hh"
 #include "richards_water_content_evaluator.hh"
 #include "OperatorDefs.hh"
 #include "BoundaryFlux.hh"
@@ -881,10 +882,9 @@ bool Richards::UpdatePermeabilityData_(const Teuchos::Ptr<State>& S)
       uw_rel_perm_f.Export(rel_perm_bf, vandelay, Insert);
     } else if (clobber_policy_ == "max") {
       Epetra_MultiVector& uw_rel_perm_f = *uw_rel_perm->ViewComponent("face",false);
-      const auto& fmap = mesh_->face_map(true);
-      const auto& bfmap = mesh_->exterior_face_map(true);
+      auto bfaces = getBoundaryFaceTable(mesh_);
       for (int bf=0; bf!=rel_perm_bf.MyLength(); ++bf) {
-        auto f = fmap.LID(bfmap.GID(bf));
+        auto f = bfaces->face(bf);
         if (rel_perm_bf[0][bf] > uw_rel_perm_f[0][f]) {
           uw_rel_perm_f[0][f] = rel_perm_bf[0][bf];
         }
@@ -893,17 +893,14 @@ bool Richards::UpdatePermeabilityData_(const Teuchos::Ptr<State>& S)
       // clobber only when the interior cell is unsaturated
       Epetra_MultiVector& uw_rel_perm_f = *uw_rel_perm->ViewComponent("face",false);
       const Epetra_MultiVector& pres = *S->GetFieldData(key_)->ViewComponent("cell",false);
-      const auto& fmap = mesh_->face_map(true);
-      const auto& bfmap = mesh_->exterior_face_map(true);
+      auto bfaces = getBoundaryFaceTable(mesh_);
       for (int bf=0; bf!=rel_perm_bf.MyLength(); ++bf) {
-        auto f = fmap.LID(bfmap.GID(bf));
-        AmanziMesh::Entity_ID_List fcells;
-        mesh_->face_get_cells(f, AmanziMesh::Parallel_type::ALL, &fcells);
-        AMANZI_ASSERT(fcells.size() == 1);
-        if (pres[0][fcells[0]] < 101225.) {
+        auto f = bfaces->face(bf);
+        auto c = bfaces->cell(bf);
+        if (pres[0][c] < 101225.) {
           uw_rel_perm_f[0][f] = rel_perm_bf[0][bf];
-        } else if (pres[0][fcells[0]] < 101325.) {
-          double frac = (101325. - pres[0][fcells[0]])/100.;
+        } else if (pres[0][c] < 101325.) {
+          double frac = (101325. - pres[0][c])/100.;
           uw_rel_perm_f[0][f] = rel_perm_bf[0][bf] * frac + uw_rel_perm_f[0][f] * (1-frac);
         }
       }
@@ -45,17 +45,19 @@ void Richards::FunctionalResidual(double t_old,
                << " t1 = " << t_new << " h = " << h << std::endl;
 
   // dump u_old, u_new
-  db_->WriteCellInfo(true);
-  std::vector<std::string> vnames;
-  vnames.push_back("p_old"); vnames.push_back("p_new");
-  std::vector< Teuchos::Ptr<const CompositeVector> > vecs;
-  vecs.push_back(S_inter_->GetFieldData(key_).ptr()); vecs.push_back(u.ptr());
-  db_->WriteVectors(vnames, vecs, true);
+  if (debugging_) {
+    db_->WriteCellInfo(true);
+    std::vector<std::string> vnames;
+    vnames.push_back("p_old"); vnames.push_back("p_new");
+    std::vector< Teuchos::Ptr<const CompositeVector> > vecs;
+    vecs.push_back(S_inter_->GetFieldData(key_).ptr()); vecs.push_back(u.ptr());
+    db_->WriteVectors(vnames, vecs, true);
+  }
 
   // update boundary conditions
   ComputeBoundaryConditions_(S_next_.ptr());
   UpdateBoundaryConditions_(S_next_.ptr());
-  db_->WriteBoundaryConditions(bc_markers(), bc_values());
+  if (debugging_) db_->WriteBoundaryConditions(bc_markers(), bc_values());
 
   // zero out residual
   Teuchos::RCP<CompositeVector> res = g->Data();
@@ -66,35 +68,39 @@ void Richards::FunctionalResidual(double t_old,
   // if (vapor_diffusion_) AddVaporDiffusionResidual_(S_next_.ptr(), res.ptr());
 
   // dump s_old, s_new
-  vnames[0] = "sl_old"; vnames[1] = "sl_new";
-  vecs[0] = S_inter_->GetFieldData(sat_key_).ptr();
-  vecs[1] = S_next_->GetFieldData(sat_key_).ptr();
-
-  if (S_next_->HasField(sat_ice_key_)) {
-    vnames.push_back("si_old");
-    vnames.push_back("si_new");
-    vecs.push_back(S_inter_->GetFieldData(Keys::getKey(domain_,"saturation_ice")).ptr());
-    vecs.push_back(S_next_->GetFieldData(Keys::getKey(domain_,"saturation_ice")).ptr());
+  if (debugging_) {
+    std::vector<std::string> vnames;
+    std::vector< Teuchos::Ptr<const CompositeVector> > vecs;
+    vnames.push_back("sl_old"); vnames.push_back("sl_new");
+    vecs.push_back(S_inter_->GetFieldData(sat_key_).ptr());
+    vecs.push_back(S_next_->GetFieldData(sat_key_).ptr());
+
+    if (S_next_->HasField(sat_ice_key_)) {
+      vnames.push_back("si_old");
+      vnames.push_back("si_new");
+      vecs.push_back(S_inter_->GetFieldData(Keys::getKey(domain_,"saturation_ice")).ptr());
+      vecs.push_back(S_next_->GetFieldData(Keys::getKey(domain_,"saturation_ice")).ptr());
+    }
+    vnames.push_back("poro");
+    vecs.push_back(S_next_->GetFieldData(Keys::getKey(domain_,"porosity")).ptr());
+    vnames.push_back("perm_K");
+    vecs.push_back(S_next_->GetFieldData(Keys::getKey(domain_,"permeability")).ptr());
+    vnames.push_back("k_rel");
+    vecs.push_back(S_next_->GetFieldData(coef_key_).ptr());
+    vnames.push_back("wind");
+    vecs.push_back(S_next_->GetFieldData(flux_dir_key_).ptr());
+    vnames.push_back("uw_k_rel");
+    vecs.push_back(S_next_->GetFieldData(uw_coef_key_).ptr());
+    vnames.push_back("flux");
+    vecs.push_back(S_next_->GetFieldData(flux_key_).ptr());
+    db_->WriteVectors(vnames,vecs,true);
+
+    db_->WriteVector("res (diff)", res.ptr(), true);
   }
-  vnames.push_back("poro");
-  vecs.push_back(S_next_->GetFieldData(Keys::getKey(domain_,"porosity")).ptr());
-  vnames.push_back("perm_K");
-  vecs.push_back(S_next_->GetFieldData(Keys::getKey(domain_,"permeability")).ptr());
-  vnames.push_back("k_rel");
-  vecs.push_back(S_next_->GetFieldData(coef_key_).ptr());
-  vnames.push_back("wind");
-  vecs.push_back(S_next_->GetFieldData(flux_dir_key_).ptr());
-  vnames.push_back("uw_k_rel");
-  vecs.push_back(S_next_->GetFieldData(uw_coef_key_).ptr());
-  vnames.push_back("flux");
-  vecs.push_back(S_next_->GetFieldData(flux_key_).ptr());
-  db_->WriteVectors(vnames,vecs,true);
-
-  db_->WriteVector("res (diff)", res.ptr(), true);
 
   // accumulation term
   AddAccumulation_(res.ptr());
-  db_->WriteVector("res (acc)", res.ptr(), true);
+  if (debugging_) db_->WriteVector("res (acc)", res.ptr(), true);
 
   // source term
   if (is_source_term_) {
@@ -103,7 +109,7 @@ void Richards::FunctionalResidual(double t_old,
     } else {
       AddSources_(S_next_.ptr(), res.ptr());
     }
-    db_->WriteVector("res (src)", res.ptr(), false);
+    if (debugging_) db_->WriteVector("res (src)", res.ptr(), false);
   }
 };
 
@@ -115,12 +121,12 @@ int Richards::ApplyPreconditioner(Teuchos::RCP<const TreeVector> u, Teuchos::RCP
   if (vo_->os_OK(Teuchos::VERB_HIGH))
     *vo_->os() << "Precon application:" << std::endl;
 
-  db_->WriteVector("p_res", u->Data().ptr(), true);
+  if (debugging_) db_->WriteVector("p_res", u->Data().ptr(), true);
 
   // Apply the preconditioner
   int ierr = preconditioner_->ApplyInverse(*u->Data(), *Pu->Data());
 
-  db_->WriteVector("PC*p_res", Pu->Data().ptr(), true);
+  if (debugging_) db_->WriteVector("PC*p_res", Pu->Data().ptr(), true);
   
   return (ierr > 0) ? 0 : 1;
 };
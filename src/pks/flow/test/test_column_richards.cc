@@ -0,0 +1,161 @@
+#include <cmath>
+#include <vector>
+#include "UnitTest++.h"
+
+#include "Teuchos_ParameterList.hpp"
+
+#include "wrm_van_genuchten.hh"
+#include "column_richards.hh"
+
+using namespace Amanzi;
+using namespace Amanzi::Flow;
+
+namespace {
+
+const double p_atm = 101325.;
+const double rho_g = 1000. * 9.80665;
+
+// Columns of ncells cells of height 0.1 m, ordered from the top down, with
+// differing areas and soil properties, packed as by ColumnEnsemble.
+struct Columns {
+  Columns(int ncols, int ncells) :
+      ncols(ncols), ncells(ncells)
+  {
+    int n = ncols * ncells, nf = ncols * (ncells-1);
+    vol.resize(n); z.resize(n); poro.resize(n); perm.resize(n);
+    farea.resize(nf); fz.resize(nf);
+    for (int k=0; k!=ncells; ++k) {
+      for (int i=0; i!=ncols; ++i) {
+        double area = 1. + i;
+        vol[k*ncols + i] = 0.1 * area;
+        z[k*ncols + i] = -0.1 * k - 0.05;
+        poro[k*ncols + i] = 0.3 + 0.05 * i;
+        perm[k*ncols + i] = 1.e-12 * (1. + i) * (1. + 0.1 * k);
+        if (k < ncells-1) {
+          farea[k*ncols + i] = area;
+          fz[k*ncols + i] = -0.1 * (k+1);
+        }
+      }
+    }
+  }
+
+  // column i alone
+  Columns Column(int i) const {
+    Columns col(1, ncells);
+    for (int k=0; k!=ncells; ++k) {
+      col.vol[k] = vol[k*ncols + i];
+      col.z[k] = z[k*ncols + i];
+      col.poro[k] = poro[k*ncols + i];
+      col.perm[k] = perm[k*ncols + i];
+      if (k < ncells-1) {
+        col.farea[k] = farea[k*ncols + i];
+        col.fz[k] = fz[k*ncols + i];
+      }
+    }
+    return col;
+  }
+
+  void Set(ColumnRichards& model) const {
+    model.SetColumns(vol.data(), z.data(), farea.data(), fz.data(), poro.data(), perm.data());
+  }
+
+  // hydrostatic pressure with the water table at z_wt
+  std::vector<double> Hydrostatic(double z_wt) const {
+    std::vector<double> p(ncols * ncells);
+    for (int j=0; j!=p.size(); ++j) p[j] = p_atm - rho_g * (z[j] - z_wt);
+    return p;
+  }
+
+  int ncols, ncells;
+  std::vector<double> vol, z, poro, perm, farea, fz;
+};
+
+Teuchos::RCP<WRM> createWRM() {
+  Teuchos::ParameterList plist;
+  plist.set("van Genuchten alpha [Pa^-1]", 2.e-4);
+  plist.set("van Genuchten n [-]", 1.6);
+  plist.set("residual saturation [-]", 0.1);
+  return Teuchos::rcp(new WRMVanGenuchten(plist));
+}
+
+} // namespace
+
+
+TEST(COLUMN_RICHARDS_HYDROSTATIC_IS_STEADY) {
+  Columns cols(4, 20);
+  Teuchos::ParameterList plist;
+  ColumnRichards model(plist, createWRM(), cols.ncols, cols.ncells);
+  cols.Set(model);
+
+  std::vector<double> p = cols.Hydrostatic(-3.);
+  std::vector<double> p0 = p;
+  int its = -1;
+  CHECK_EQUAL(0, model.AdvanceStep(86400., p.data(), its));
+  CHECK_EQUAL(0, its);
+  for (int j=0; j!=p.size(); ++j) CHECK_EQUAL(p0[j], p[j]);
+}
+
+
+TEST(COLUMN_RICHARDS_INFILTRATION_CONSERVES_WATER) {
+  Columns cols(4, 20);
+  Teuchos::ParameterList plist;
+  ColumnRichards model(plist, createWRM(), cols.ncols, cols.ncells);
+  cols.Set(model);
+
+  std::vector<double> q_first(cols.ncols), q_last(cols.ncols, 0.);
+  for (int i=0; i!=cols.ncols; ++i) q_first[i] = 5.e-3 * (1. + i);
+  model.SetBoundaryFluxes(q_first.data(), q_last.data());
+
+  std::vector<double> p = cols.Hydrostatic(-3.);
+  int n = p.size();
+  std::vector<double> wc_old(n), wc_new(n);
+  model.WaterContent(p.data(), wc_old.data());
+
+  double dt = 3600.;
+  int its = -1;
+  CHECK_EQUAL(0, model.AdvanceStep(dt, p.data(), its));
+  CHECK(its > 0);
+  model.WaterContent(p.data(), wc_new.data());
+
+  for (int i=0; i!=cols.ncols; ++i) {
+    double dwc = 0.;
+    for (int k=0; k!=cols.ncells; ++k) dwc += wc_new[k*cols.ncols + i] - wc_old[k*cols.ncols + i];
+    CHECK_CLOSE(dt * q_first[i], dwc, 1.e-4);
+    CHECK(wc_new[i] > wc_old[i]);
+  }
+}
+
+
+TEST(COLUMN_RICHARDS_BATCHED_MATCHES_SINGLE_COLUMNS) {
+  Columns cols(3, 15);
+  Teuchos::ParameterList plist;
+  auto wrm = createWRM();
+
+  std::vector<double> q_first = { 1.e-2, 0., -2.e-3 };
+  std::vector<double> q_last = { 0., 1.e-3, 0. };
+  std::vector<double> p = cols.Hydrostatic(-2.);
+
+  std::vector<std::vector<double> > p_single(cols.ncols);
+  for (int i=0; i!=cols.ncols; ++i) {
+    Columns col = cols.Column(i);
+    ColumnRichards model(plist, wrm, 1, col.ncells);
+    col.Set(model);
+    model.SetBoundaryFluxes(&q_first[i], &q_last[i]);
+
+    p_single[i] = col.Hydrostatic(-2.);
+    int its;
+    CHECK_EQUAL(0, model.AdvanceStep(1800., p_single[i].data(), its));
+  }
+
+  ColumnRichards model(plist, wrm, cols.ncols, cols.ncells);
+  cols.Set(model);
+  model.SetBoundaryFluxes(q_first.data(), q_last.data());
+  int its;
+  CHECK_EQUAL(0, model.AdvanceStep(1800., p.data(), its));
+
+  for (int k=0; k!=cols.ncells; ++k) {
+    for (int i=0; i!=cols.ncols; ++i) {
+      CHECK_CLOSE(p_single[i][k], p[k*cols.ncols + i], 1.e-3);
+    }
+  }
+}
@@ -0,0 +1,66 @@
+/* -*-  mode: c++; indent-tabs-mode: nil -*- */
+/*
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+*/
+
+//! Data computed once per mesh and shared by its users.
+
+/*
+  Some data depend only on a mesh and are needed by many evaluators and PKs,
+  e.g. the cells of each land cover region or the boundary face
+  connectivity.  MeshCache<T> computes a T once per mesh and hands the same
+  T to every caller on that mesh.
+
+  Entries hold weak references to their meshes, so the cache never keeps a
+  mesh alive, and the entries of destroyed meshes are dropped on the next
+  lookup.  Meshes are identified by their reference-count node rather than
+  by address, so a mesh allocated where a destroyed one lived never gets the
+  destroyed mesh's data.  Lookups are serialized by a mutex.
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "Teuchos_RCP.hpp"
+
+#include "Mesh.hh"
+
+namespace Amanzi {
+
+template<typename T>
+class MeshCache {
+ public:
+  // Returns the entry of mesh, calling create(*mesh) to build it if there is
+  // none.  T must not hold a strong reference to the mesh.
+  template<typename Create>
+  Teuchos::RCP<const T>
+  get(const Teuchos::RCP<const AmanziMesh::Mesh>& mesh, const Create& create)
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    entries_.erase(std::remove_if(entries_.begin(), entries_.end(),
+            [](const Entry& entry) { return !entry.first.is_valid_ptr(); }),
+                   entries_.end());
+
+    for (const auto& entry : entries_) {
+      if (entry.first.shares_resource(mesh)) return entry.second;
+    }
+
+    Teuchos::RCP<const T> value = create(*mesh);
+    entries_.emplace_back(mesh.create_weak(), value);
+    return value;
+  }
+
+ private:
+  using Entry = std::pair<Teuchos::RCP<const AmanziMesh::Mesh>, Teuchos::RCP<const T> >;
+
+  std::mutex mutex_;
+  std::vector<Entry> entries_;
+};
+
+} // namespace Amanzi
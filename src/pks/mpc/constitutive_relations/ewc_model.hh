@@ -28,7 +28,16 @@ class EWCModel {
  public:
   virtual bool Freezing(double T, double p) = 0;
   virtual void InitializeModel(const Teuchos::Ptr<State>& S, Teuchos::ParameterList& plist) = 0;
-  virtual void UpdateModel(const Teuchos::Ptr<State>& S, int c) = 0;
+
+  // Creates an independent copy of an initialized model, for use by one thread.
+  virtual Teuchos::RCP<EWCModel> Clone() const = 0;
+
+  // Binds, once per sweep over cells, all State data needed by the model, so
+  // that the per-cell update below is only array lookups.
+  virtual void UpdateModel(const Teuchos::Ptr<State>& S) = 0;
+
+  // Sets the cell-wise parameters of cell c from the bound data.
+  virtual void UpdateModel(int c) = 0;
 
   virtual int Evaluate(double T, double p, double& energy, double& wc) = 0;
   virtual int InverseEvaluate(double energy, double wc, double& T, double& p, bool verbose=false) = 0;
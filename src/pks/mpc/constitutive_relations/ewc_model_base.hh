@@ -20,6 +20,15 @@ evaluating.
 
 namespace Amanzi {
 
+// Cell-wise parameters of EWC models, as a struct of arrays bound from State
+// once per sweep.  Arrays not used by a given model are left null.
+struct EWCModelCellParameters {
+  double p_atm = -1.e12;
+  const double* density_rock = nullptr;
+  const double* base_porosity = nullptr;
+};
+
+
 class EWCModelBase : public EWCModel {
  public:
   EWCModelBase() {}
@@ -39,6 +48,9 @@ class EWCModelBase : public EWCModel {
 
   int EvaluateEnergyAndWaterContentAndJacobian_FD_(double T, double p,
           AmanziGeometry::Point& result, WhetStone::Tensor& jac);
+
+ protected:
+  EWCModelCellParameters cell_params_;
 };
 
 } // namespace
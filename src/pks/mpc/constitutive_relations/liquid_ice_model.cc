@@ -42,6 +42,8 @@ void LiquidIceModel::InitializeModel(const Teuchos::Ptr<State>& S,
   rho_rock_ = -1.;
   p_atm_ = -1.e12;
   domain = plist.get<std::string>("domain key", "");
+  rho_rock_key_ = Keys::getKey(domain, "density_rock");
+  poro_key_ = Keys::getKey(domain, "base_porosity");
   if (!domain.empty()) {
     mesh_ = S->GetMesh(domain);
   } else {
@@ -130,27 +132,33 @@ void LiquidIceModel::InitializeModel(const Teuchos::Ptr<State>& S,
 }
 
 
-void LiquidIceModel::UpdateModel(const Teuchos::Ptr<State>& S, int c) {
-  // update scalars
-  p_atm_ = *S->GetScalarData("atmospheric_pressure");
-  rho_rock_ = (*S->GetFieldData(Keys::getKey(domain,"density_rock"))->ViewComponent("cell"))[0][c];
-  poro_ = (*S->GetFieldData(Keys::getKey(domain,"base_porosity"))->ViewComponent("cell"))[0][c];
-  wrm_ = wrms_->second[(*wrms_->first)[c]];
+void LiquidIceModel::UpdateModel(const Teuchos::Ptr<State>& S) {
+  cell_params_.p_atm = *S->GetScalarData("atmospheric_pressure");
+  cell_params_.density_rock = (*S->GetFieldData(rho_rock_key_)->ViewComponent("cell"))[0];
+  cell_params_.base_porosity = (*S->GetFieldData(poro_key_)->ViewComponent("cell"))[0];
+}
+
+void LiquidIceModel::UpdateModel(int c) {
+  AMANZI_ASSERT(cell_params_.density_rock != nullptr);
+  p_atm_ = cell_params_.p_atm;
+  rho_rock_ = cell_params_.density_rock[c];
+  poro_ = cell_params_.base_porosity[c];
+  wrm_ = wrms_->second[(*wrms_->first)[c]].get();
   if(!poro_leij_)
-    poro_model_ = poro_models_->second[(*poro_models_->first)[c]];
+    poro_model_ = poro_models_->second[(*poro_models_->first)[c]].get();
   else
-    poro_leij_model_ = poro_leij_models_->second[(*poro_leij_models_->first)[c]];
+    poro_leij_model_ = poro_leij_models_->second[(*poro_leij_models_->first)[c]].get();
     
   AMANZI_ASSERT(IsSetUp_());
 }
 
 bool LiquidIceModel::IsSetUp_() {
-  if (wrm_ == Teuchos::null) return false;
+  if (wrm_ == nullptr) return false;
   if (!poro_leij_) {
-    if (poro_model_ == Teuchos::null) return false;
+    if (poro_model_ == nullptr) return false;
   }
   else {
-    if (poro_leij_model_ == Teuchos::null) return false;
+    if (poro_leij_model_ == nullptr) return false;
   }
   if (liquid_eos_ == Teuchos::null) return false;
   if (ice_eos_ == Teuchos::null) return false;
@@ -34,11 +34,19 @@ namespace Relations { class EOS; }
 class LiquidIceModel : public EWCModelBase {
 
  public:
-  LiquidIceModel() {}
+  LiquidIceModel() :
+      wrm_(nullptr),
+      poro_model_(nullptr),
+      poro_leij_model_(nullptr) {}
+
+  virtual Teuchos::RCP<EWCModel> Clone() const {
+    return Teuchos::rcp(new LiquidIceModel(*this));
+  }
 
   virtual void InitializeModel(const Teuchos::Ptr<State>& S,
                                Teuchos::ParameterList& plist);
-  virtual void UpdateModel(const Teuchos::Ptr<State>& S, int c);
+  virtual void UpdateModel(const Teuchos::Ptr<State>& S);
+  virtual void UpdateModel(int c);
   virtual bool Freezing(double T, double p);
   virtual int EvaluateSaturations(double T, double p,
                                   double& s_gas, double& s_liq, double& s_ice);
@@ -51,7 +59,7 @@ class LiquidIceModel : public EWCModelBase {
 
  protected:
   Teuchos::RCP<Flow::WRMPermafrostModelPartition> wrms_;
-  Teuchos::RCP<Flow::WRMPermafrostModel> wrm_;
+  Flow::WRMPermafrostModel* wrm_;
   Teuchos::RCP<Relations::EOS> liquid_eos_;
   Teuchos::RCP<Relations::EOS> gas_eos_;
   Teuchos::RCP<Relations::EOS> ice_eos_;
@@ -61,16 +69,18 @@ class LiquidIceModel : public EWCModelBase {
   Teuchos::RCP<Energy::IEM> ice_iem_;
   Teuchos::RCP<Energy::IEM> rock_iem_;
   Teuchos::RCP<Flow::CompressiblePorosityModelPartition> poro_models_;
-  Teuchos::RCP<Flow::CompressiblePorosityModel> poro_model_;
+  Flow::CompressiblePorosityModel* poro_model_;
 
   Teuchos::RCP<Flow::CompressiblePorosityLeijnseModelPartition> poro_leij_models_;
-  Teuchos::RCP<Flow::CompressiblePorosityLeijnseModel> poro_leij_model_;
+  Flow::CompressiblePorosityLeijnseModel* poro_leij_model_;
 
   double p_atm_;
   double poro_;
   double rho_rock_;
   bool poro_leij_;
   Key domain;
+  Key rho_rock_key_;
+  Key poro_key_;
   Teuchos::RCP<const AmanziMesh::Mesh> mesh_;
 
   bool use_pc_ice_;
@@ -86,13 +86,18 @@ SurfaceIceModel::InitializeModel(const Teuchos::Ptr<State>& S, Teuchos::Paramete
 }
 
 void
-SurfaceIceModel::UpdateModel(const Teuchos::Ptr<State>& S, int c) {
+SurfaceIceModel::UpdateModel(const Teuchos::Ptr<State>& S) {
   // update scalars
   p_atm_ = *S->GetScalarData("atmospheric_pressure");
   gz_ = -((*S->GetConstantVectorData("gravity"))[2]);
   AMANZI_ASSERT(IsSetUp_());
 }
 
+void
+SurfaceIceModel::UpdateModel(int c) {
+  // no cell-wise parameters
+}
+
 bool
 SurfaceIceModel::IsSetUp_() {
   if (pd_ == Teuchos::null) return false;
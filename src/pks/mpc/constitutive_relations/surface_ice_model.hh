@@ -37,8 +37,13 @@ class SurfaceIceModel : public EWCModelBase {
 
  public:
   SurfaceIceModel() {}
+
+  virtual Teuchos::RCP<EWCModel> Clone() const {
+    return Teuchos::rcp(new SurfaceIceModel(*this));
+  }
   virtual void InitializeModel(const Teuchos::Ptr<State>& S, Teuchos::ParameterList& plist);
-  virtual void UpdateModel(const Teuchos::Ptr<State>& S, int c);
+  virtual void UpdateModel(const Teuchos::Ptr<State>& S);
+  virtual void UpdateModel(int c);
 
   virtual bool Freezing(double T, double p) { return T < 273.15; }
   virtual int EvaluateSaturations(double T, double p, double& s_gas, double& s_liq, double& s_ice) {
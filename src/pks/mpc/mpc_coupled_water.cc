@@ -35,6 +35,7 @@ MPCCoupledWater::Setup(const Teuchos::Ptr<State>& S) {
   // grab the meshes
   surf_mesh_ = S->GetMesh(domain_surf_);
   domain_mesh_ = S->GetMesh(domain_ss_);
+  surf_sub_map_ = Teuchos::rcp(new SurfaceSubsurfaceFaceMap(surf_mesh_, domain_mesh_));
 
   // cast the PKs
   domain_flow_pk_ = sub_pks_[0];
@@ -73,6 +74,7 @@ MPCCoupledWater::Setup(const Teuchos::Ptr<State>& S) {
   domain_db_ = domain_flow_pk_->debugger();
   surf_db_ = surf_flow_pk_->debugger();
   water_->set_db(domain_db_);
+  water_->set_face_map(surf_sub_map_);
 }
 
 void
@@ -89,7 +91,7 @@ MPCCoupledWater::Initialize(const Teuchos::Ptr<State>& S) {
   // CopySurfaceToSubsurface(*S->GetFieldData(Keys::getKey(domain_surf_,"pressure"), sub_pks_[1]->name()),
   //       		  S->GetFieldData(Keys::getKey(domain_ss_,"pressure"), sub_pks_[0]->name()).ptr());
   // ensure continuity of ICs... subsurface takes precedence.
-  CopySubsurfaceToSurface(*S->GetFieldData(Keys::getKey(domain_ss_,"pressure"), sub_pks_[0]->name()),
+  surf_sub_map_->CopySubsurfaceToSurface(*S->GetFieldData(Keys::getKey(domain_ss_,"pressure"), sub_pks_[0]->name()),
 			  S->GetFieldData(Keys::getKey(domain_surf_,"pressure"), sub_pks_[1]->name()).ptr());
 
   // Initialize my timestepper.
@@ -147,8 +149,8 @@ int MPCCoupledWater::ApplyPreconditioner(Teuchos::RCP<const TreeVector> u,
   if (vo_->os_OK(Teuchos::VERB_EXTREME))
     *vo_->os() << "Precon applying  CopySubsurfaceToSurface." << std::endl;
   // Copy subsurface face corrections to surface cell corrections
-  CopySubsurfaceToSurface(*Pu->SubVector(0)->Data(),
-                          Pu->SubVector(1)->Data().ptr());
+  surf_sub_map_->CopySubsurfaceToSurface(*Pu->SubVector(0)->Data(),
+                                         Pu->SubVector(1)->Data().ptr());
 
   // // Derive surface face corrections.
   // UpdateConsistentFaceCorrectionWater_(u, Pu);
@@ -203,7 +205,7 @@ MPCCoupledWater::ModifyPredictor(double h, Teuchos::RCP<const TreeVector> u0,
   if (modified) {
     S_next_->GetFieldEvaluator(Keys::getKey(domain_surf_,"relative_permeability"))->HasFieldChanged(S_next_.ptr(),name_);
     Teuchos::RCP<const CompositeVector> h_prev = S_inter_->GetFieldData(Keys::getKey(domain_surf_,"ponded_depth"));
-    MergeSubsurfaceAndSurfacePressure(*h_prev, u->SubVector(0)->Data().ptr(),
+    surf_sub_map_->MergeSubsurfaceAndSurfacePressure(*h_prev, u->SubVector(0)->Data().ptr(),
             u->SubVector(1)->Data().ptr());
   }
 
@@ -215,7 +217,7 @@ MPCCoupledWater::ModifyPredictor(double h, Teuchos::RCP<const TreeVector> u0,
 
   // -- copy surf --> sub
   if (newly_modified) {
-    CopySurfaceToSubsurface(*u->SubVector(1)->Data(), u->SubVector(0)->Data().ptr());
+    surf_sub_map_->CopySurfaceToSubsurface(*u->SubVector(1)->Data(), u->SubVector(0)->Data().ptr());
   }
 
   // Calculate consistent surface faces
@@ -276,8 +278,8 @@ MPCCoupledWater::ModifyCorrection(double h, Teuchos::RCP<const TreeVector> res,
     // }
 
     // Copy subsurface face corrections to surface cell corrections
-    CopySubsurfaceToSurface(*du->SubVector(0)->Data(),
-                            du->SubVector(1)->Data().ptr());
+    surf_sub_map_->CopySubsurfaceToSurface(*du->SubVector(0)->Data(),
+                                           du->SubVector(1)->Data().ptr());
   }
 
   // if (modified) {
@@ -41,6 +41,7 @@ surface equations are directly assembled into the subsurface discrete operator.
 
 #include "Operator.hh"
 #include "mpc_delegate_water.hh"
+#include "mpc_surface_subsurface_helpers.hh"
 #include "pk_physical_bdf_default.hh"
 
 #include "strong_mpc.hh"
@@ -98,6 +99,7 @@ class MPCCoupledWater : public StrongMPC<PK_PhysicalBDF_Default> {
   // sub meshes
   Teuchos::RCP<const AmanziMesh::Mesh> domain_mesh_;
   Teuchos::RCP<const AmanziMesh::Mesh> surf_mesh_;
+  Teuchos::RCP<SurfaceSubsurfaceFaceMap> surf_sub_map_;
 
   // coupled preconditioner
   Teuchos::RCP<Operators::Operator> precon_;
@@ -10,6 +10,7 @@ energy/water-content space instead of temperature/pressure space.
 ------------------------------------------------------------------------- */
 #include "FieldEvaluator.hh"
 #include "ewc_model.hh"
+#include "parallel_for.hh"
 #include "mpc_delegate_ewc.hh"
 
 namespace Amanzi {
@@ -127,6 +128,19 @@ void MPCDelegateEWC::initialize(const Teuchos::Ptr<State>& S) {
 
   // initialize the model, which grabs all needed models from state
   model_->InitializeModel(S, *plist_);
+
+  // per-thread copies of the model for the cell loops
+  int nthreads = plist_->get<int>("number of threads", 1);
+  if (nthreads < 1) {
+    Errors::Message message;
+    message << "EWC Delegate: \"number of threads\" must be positive, not " << nthreads;
+    Exceptions::amanzi_throw(message);
+  }
+#ifdef _OPENMP
+  if (nthreads > 1) {
+    for (int i=0; i!=nthreads; ++i) thread_models_.push_back(model_->Clone());
+  }
+#endif
 }
 
 
@@ -236,4 +250,59 @@ void MPCDelegateEWC::update_precon_ewc_(double t, Teuchos::RCP<const TreeVector>
   }
 }
 
+// -----------------------------------------------------------------------------
+// Apply a cell-wise operation to all owned cells.
+//
+// Cells are independent, so with multiple threads the loop is split across
+// threads, each using its own copy of the model.  Cells being debugged are
+// skipped in the threaded loop and done serially afterward, so that their
+// output is not interleaved.
+// -----------------------------------------------------------------------------
+void MPCDelegateEWC::ForEachCell_(const Teuchos::Ptr<State>& S, int ncells,
+        const CellFunction& func) {
+  int rank = mesh_->get_comm()->MyPID();
+  bool debug = vo_->os_OK(Teuchos::VERB_EXTREME);
+  model_->UpdateModel(S);
+
+  if (thread_models_.empty()) {
+    for (int c=0; c!=ncells; ++c) {
+      Teuchos::RCP<VerboseObject> dcvo = Teuchos::null;
+      if (debug) dcvo = db_->GetVerboseObject(c, rank);
+      Teuchos::OSTab dctab = dcvo == Teuchos::null ? vo_->getOSTab() : dcvo->getOSTab();
+      func(c, *model_, dcvo);
+    }
+    return;
+  }
+
+  // find the debug cells
+  std::vector<int> debug_cells;
+  std::vector<Teuchos::RCP<VerboseObject> > debug_vos;
+  std::vector<char> is_debug;
+  if (debug) {
+    is_debug.resize(ncells, 0);
+    for (int c=0; c!=ncells; ++c) {
+      Teuchos::RCP<VerboseObject> dcvo = db_->GetVerboseObject(c, rank);
+      if (dcvo != Teuchos::null) {
+        is_debug[c] = 1;
+        debug_cells.push_back(c);
+        debug_vos.push_back(dcvo);
+      }
+    }
+  }
+
+  for (auto& model : thread_models_) model->UpdateModel(S);
+
+  // Models may throw Errors::CutTimeStep to request a smaller step, which
+  // ParallelFor rethrows with its type.
+  ParallelFor(ncells, thread_models_.size(), 64, [&](int c, int tid) {
+    if (debug && is_debug[c]) return;
+    func(c, *thread_models_[tid], Teuchos::null);
+  });
+
+  for (int i=0; i!=debug_cells.size(); ++i) {
+    Teuchos::OSTab dctab = debug_vos[i]->getOSTab();
+    func(debug_cells[i], *model_, debug_vos[i]);
+  }
+}
+
 } // namespace
@@ -72,6 +72,10 @@ provides the initial guess to the nonlinear solve.
     * `"energy key`" ``[string]`` **DOMAIN-energy**
     * `"cell volume key`" ``[string]`` **DOMAIN-cell_volume**
 
+    * `"number of threads`" ``[int]`` **1** Number of threads used in the
+      cell-wise predictor and preconditioner loops.  Each thread works on its
+      own copy of the EWC model.  Only used if ATS is built with OpenMP.
+
     INCLUDES
 
     - ``[debugger-spec]`` Uses a Debugger_
@@ -81,6 +85,8 @@ provides the initial guess to the nonlinear solve.
 #ifndef MPC_DELEGATE_EWC_HH_
 #define MPC_DELEGATE_EWC_HH_
 
+#include <functional>
+
 #include "VerboseObject.hh"
 #include "Debugger.hh"
 #include "Tensor.hh"
@@ -117,6 +123,10 @@ class MPCDelegateEWC {
 
   virtual void update_precon_ewc_(double t, Teuchos::RCP<const TreeVector> up, double h);
 
+  // Calls func on each owned cell, potentially in parallel.  func is given
+  // the model to use and the cell's debugging VerboseObject, if any.
+  typedef std::function<void(int, EWCModel&, const Teuchos::RCP<VerboseObject>&)> CellFunction;
+  void ForEachCell_(const Teuchos::Ptr<State>& S, int ncells, const CellFunction& func);
 
 
  protected:
@@ -126,6 +136,7 @@ class MPCDelegateEWC {
 
   // model
   Teuchos::RCP<EWCModel> model_;
+  std::vector<Teuchos::RCP<EWCModel> > thread_models_;
 
   enum PredictorType {
     PREDICTOR_NONE = 0,
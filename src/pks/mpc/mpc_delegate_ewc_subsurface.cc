@@ -79,14 +79,8 @@ bool MPCDelegateEWCSubsurface::modify_predictor_smart_ewc_(double h, Teuchos::RC
   const Epetra_MultiVector& cv = *S_next_->GetFieldData(cv_key_)
       ->ViewComponent("cell",false);
 
-  int rank = mesh_->get_comm()->MyPID();
   int ncells = wc0.MyLength();
-  for (int c=0; c!=ncells; ++c) {
-    Teuchos::RCP<VerboseObject> dcvo = Teuchos::null;
-    if (vo_->os_OK(Teuchos::VERB_EXTREME))
-      dcvo = db_->GetVerboseObject(c, rank);
-    Teuchos::OSTab dctab = dcvo == Teuchos::null ? vo_->getOSTab() : dcvo->getOSTab();
-
+  auto predict_cell = [&](int c, EWCModel& model, const Teuchos::RCP<VerboseObject>& dcvo) {
     AmanziGeometry::Point result(2);
     int ierr = 0;
 
@@ -113,9 +107,9 @@ bool MPCDelegateEWCSubsurface::modify_predictor_smart_ewc_(double h, Teuchos::RC
                   << "   Extrap wc,e: " << wc2[0][c] << ", " << e2[0][c] << std::endl
                   << "   Extrap p,T: " << pres_guess_c[0][c] << ", " << T_guess << std::endl;
 
-    model_->UpdateModel(S_next_.ptr(), c);
-    ierr = model_->Evaluate(T_guess, pres_guess_c[0][c],
-                            e_tmp, wc_tmp);
+    model.UpdateModel(c);
+    ierr = model.Evaluate(T_guess, pres_guess_c[0][c],
+                          e_tmp, wc_tmp);
     AMANZI_ASSERT(!ierr);
     bool ewc_completed = false;
 
@@ -128,24 +122,24 @@ bool MPCDelegateEWCSubsurface::modify_predictor_smart_ewc_(double h, Teuchos::RC
       if (dcvo != Teuchos::null && dcvo->os_OK(Teuchos::VERB_EXTREME))
           *dcvo->os() << "   decreasing temps..." << std::endl;
 
-      if (!model_->Freezing(T_guess + cusp_size_T_freezing_, p_guess)) {
+      if (!model.Freezing(T_guess + cusp_size_T_freezing_, p_guess)) {
         if (dcvo != Teuchos::null && dcvo->os_OK(Teuchos::VERB_EXTREME)) {
           *dcvo->os() << "   above freezing, keep T,p projections" << std::endl;
           double sl,si,sg;
-          model_->EvaluateSaturations(T_guess+cusp_size_T_freezing_, p_guess, sg, sl, si);
+          model.EvaluateSaturations(T_guess+cusp_size_T_freezing_, p_guess, sg, sl, si);
           *dcvo->os() << "   si,sl,sg = " << si << "," << sl << "," << sg << std::endl;
         }
 
         // pass, guesses are good
 
-      } else if (model_->Freezing(T_prev + cusp_size_T_freezing_, p_prev)) {
+      } else if (model.Freezing(T_prev + cusp_size_T_freezing_, p_prev)) {
         if (dcvo != Teuchos::null && dcvo->os_OK(Teuchos::VERB_EXTREME))
           *dcvo->os() << "   second point past the freezing point, keep T,p projections" << std::endl;
         // pass, guesses are good
 
       } else {
         // -- invert for T,p at the projected ewc
-        ierr = model_->InverseEvaluate(e2[0][c]/cv[0][c], wc2[0][c]/cv[0][c], T, p);
+        ierr = model.InverseEvaluate(e2[0][c]/cv[0][c], wc2[0][c]/cv[0][c], T, p);
         ewc_completed = true;
         if (ierr) {
           if (dcvo != Teuchos::null && dcvo->os_OK(Teuchos::VERB_EXTREME))
@@ -171,18 +165,18 @@ bool MPCDelegateEWCSubsurface::modify_predictor_smart_ewc_(double h, Teuchos::RC
       if (dcvo != Teuchos::null && dcvo->os_OK(Teuchos::VERB_EXTREME))
         *dcvo->os() << "   increasing temps..." << std::endl;
 
-      if (!model_->Freezing(T_prev + cusp_size_T_thawing_, p_prev)) {
+      if (!model.Freezing(T_prev + cusp_size_T_thawing_, p_prev)) {
         if (dcvo != Teuchos::null && dcvo->os_OK(Teuchos::VERB_EXTREME))
           *dcvo->os() << "   above freezing, keep T,p projections" << std::endl;
         // pass, guesses are good
-      } else if (model_->Freezing(T_guess, p_guess)) {
+      } else if (model.Freezing(T_guess, p_guess)) {
         if (dcvo != Teuchos::null && dcvo->os_OK(Teuchos::VERB_EXTREME))
           *dcvo->os() << "   projection below freezing, keep T,p projections" << std::endl;
         // pass, guesses are good
 
       } else {
         // in the transition zone of latent heat exchange
-        ierr = model_->InverseEvaluate(e2[0][c]/cv[0][c], wc2[0][c]/cv[0][c], T, p);
+        ierr = model.InverseEvaluate(e2[0][c]/cv[0][c], wc2[0][c]/cv[0][c], T, p);
         ewc_completed = true;
         if (ierr) {
           if (dcvo != Teuchos::null && dcvo->os_OK(Teuchos::VERB_EXTREME))
@@ -229,7 +223,7 @@ bool MPCDelegateEWCSubsurface::modify_predictor_smart_ewc_(double h, Teuchos::RC
 
         } else {
           // -- invert for T,p at the projected ewc
-          ierr = model_->InverseEvaluate(e2[0][c]/cv[0][c], wc2[0][c]/cv[0][c], T, p);
+          ierr = model.InverseEvaluate(e2[0][c]/cv[0][c], wc2[0][c]/cv[0][c], T, p);
           if (ierr) {
             if (dcvo != Teuchos::null && dcvo->os_OK(Teuchos::VERB_EXTREME))
               *dcvo->os() << "FAILED EWC PREDICTOR" << std::endl;
@@ -266,7 +260,7 @@ bool MPCDelegateEWCSubsurface::modify_predictor_smart_ewc_(double h, Teuchos::RC
 
         } else {
           // in the transition zone of latent heat exchange
-          ierr = model_->InverseEvaluate(e2[0][c]/cv[0][c], wc2[0][c]/cv[0][c], T, p);
+          ierr = model.InverseEvaluate(e2[0][c]/cv[0][c], wc2[0][c]/cv[0][c], T, p);
           if (ierr) {
             if (dcvo != Teuchos::null && dcvo->os_OK(Teuchos::VERB_EXTREME))
               *dcvo->os() << "FAILED EWC PREDICTOR" << std::endl;
@@ -294,8 +288,8 @@ bool MPCDelegateEWCSubsurface::modify_predictor_smart_ewc_(double h, Teuchos::RC
       }
     }
 #endif
-
-  }
+  };
+  ForEachCell_(S_next_.ptr(), ncells, predict_cell);
   return true;
 }
 
@@ -331,23 +325,15 @@ void MPCDelegateEWCSubsurface::precon_ewc_(Teuchos::RCP<const TreeVector> u,
   double dT_min = 0.01;
   double dp_min = 100.;
 
-  int rank = mesh_->get_comm()->MyPID();
   int ncells = cv.MyLength();
-  for (int c=0; c!=ncells; ++c) {
-
-    // debugger
-    Teuchos::RCP<VerboseObject> dcvo = Teuchos::null;
-    if (vo_->os_OK(Teuchos::VERB_EXTREME))
-      dcvo = db_->GetVerboseObject(c, rank);
-    Teuchos::OSTab dctab = dcvo == Teuchos::null ? vo_->getOSTab() : dcvo->getOSTab();
-
+  auto precon_cell = [&](int c, EWCModel& model, const Teuchos::RCP<VerboseObject>& dcvo) {
     double T_prev = T_old[0][c];
     double T_std = T_prev - dT_std[0][c];
     double p_prev = p_old[0][c];
     double p_std = p_prev - dp_std[0][c];
     bool precon_ewc = false;
 
-    model_->UpdateModel(S_next_.ptr(), c);
+    model.UpdateModel(c);
     bool ewc_completed = false;
 
     if (dcvo != Teuchos::null && dcvo->os_OK(Teuchos::VERB_EXTREME))
@@ -361,12 +347,12 @@ void MPCDelegateEWCSubsurface::precon_ewc_(Teuchos::RCP<const TreeVector> u,
         if (dcvo != Teuchos::null && dcvo->os_OK(Teuchos::VERB_EXTREME))
           *dcvo->os() << "   decreasing temps..." << std::endl;
 
-        if (!model_->Freezing(T_std, p_std)) {
+        if (!model.Freezing(T_std, p_std)) {
           if (dcvo != Teuchos::null && dcvo->os_OK(Teuchos::VERB_EXTREME))
             *dcvo->os() << "   above freezing, keep std correction" << std::endl;
           // pass, guesses are good
 
-        } else if (model_->Freezing(T_prev, p_prev)) {
+        } else if (model.Freezing(T_prev, p_prev)) {
           if (dcvo != Teuchos::null && dcvo->os_OK(Teuchos::VERB_EXTREME))
             *dcvo->os() << "   linearization point past the freezing point, keep std correction" << std::endl;
           // pass, guesses are good
@@ -393,7 +379,7 @@ void MPCDelegateEWCSubsurface::precon_ewc_(Teuchos::RCP<const TreeVector> u,
 
           // -- invert for T,p at the projected ewc
           double T(T_prev), p(p_old[0][c]);
-          int ierr = model_->InverseEvaluate(e_ewc/cv[0][c], wc_ewc/cv[0][c], T, p, verbose);
+          int ierr = model.InverseEvaluate(e_ewc/cv[0][c], wc_ewc/cv[0][c], T, p, verbose);
           ewc_completed = true;
           if (ierr) {
             if (dcvo != Teuchos::null && dcvo->os_OK(Teuchos::VERB_EXTREME))
@@ -427,12 +413,12 @@ void MPCDelegateEWCSubsurface::precon_ewc_(Teuchos::RCP<const TreeVector> u,
         if (dcvo != Teuchos::null && dcvo->os_OK(Teuchos::VERB_EXTREME))
           *dcvo->os() << "   increasing temps..." << std::endl;
 
-        if (!model_->Freezing(T_prev, p_prev)) {
+        if (!model.Freezing(T_prev, p_prev)) {
           if (dcvo != Teuchos::null && dcvo->os_OK(Teuchos::VERB_EXTREME))
             *dcvo->os() << "   above freezing, keep std correction" << std::endl;
           // pass, update is are good
 
-        } else if (model_->Freezing(T_std, p_std)) {
+        } else if (model.Freezing(T_std, p_std)) {
           if (dcvo != Teuchos::null && dcvo->os_OK(Teuchos::VERB_EXTREME))
             *dcvo->os() << "   still frozen, keep std correction" << std::endl;
           // pass, update is are good
@@ -453,7 +439,7 @@ void MPCDelegateEWCSubsurface::precon_ewc_(Teuchos::RCP<const TreeVector> u,
 
           // -- invert for T,p at the projected ewc
           double T(T_prev), p(p_old[0][c]);
-          int ierr = model_->InverseEvaluate(e_ewc/cv[0][c], wc_ewc/cv[0][c], T, p);
+          int ierr = model.InverseEvaluate(e_ewc/cv[0][c], wc_ewc/cv[0][c], T, p);
           ewc_completed = true;
 
           if (ierr) {
@@ -528,7 +514,7 @@ void MPCDelegateEWCSubsurface::precon_ewc_(Teuchos::RCP<const TreeVector> u,
 
             // -- invert for T,p at the projected ewc
             double T(T_prev), p(p_old[0][c]);
-            int ierr = model_->InverseEvaluate(e_ewc/cv[0][c], wc_ewc/cv[0][c], T, p, verbose);
+            int ierr = model.InverseEvaluate(e_ewc/cv[0][c], wc_ewc/cv[0][c], T, p, verbose);
             ewc_completed = true;
             if (ierr) {
               if (dcvo != Teuchos::null && dcvo->os_OK(Teuchos::VERB_EXTREME))
@@ -588,7 +574,7 @@ void MPCDelegateEWCSubsurface::precon_ewc_(Teuchos::RCP<const TreeVector> u,
 
             // -- invert for T,p at the projected ewc
             double T(T_prev), p(p_old[0][c]);
-            int ierr = model_->InverseEvaluate(e_ewc/cv[0][c], wc_ewc/cv[0][c], T, p);
+            int ierr = model.InverseEvaluate(e_ewc/cv[0][c], wc_ewc/cv[0][c], T, p);
 
             if (ierr) {
               ewc_completed = true;
@@ -627,7 +613,8 @@ void MPCDelegateEWCSubsurface::precon_ewc_(Teuchos::RCP<const TreeVector> u,
       }
 #endif
     }
-  }
+  };
+  ForEachCell_(S_next_.ptr(), ncells, precon_cell);
 }
 
 } // namespace
@@ -74,14 +74,8 @@ bool MPCDelegateEWCSurface::modify_predictor_smart_ewc_(double h, Teuchos::RCP<T
   const Epetra_MultiVector& cv = *S_next_->GetFieldData(cv_key_)
       ->ViewComponent("cell",false);
 
-  int rank = mesh_->get_comm()->MyPID();
   int ncells = wc0.MyLength();
-  for (int c=0; c!=ncells; ++c) {
-    Teuchos::RCP<VerboseObject> dcvo = Teuchos::null;
-    if (vo_->os_OK(Teuchos::VERB_EXTREME))
-      dcvo = db_->GetVerboseObject(c, rank);
-    Teuchos::OSTab dctab = dcvo == Teuchos::null ? vo_->getOSTab() : dcvo->getOSTab();
-
+  auto predict_cell = [&](int c, EWCModel& model, const Teuchos::RCP<VerboseObject>& dcvo) {
     AmanziGeometry::Point result(2);
     int ierr = 0;
 
@@ -103,9 +97,9 @@ bool MPCDelegateEWCSurface::modify_predictor_smart_ewc_(double h, Teuchos::RCP<T
                   << "   Extrap wc,e: " << wc2[0][c] << ", " << e2[0][c] << std::endl
                   << "   Extrap p,T: " << pres_guess_c[0][c] << ", " << T_guess << std::endl;
 
-    model_->UpdateModel(S_next_.ptr(), c);
-    ierr = model_->Evaluate(T_guess, pres_guess_c[0][c],
-                            e_tmp, wc_tmp);
+    model.UpdateModel(c);
+    ierr = model.Evaluate(T_guess, pres_guess_c[0][c],
+                          e_tmp, wc_tmp);
     AMANZI_ASSERT(!ierr);
 
     if (dcvo != Teuchos::null && dcvo->os_OK(Teuchos::VERB_EXTREME))
@@ -126,7 +120,7 @@ bool MPCDelegateEWCSurface::modify_predictor_smart_ewc_(double h, Teuchos::RCP<T
         // pass, guesses are good
       } else {
         // -- invert for T,p at the projected ewc
-        ierr = model_->InverseEvaluate(e2[0][c]/cv[0][c], wc2[0][c]/cv[0][c], T, p);
+        ierr = model.InverseEvaluate(e2[0][c]/cv[0][c], wc2[0][c]/cv[0][c], T, p);
         if (ierr) {
           if (dcvo != Teuchos::null && dcvo->os_OK(Teuchos::VERB_EXTREME))
               *dcvo->os() << "FAILED EWC PREDICTOR" << std::endl;
@@ -155,7 +149,7 @@ bool MPCDelegateEWCSurface::modify_predictor_smart_ewc_(double h, Teuchos::RCP<T
         // pass, guesses are good
       } else {
         // in the transition zone of latent heat exchange
-        ierr = model_->InverseEvaluate(e2[0][c]/cv[0][c], wc2[0][c]/cv[0][c], T, p);
+        ierr = model.InverseEvaluate(e2[0][c]/cv[0][c], wc2[0][c]/cv[0][c], T, p);
         if (ierr) {
           if (dcvo != Teuchos::null && dcvo->os_OK(Teuchos::VERB_EXTREME))
             *dcvo->os() << "FAILED EWC PREDICTOR" << std::endl;
@@ -168,7 +162,8 @@ bool MPCDelegateEWCSurface::modify_predictor_smart_ewc_(double h, Teuchos::RCP<T
         }
       }
     }
-  }
+  };
+  ForEachCell_(S_next_.ptr(), ncells, predict_cell);
   return true;
 }
 
@@ -203,16 +198,8 @@ void MPCDelegateEWCSurface::precon_ewc_(Teuchos::RCP<const TreeVector> u,
   double dT_min = 0.01;
   double dp_min = 100.;
 
-  int rank = mesh_->get_comm()->MyPID();
   int ncells = cv.MyLength();
-  for (int c=0; c!=ncells; ++c) {
-
-    // debugger
-    Teuchos::RCP<VerboseObject> dcvo = Teuchos::null;
-    if (vo_->os_OK(Teuchos::VERB_EXTREME))
-      dcvo = db_->GetVerboseObject(c, rank);
-    Teuchos::OSTab dctab = dcvo == Teuchos::null ? vo_->getOSTab() : dcvo->getOSTab();
-
+  auto precon_cell = [&](int c, EWCModel& model, const Teuchos::RCP<VerboseObject>& dcvo) {
     double T_prev = T_old[0][c];
     double T_std = T_prev - dT_std[0][c];
     bool precon_ewc = false;
@@ -221,7 +208,7 @@ void MPCDelegateEWCSurface::precon_ewc_(Teuchos::RCP<const TreeVector> u,
       *dcvo->os() << "Precon: sc = " << c << std::endl;
 
     // only do EWC if corrections are large, ie not clearly converging
-    model_->UpdateModel(S_next_.ptr(), c);
+    model.UpdateModel(c);
     if (std::abs(dT_std[0][c]) > dT_min || std::abs(dp_std[0][c]) > dp_min) {
       if (-dT_std[0][c] < 0.) {  // decreasing, freezing
         if (dcvo != Teuchos::null && dcvo->os_OK(Teuchos::VERB_EXTREME))
@@ -248,7 +235,7 @@ void MPCDelegateEWCSurface::precon_ewc_(Teuchos::RCP<const TreeVector> u,
 
           // -- invert for T,p at the projected ewc
           double T(T_prev), p(p_old[0][c]);
-          int ierr = model_->InverseEvaluate(e_ewc/cv[0][c], wc_ewc/cv[0][c],
+          int ierr = model.InverseEvaluate(e_ewc/cv[0][c], wc_ewc/cv[0][c],
                   T, p);
           if (ierr) {
             if (dcvo != Teuchos::null && dcvo->os_OK(Teuchos::VERB_EXTREME))
@@ -311,7 +298,7 @@ void MPCDelegateEWCSurface::precon_ewc_(Teuchos::RCP<const TreeVector> u,
 
             // -- invert for T,p at the projected ewc
             double T(T_prev), p(p_old[0][c]);
-            int ierr = model_->InverseEvaluate(e_ewc/cv[0][c], wc_ewc/cv[0][c],
+            int ierr = model.InverseEvaluate(e_ewc/cv[0][c], wc_ewc/cv[0][c],
                     T, p);
 
             if (!ierr && T < 273.15) {
@@ -343,7 +330,8 @@ void MPCDelegateEWCSurface::precon_ewc_(Teuchos::RCP<const TreeVector> u,
         }
       }
     }
-  }
+  };
+  ForEachCell_(S_next_.ptr(), ncells, precon_cell);
 }
 
 } // namespace
@@ -93,33 +93,24 @@ MPCDelegateWater::ModifyCorrection_WaterSpurtDamp(double h, Teuchos::RCP<const T
         Teuchos::RCP<const TreeVector> u, Teuchos::RCP<TreeVector> Pu) {
   const double& patm = *S_next_->GetScalarData("atmospheric_pressure");
 
-  std::string face_entity;
-  if (Pu->SubVector(i_domain_)->Data()->HasComponent("face")){
-    face_entity = "face";
-  } else if (Pu->SubVector(i_domain_)->Data()->HasComponent("boundary_face")) {
-    face_entity = "boundary_face";
-  } else {
-    Errors::Message message("Subsurface vector does not have face component.");
-    Exceptions::amanzi_throw(message);
-  }
-
   Teuchos::RCP<const AmanziMesh::Mesh> surf_mesh =
       u->SubVector(i_surf_)->Data()->Mesh();
-  int ncells_surf = surf_mesh->num_entities(AmanziMesh::CELL, AmanziMesh::Parallel_type::OWNED);
 
   Teuchos::RCP<const CompositeVector> domain_u = u->SubVector(i_domain_)->Data();
   Teuchos::RCP<CompositeVector> domain_Pu = Pu->SubVector(i_domain_)->Data();
-  Epetra_MultiVector& domain_Pu_c = *domain_Pu->ViewComponent("cell", false);
+
+  std::string face_entity;
+  const std::vector<int>& faces = face_map_->FaceIndices(*domain_Pu, face_entity);
+  const Epetra_MultiVector& domain_u_f = *domain_u->ViewComponent(face_entity, false);
   Epetra_MultiVector& domain_Pu_f = *domain_Pu->ViewComponent(face_entity, false);
+  int ncells_surf = faces.size();
 
   // Approach 2
   double damp = 1.;
   if (damp_the_spurt_) {
     for (int cs=0; cs!=ncells_surf; ++cs) {
-      AmanziMesh::Entity_ID f =
-          surf_mesh->entity_get_parent(AmanziMesh::CELL, cs);
-      double p_old = GetDomainFaceValue(*u->SubVector(i_domain_)->Data(), f);
-      double p_Pu = GetDomainFaceValue(*Pu->SubVector(i_domain_)->Data(), f);
+      double p_old = domain_u_f[0][faces[cs]];
+      double p_Pu = domain_Pu_f[0][faces[cs]];
       double p_new = p_old - p_Pu;
       if ((p_new > patm + cap_size_) && (p_old < patm)) {
         double my_damp = ((patm + cap_size_) - p_old) / (p_new - p_old);
@@ -150,23 +141,28 @@ MPCDelegateWater::ModifyCorrection_WaterSpurtCap(double h, Teuchos::RCP<const Tr
 
   Teuchos::RCP<const AmanziMesh::Mesh> surf_mesh =
       u->SubVector(i_surf_)->Data()->Mesh();
-  int ncells_surf = surf_mesh->num_entities(AmanziMesh::CELL, AmanziMesh::Parallel_type::OWNED);
 
   Teuchos::RCP<const CompositeVector> domain_u = u->SubVector(i_domain_)->Data();
   Teuchos::RCP<CompositeVector> domain_Pu = Pu->SubVector(i_domain_)->Data();
 
+  std::string face_entity;
+  const std::vector<int>& faces = face_map_->FaceIndices(*domain_Pu, face_entity);
+  const Epetra_MultiVector& domain_u_f = *domain_u->ViewComponent(face_entity, false);
+  Epetra_MultiVector& domain_Pu_f = *domain_Pu->ViewComponent(face_entity, false);
+  int ncells_surf = faces.size();
+
   // Approach 3
   int n_modified = 0;
   if (cap_the_spurt_) {
     for (int cs=0; cs!=ncells_surf; ++cs) {
-      AmanziMesh::Entity_ID f = surf_mesh->entity_get_parent(AmanziMesh::CELL, cs);
+      AmanziMesh::Entity_ID f = face_map_->faces()[cs];
 
-      double p_old = GetDomainFaceValue(*u->SubVector(i_domain_)->Data(), f);
-      double p_Pu = GetDomainFaceValue(*Pu->SubVector(i_domain_)->Data(), f);
+      double p_old = domain_u_f[0][faces[cs]];
+      double p_Pu = domain_Pu_f[0][faces[cs]];
       double p_new = p_old - p_Pu / damp;
       if ((p_new > patm + cap_size_) && (p_old < patm)) {
         double p_corrected = p_old - (patm + cap_size_);
-        SetDomainFaceValue(*domain_Pu, f, p_corrected);
+        domain_Pu_f[0][faces[cs]] = p_corrected;
 
         n_modified++;
         if (vo_->os_OK(Teuchos::VERB_HIGH))
@@ -278,16 +274,15 @@ MPCDelegateWater::ModifyPredictor_Heuristic(double h, const Teuchos::RCP<TreeVec
     Epetra_MultiVector& surf_u_c =
         *u->SubVector(i_surf_)->Data()->ViewComponent("cell",false);
 
-    Teuchos::RCP<const AmanziMesh::Mesh> surf_mesh =
-        u->SubVector(i_surf_)->Data()->Mesh();
+    std::string face_entity;
+    const std::vector<int>& faces = face_map_->FaceIndices(*domain_u, face_entity);
+    Epetra_MultiVector& domain_u_f = *domain_u->ViewComponent(face_entity,false);
 
     const Epetra_MultiVector& surf_u_prev_c =
         *S_inter_->GetFieldData("surface_pressure")->ViewComponent("cell",false);
     const double& patm = *S_next_->GetScalarData("atmospheric_pressure");
     int ncells = surf_u_c.MyLength();
     for (int c=0; c!=ncells; ++c) {
-      int f = surf_mesh->entity_get_parent(AmanziMesh::CELL, c);
-
       double dp = surf_u_c[0][c] - surf_u_prev_c[0][c];
       double pnew = surf_u_c[0][c] - patm;
       double pold = surf_u_prev_c[0][c] - patm;
@@ -298,14 +293,14 @@ MPCDelegateWater::ModifyPredictor_Heuristic(double h, const Teuchos::RCP<TreeVec
             *vo_->os() << "CHANGING (first over?): p = " << surf_u_c[0][c]
                        << " to " << patm + cap_size_ << std::endl;
           surf_u_c[0][c] = patm + cap_size_;
-          SetDomainFaceValue(*domain_u, f, surf_u_c[0][c]);
+          domain_u_f[0][faces[c]] = surf_u_c[0][c];
 
         } else if (pold > 0 && dp > pold) {
           if (vo_->os_OK(Teuchos::VERB_HIGH))
             *vo_->os() << "CHANGING (second over?): p = " << surf_u_c[0][c]
                        << " to " << patm + 2*pold << std::endl;
           surf_u_c[0][c] = patm + 2*pold;
-          SetDomainFaceValue(*domain_u, f, surf_u_c[0][c]);
+          domain_u_f[0][faces[c]] = surf_u_c[0][c];
         }
       }
     }
@@ -339,13 +334,17 @@ MPCDelegateWater::ModifyPredictor_WaterSpurtDamp(double h,
 
     Teuchos::RCP<const CompositeVector> domain_pold = S_inter_->GetFieldData(key_ss);
 
+    std::string face_entity;
+    const std::vector<int>& faces_old = face_map_->FaceIndices(*domain_pold, face_entity);
+    const Epetra_MultiVector& domain_pold_f = *domain_pold->ViewComponent(face_entity,false);
+    const std::vector<int>& faces = face_map_->FaceIndices(*domain_pnew, face_entity);
+    Epetra_MultiVector& domain_pnew_f = *domain_pnew->ViewComponent(face_entity,false);
+
     int rank = surf_mesh->get_comm()->MyPID();
     double damp = 1.;
     for (unsigned int cs=0; cs!=ncells_surf; ++cs) {
-      AmanziMesh::Entity_ID f =
-          surf_mesh->entity_get_parent(AmanziMesh::CELL, cs);
-      double p_old = GetDomainFaceValue(*domain_pold, f);
-      double p_new = GetDomainFaceValue(*domain_pnew, f);
+      double p_old = domain_pold_f[0][faces_old[cs]];
+      double p_new = domain_pnew_f[0][faces[cs]];
       if ((p_new > patm + cap_size_) && (p_old < patm)) {
         // first over
         double my_damp = ((patm + cap_size_) - p_old) / (p_new - p_old);
@@ -362,13 +361,7 @@ MPCDelegateWater::ModifyPredictor_WaterSpurtDamp(double h,
     }
 
     double proc_damp = damp;
-    if (domain_pnew->HasComponent("face")){
-      Epetra_MultiVector& domain_pnew_f = *domain_pnew -> ViewComponent("face",false);
-      domain_pnew_f.Comm().MinAll(&proc_damp, &damp, 1);
-    } else if (domain_pnew->HasComponent("boundary face")){
-      Epetra_MultiVector& domain_pnew_f = *domain_pnew -> ViewComponent("boundary face",false);
-      domain_pnew_f.Comm().MinAll(&proc_damp, &damp, 1);
-    }
+    domain_pnew_f.Comm().MinAll(&proc_damp, &damp, 1);
 
     if (damp < 1.0) {
       if (vo_->os_OK(Teuchos::VERB_HIGH))
@@ -382,28 +375,26 @@ MPCDelegateWater::ModifyPredictor_WaterSpurtDamp(double h,
 
       // undamp and cap the surface
       for (unsigned int cs=0; cs!=ncells_surf; ++cs) {
-        AmanziMesh::Entity_ID f =
-            surf_mesh->entity_get_parent(AmanziMesh::CELL, cs);
-        double p_old = GetDomainFaceValue(*domain_pnew, f);;
-        double p_new = GetDomainFaceValue(*domain_pnew, f);
+        double p_old = domain_pnew_f[0][faces[cs]];
+        double p_new = domain_pnew_f[0][faces[cs]];
         p_new = (p_new - p_old) / damp + p_old;
         if ((p_new > patm + cap_size_) && (p_old < patm)) {
           // first over
           double new_value = patm + cap_size_;
-          SetDomainFaceValue(*domain_pnew, f, new_value);
+          domain_pnew_f[0][faces[cs]] = new_value;
           surf_pnew_c[0][cs] = patm + new_value;
           if (vo_->os_OK(Teuchos::VERB_HIGH))
             std::cout << "  CAPPING THE SPURT (1st over) (sc=" << surf_mesh->cell_map(false).GID(cs) << "): p_old = " << p_old << ", p_new = " << p_new << ", p_capped = " << new_value << std::endl;
         } else if ((p_old > patm) && (p_new - p_old > p_old - patm)) {
           // second over
           double new_value = patm + 2*(p_old - patm);
-          SetDomainFaceValue(*domain_pnew, f, new_value);
+          domain_pnew_f[0][faces[cs]] = new_value;
           surf_pnew_c[0][cs] = new_value;
 
           if (vo_->os_OK(Teuchos::VERB_HIGH))
             std::cout << "  CAPPING THE SPURT (2nd over) (sc=" << surf_mesh->cell_map(false).GID(cs) << "): p_old = " << p_old << ", p_new = " << p_new << ", p_capped = " << new_value << std::endl;
         } else {
-          surf_pnew_c[0][cs] = GetDomainFaceValue(*domain_pnew, f);
+          surf_pnew_c[0][cs] = domain_pnew_f[0][faces[cs]];
         }
       }
     }
@@ -443,17 +434,16 @@ MPCDelegateWater::ModifyPredictor_TempFromSource(double h, const Teuchos::RCP<Tr
     const Epetra_MultiVector& dhsource = *S_inter_->GetFieldData("surface_water_source")
         ->ViewComponent("cell",false);
 
-    Teuchos::RCP<const AmanziMesh::Mesh> surf_mesh =
-        u->SubVector(i_surf_)->Data()->Mesh();
+    std::string face_entity;
+    const std::vector<int>& faces = face_map_->FaceIndices(*domain_pnew, face_entity);
+    Epetra_MultiVector& domain_pnew_f = *domain_pnew->ViewComponent(face_entity,false);
 
     for (unsigned int c=0; c!=surf_Tnew_c.MyLength(); ++c) {
       if (surf_Tnew_c[0][c] < 271.15) {
         // frozen, modify predictor to ensure surface is ready to accept ice
         if (surf_pnew_c[0][c] < 101325.) {
           surf_pnew_c[0][c] = 101325.1;
-          AmanziMesh::Entity_ID f =
-              surf_mesh->entity_get_parent(AmanziMesh::CELL, c);
-          SetDomainFaceValue(*domain_pnew, f, surf_pnew_c[0][c]);
+          domain_pnew_f[0][faces[c]] = surf_pnew_c[0][c];
         }
       }
     }
@@ -20,6 +20,8 @@
 #include "CompositeVector.hh"
 #include "State.hh"
 
+#include "mpc_surface_subsurface_helpers.hh"
+
 /*!
 
 The water delegate works to deal with discontinuities/strong nonlinearities
@@ -84,6 +86,11 @@ class MPCDelegateWater {
   MPCDelegateWater(const Teuchos::RCP<Teuchos::ParameterList>& plist, std::string domain=" ");
 
   void set_db(const Teuchos::RCP<Debugger>& db) { db_ = db; }
+
+  // the owning MPC's surface cell to subsurface face map
+  void set_face_map(const Teuchos::RCP<const SurfaceSubsurfaceFaceMap>& face_map) {
+    face_map_ = face_map;
+  }
   
   void
   set_states(const Teuchos::RCP<State>& S,
@@ -142,6 +149,7 @@ class MPCDelegateWater {
   Teuchos::RCP<Teuchos::ParameterList> plist_;
   Teuchos::RCP<VerboseObject> vo_;
   Teuchos::RCP<Debugger> db_;
+  Teuchos::RCP<const SurfaceSubsurfaceFaceMap> face_map_;
   
   // states
   Teuchos::RCP<State> S_next_;
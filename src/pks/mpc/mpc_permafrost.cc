@@ -78,6 +78,7 @@ MPCPermafrost::Setup(const Teuchos::Ptr<State>& S) {
   // grab the meshes
   surf_mesh_ = S->GetMesh(domain_surf_);
   domain_mesh_ = S->GetMesh(domain_subsurf_);
+  surf_sub_map_ = Teuchos::rcp(new SurfaceSubsurfaceFaceMap(surf_mesh_, domain_mesh_));
 
   // alias the PKs for easier reference
   domain_flow_pk_ = sub_pks_[0];
@@ -219,6 +220,7 @@ MPCPermafrost::Setup(const Teuchos::Ptr<State>& S) {
     water_ = Teuchos::rcp(new MPCDelegateWater(water_list, domain_subsurf_));
     water_->set_indices(0,2,1,3);
     water_->set_db(surf_db_);
+    water_->set_face_map(surf_sub_map_);
   }
 
   // create the surf EWC delegate
@@ -251,19 +253,19 @@ MPCPermafrost::Initialize(const Teuchos::Ptr<State>& S)
 
   // ensure continuity of ICs... surface takes precedence if it was initialized
   if (S->GetField(surf_pres_key_)->initialized()) {
-    CopySurfaceToSubsurface(*S->GetFieldData(surf_pres_key_, surf_flow_pk_->name()),
-                            S->GetFieldData(pres_key_, domain_flow_pk_->name()).ptr());
+    surf_sub_map_->CopySurfaceToSubsurface(*S->GetFieldData(surf_pres_key_, surf_flow_pk_->name()),
+                                           S->GetFieldData(pres_key_, domain_flow_pk_->name()).ptr());
   } else {
-    CopySubsurfaceToSurface(*S->GetFieldData(pres_key_, domain_flow_pk_->name()),
-                            S->GetFieldData(surf_pres_key_, surf_flow_pk_->name()).ptr());
+    surf_sub_map_->CopySubsurfaceToSurface(*S->GetFieldData(pres_key_, domain_flow_pk_->name()),
+                                           S->GetFieldData(surf_pres_key_, surf_flow_pk_->name()).ptr());
     S->GetField(surf_pres_key_, surf_flow_pk_->name())->set_initialized();
   }
   if (S->GetField(surf_temp_key_)->initialized()) {
-    CopySurfaceToSubsurface(*S->GetFieldData(surf_temp_key_, surf_energy_pk_->name()),
-                            S->GetFieldData(temp_key_, domain_energy_pk_->name()).ptr());
+    surf_sub_map_->CopySurfaceToSubsurface(*S->GetFieldData(surf_temp_key_, surf_energy_pk_->name()),
+                                           S->GetFieldData(temp_key_, domain_energy_pk_->name()).ptr());
   } else {
-    CopySubsurfaceToSurface(*S->GetFieldData(temp_key_, domain_energy_pk_->name()),
-                            S->GetFieldData(surf_temp_key_, surf_energy_pk_->name()).ptr());
+    surf_sub_map_->CopySubsurfaceToSurface(*S->GetFieldData(temp_key_, domain_energy_pk_->name()),
+                                           S->GetFieldData(surf_temp_key_, surf_energy_pk_->name()).ptr());
     S->GetField(surf_temp_key_, surf_energy_pk_->name())->set_initialized();
   }
 
@@ -392,10 +394,10 @@ int MPCPermafrost::ApplyPreconditioner(Teuchos::RCP<const TreeVector> r,
   Pr->SubVector(0)->Data()->Scale(1.e6);
 
   // Copy subsurface face corrections to surface cell corrections
-  CopySubsurfaceToSurface(*Pr->SubVector(0)->Data(),
-                          Pr->SubVector(2)->Data().ptr());
-  CopySubsurfaceToSurface(*Pr->SubVector(1)->Data(),
-                          Pr->SubVector(3)->Data().ptr());
+  surf_sub_map_->CopySubsurfaceToSurface(*Pr->SubVector(0)->Data(),
+                                         Pr->SubVector(2)->Data().ptr());
+  surf_sub_map_->CopySubsurfaceToSurface(*Pr->SubVector(1)->Data(),
+                                         Pr->SubVector(3)->Data().ptr());
 
   // dump to screen
   if (vo_->os_OK(Teuchos::VERB_HIGH)) {
@@ -582,8 +584,8 @@ MPCPermafrost::ModifyPredictor(double h, Teuchos::RCP<const TreeVector> u0,
     //S_next_->GetFieldEvaluator(Keys::getKey(domain_surf_,"relative_permeability"))->HasFieldChanged(S_next_.ptr(),name_);
     Teuchos::RCP<const CompositeVector> h_prev = S_inter_->GetFieldData(Keys::getKey(domain_surf_,"ponded_depth"));
 
-    MergeSubsurfaceAndSurfacePressure(*h_prev, u->SubVector(0)->Data().ptr(), u->SubVector(2)->Data().ptr());
-    CopySubsurfaceToSurface(*u->SubVector(1)->Data(), u->SubVector(3)->Data().ptr());
+    surf_sub_map_->MergeSubsurfaceAndSurfacePressure(*h_prev, u->SubVector(0)->Data().ptr(), u->SubVector(2)->Data().ptr());
+    surf_sub_map_->CopySubsurfaceToSurface(*u->SubVector(1)->Data(), u->SubVector(3)->Data().ptr());
 
   }
 
@@ -621,8 +623,8 @@ MPCPermafrost::ModifyPredictor(double h, Teuchos::RCP<const TreeVector> u0,
 
   // -- copy surf --> sub
   //  if (newly_modified) {
-  CopySurfaceToSubsurface(*u->SubVector(2)->Data(), u->SubVector(0)->Data().ptr());
-  CopySurfaceToSubsurface(*u->SubVector(3)->Data(), u->SubVector(1)->Data().ptr());
+  surf_sub_map_->CopySurfaceToSubsurface(*u->SubVector(2)->Data(), u->SubVector(0)->Data().ptr());
+  surf_sub_map_->CopySurfaceToSubsurface(*u->SubVector(3)->Data(), u->SubVector(1)->Data().ptr());
   //  }
 
   // Calculate consistent surface faces
@@ -663,10 +665,10 @@ MPCPermafrost::ModifyCorrection(double h, Teuchos::RCP<const TreeVector> r,
   AmanziSolvers::FnBaseDefs::ModifyCorrectionResult pk_modified =
       StrongMPC<PK_PhysicalBDF_Default>::ModifyCorrection(h,r,u,du);
   if (pk_modified) {
-    CopySurfaceToSubsurface(*du->SubVector(2)->Data(),
-                            du->SubVector(0)->Data().ptr());
-    CopySurfaceToSubsurface(*du->SubVector(3)->Data(),
-                            du->SubVector(1)->Data().ptr());
+    surf_sub_map_->CopySurfaceToSubsurface(*du->SubVector(2)->Data(),
+                                           du->SubVector(0)->Data().ptr());
+    surf_sub_map_->CopySurfaceToSubsurface(*du->SubVector(3)->Data(),
+                                           du->SubVector(1)->Data().ptr());
   }
 
   // modify correction using water approaches
@@ -690,8 +692,8 @@ MPCPermafrost::ModifyCorrection(double h, Teuchos::RCP<const TreeVector> r,
 
   if (modified) {
     // Copy subsurface face corrections to surface cell corrections
-    CopySubsurfaceToSurface(*du->SubVector(0)->Data(),
-                            du->SubVector(2)->Data().ptr());
+    surf_sub_map_->CopySubsurfaceToSurface(*du->SubVector(0)->Data(),
+                                           du->SubVector(2)->Data().ptr());
   }
 
   // dump modified correction to screen
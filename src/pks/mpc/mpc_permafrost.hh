@@ -96,6 +96,7 @@ class MPCPermafrost : public MPCSubsurface {
   Key domain_subsurf_;
   Teuchos::RCP<const AmanziMesh::Mesh> domain_mesh_;
   Teuchos::RCP<const AmanziMesh::Mesh> surf_mesh_;
+  Teuchos::RCP<SurfaceSubsurfaceFaceMap> surf_sub_map_;
 
   // Primary variable evaluators for exchange fluxes
   Key mass_exchange_key_;
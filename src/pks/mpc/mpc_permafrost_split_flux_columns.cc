@@ -106,6 +106,12 @@ void MPCPermafrostSplitFluxColumns::Setup(const Teuchos::Ptr<State>& S)
 {
   MPC<PK>::Setup(S);
 
+  // surface cell to subsurface face maps, one per column
+  for (const auto& col_domain : *S->GetDomainSet(domain_col_)) {
+    col_face_maps_.push_back(Teuchos::rcp(new SurfaceSubsurfaceFaceMap(
+        S->GetMesh("surface_"+col_domain), S->GetMesh(col_domain))));
+  }
+
   if (coupling_ != "pressure") {
     // require the coupling sources
     for (const auto& col_domain : *S->GetDomainSet(domain_col_)) {
@@ -283,9 +289,9 @@ MPCPermafrostSplitFluxColumns::CopyStarToPrimaryPressure_(double dt)
       AMANZI_ASSERT(eval_pv.get());
       eval_pv->SetFieldAsChanged(S_inter_.ptr());
 
-      CopySurfaceToSubsurface(*S_inter_->GetFieldData(pkey),
-              S_inter_->GetFieldData(Keys::getKey(*ds_iter, p_primary_variable_suffix_),
-                      S_inter_->GetField(Keys::getKey(*ds_iter, p_primary_variable_suffix_))->owner()).ptr());
+      col_face_maps_[c]->CopySurfaceToSubsurface(*S_inter_->GetFieldData(pkey),
+                                                 S_inter_->GetFieldData(Keys::getKey(*ds_iter, p_primary_variable_suffix_),
+                                                                        S_inter_->GetField(Keys::getKey(*ds_iter, p_primary_variable_suffix_))->owner()).ptr());
     }
     ++ds_iter;
   }
@@ -305,9 +311,9 @@ MPCPermafrostSplitFluxColumns::CopyStarToPrimaryPressure_(double dt)
     AMANZI_ASSERT(eval_pv.get());
     eval_pv->SetFieldAsChanged(S_inter_.ptr());
 
-    CopySurfaceToSubsurface(*S_inter_->GetFieldData(Tkey),
-                            S_inter_->GetFieldData(Keys::getKey(*ds_iter, T_primary_variable_suffix_),
-                                    S_inter_->GetField(Keys::getKey(*ds_iter, T_primary_variable_suffix_))->owner()).ptr());
+    col_face_maps_[c]->CopySurfaceToSubsurface(*S_inter_->GetFieldData(Tkey),
+                                               S_inter_->GetFieldData(Keys::getKey(*ds_iter, T_primary_variable_suffix_),
+                                                       S_inter_->GetField(Keys::getKey(*ds_iter, T_primary_variable_suffix_))->owner()).ptr());
     ++ds_iter;
   }
 }
@@ -399,12 +405,12 @@ MPCPermafrostSplitFluxColumns::CopyStarToPrimaryHybrid_(double dt)
       eval_tv->SetFieldAsChanged(S_inter_.ptr());
 
       // copy from surface to subsurface to ensure consistency
-      CopySurfaceToSubsurface(*S_inter_->GetFieldData(pkey),
-                              S_inter_->GetFieldData(Keys::getKey(*ds_iter, p_primary_variable_suffix_),
-                                                     S_inter_->GetField(Keys::getKey(*ds_iter, p_primary_variable_suffix_))->owner()).ptr());
-      CopySurfaceToSubsurface(*S_inter_->GetFieldData(Tkey),
-                              S_inter_->GetFieldData(Keys::getKey(*ds_iter, T_primary_variable_suffix_),
-                                                     S_inter_->GetField(Keys::getKey(*ds_iter, T_primary_variable_suffix_))->owner()).ptr());
+      col_face_maps_[c]->CopySurfaceToSubsurface(*S_inter_->GetFieldData(pkey),
+                                                 S_inter_->GetFieldData(Keys::getKey(*ds_iter, p_primary_variable_suffix_),
+                                                                        S_inter_->GetField(Keys::getKey(*ds_iter, p_primary_variable_suffix_))->owner()).ptr());
+      col_face_maps_[c]->CopySurfaceToSubsurface(*S_inter_->GetFieldData(Tkey),
+                                                 S_inter_->GetFieldData(Keys::getKey(*ds_iter, T_primary_variable_suffix_),
+                                                                        S_inter_->GetField(Keys::getKey(*ds_iter, T_primary_variable_suffix_))->owner()).ptr());
 
       // set the lateral flux to 0
       Key p_lf_key = Keys::getKey("surface_"+ (*ds_iter), p_lateral_flow_source_suffix_);
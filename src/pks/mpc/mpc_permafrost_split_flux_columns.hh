@@ -42,6 +42,7 @@ kappa grad T |_s = qE_ss
 #include "PK.hh"
 #include "mpc.hh"
 #include "primary_variable_field_evaluator.hh"
+#include "mpc_surface_subsurface_helpers.hh"
 
 namespace Amanzi {
 
@@ -102,6 +103,7 @@ class MPCPermafrostSplitFluxColumns : public MPC<PK> {
   Key cv_key_;
   std::vector<Teuchos::RCP<PrimaryVariableFieldEvaluator> > p_eval_pvfes_;
   std::vector<Teuchos::RCP<PrimaryVariableFieldEvaluator> > T_eval_pvfes_;
+  std::vector<Teuchos::RCP<SurfaceSubsurfaceFaceMap> > col_face_maps_;
   std::string coupling_;
 
   std::string domain_col_;
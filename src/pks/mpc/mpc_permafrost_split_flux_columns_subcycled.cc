@@ -7,8 +7,12 @@ Author: Ethan Coon
 
 ------------------------------------------------------------------------- */
 
+#include <cmath>
+#include <map>
+
 #include "primary_variable_field_evaluator.hh"
 #include "mpc_surface_subsurface_helpers.hh"
+#include "parallel_for.hh"
 
 #include "mpc_permafrost_split_flux_columns_subcycled.hh"
 
@@ -25,6 +29,17 @@ MPCPermafrostSplitFluxColumnsSubcycled::MPCPermafrostSplitFluxColumnsSubcycled(T
 {
   subcycled_timestep_type_ = plist_->get<std::string>("subcycling timestep type","surface star timestep");
   subcycled_target_time_ = plist_->get<double>("subcycling timestep target",3600);
+
+  num_threads_ = plist_->get<int>("number of column threads", 1);
+  if (num_threads_ < 1) {
+    Errors::Message msg;
+    msg << "MPCPermafrostSplitFluxColumnsSubcycled: \"number of column threads\" must be positive, not "
+        << num_threads_;
+    Exceptions::amanzi_throw(msg);
+  }
+#ifndef _OPENMP
+  num_threads_ = 1;
+#endif
 };
 
 double MPCPermafrostSplitFluxColumnsSubcycled::get_dt()
@@ -66,7 +81,6 @@ double MPCPermafrostSplitFluxColumnsSubcycled::get_dt()
 bool MPCPermafrostSplitFluxColumnsSubcycled::AdvanceStep(double t_old, double t_new, bool reinit)
 {
   Teuchos::OSTab tab = vo_->getOSTab();
-  int my_pid = S_next_->GetMesh("surface_star")->get_comm()->MyPID();
   // Advance the star system
   bool fail = false;
   if (vo_->os_OK(Teuchos::VERB_EXTREME))
@@ -128,77 +142,131 @@ bool MPCPermafrostSplitFluxColumnsSubcycled::AdvanceStep(double t_old, double t_
   CopyStarToPrimary(t_new - t_old);
 
   // Now advance the columns
+  AdvanceColumns_(t_old, t_new);
+  S_inter_->set_time(t_old);
+
+  // Copy the primary into the star to advance
+  CopyPrimaryToStar(S_next_.ptr(), S_next_.ptr());
+
+  // this can never fail without error, because we always subcycle to ensure
+  // the full timestep.
+  return false;
+}
+
+// -----------------------------------------------------------------------------
+// Subcycle all columns from t_old to t_new.
+//
+// PKs read the time and timestep from State, which is shared by all columns,
+// so columns are advanced in waves: each column requests its next step, and
+// columns requesting the same step from the same time are advanced together,
+// in parallel if threads are available.  Dynamic scheduling within a group
+// balances columns whose steps are more expensive.  When threaded, requested
+// steps are rounded down to (t_new - t_old) / 2^k so that columns stay on a
+// common grid of times and groups stay large.
+// -----------------------------------------------------------------------------
+void MPCPermafrostSplitFluxColumnsSubcycled::AdvanceColumns_(double t_old, double t_new)
+{
+  int my_pid = S_next_->GetMesh("surface_star")->get_comm()->MyPID();
+
+  std::vector<std::string> col_domains;
   const auto& col_domain_set = *S_->GetDomainSet(domain_col_);
-  auto ds_iter = col_domain_set.begin();
-  for (int i=1; i!=sub_pks_.size(); ++i) {
-    auto col_domain = *ds_iter;
-    double t_inner = t_old;
-    bool done = false;
-    if (vo_->os_OK(Teuchos::VERB_EXTREME))
-      *vo_->os() << "Beginning timestepping on " << col_domain << std::endl;
+  for (const auto& col_domain : col_domain_set) col_domains.push_back(col_domain);
+  int ncols = sub_pks_.size() - 1;
+  AMANZI_ASSERT(col_domains.size() == (std::size_t) ncols);
+
+  // aligned timesteps are integer numbers of ticks
+  const long ticks = 1L << 30;
+  double tick = (t_new - t_old) / ticks;
+  std::vector<long> pos(ncols, 0);
+  std::vector<double> t(ncols, t_old);
+
+  std::vector<int> active(ncols);
+  for (int i=0; i!=ncols; ++i) active[i] = i;
+
+  while (active.size() > 0) {
+    // group columns by their requested step
+    std::map<std::pair<double,double>, std::vector<int> > groups;
+    for (int i : active) {
+      double dt_inner = std::min(sub_pks_[i+1]->get_dt(), t_new - t[i]);
+      if (num_threads_ > 1) {
+        long step = ticks;
+        while (step > 1 && (step * tick > dt_inner || pos[i] % step != 0)) step /= 2;
+        dt_inner = step * tick;
+      }
+      groups[std::make_pair(t[i], dt_inner)].push_back(i);
+    }
+    active.clear();
+
+    for (auto& group : groups) {
+      double t_inner = group.first.first;
+      double dt_inner = group.first.second;
+      const std::vector<int>& cols = group.second;
 
-    S_inter_->set_time(t_old);
-    while (!done) {
-      double dt_inner = std::min(sub_pks_[i]->get_dt(), t_new - t_inner);
       *S_next_->GetScalarData("dt", "coordinator") = dt_inner;
+      S_inter_->set_time(t_inner);
       S_next_->set_time(t_inner + dt_inner);
-      bool fail_inner = sub_pks_[i]->AdvanceStep(t_inner, t_inner+dt_inner, false);
-      if (vo_->os_OK(Teuchos::VERB_EXTREME))
-        *vo_->os() << "  step failed? " << fail_inner << std::endl;
-      bool valid_inner = sub_pks_[i]->ValidStep();
-      if (vo_->os_OK(Teuchos::VERB_EXTREME)) {
-        *vo_->os() << "  step valid? " << valid_inner << std::endl;
-
-      // DEBUGGING
-      std::cout << col_domain << " (" << my_pid << ") Step: " << t_inner/86400.0 << " (" << dt_inner/86400.
-                << ") failed/!valid = " << fail_inner << "," << !valid_inner << std::endl;
-      // END DEBUGGING
-      }
-
-      if (fail_inner || !valid_inner) {
-        dt_inner = sub_pks_[i]->get_dt();
-        S_next_->AssignDomain(*S_inter_, col_domain);
-        S_next_->AssignDomain(*S_inter_, "surface_"+col_domain);
-        S_next_->AssignDomain(*S_inter_, "snow_"+col_domain);
-        S_next_->set_time(S_inter_->time());
-        S_next_->set_cycle(S_inter_->cycle());
+      S_next_->set_cycle(S_inter_->cycle());
 
+      std::vector<int> success(cols.size(), 0);
+      ParallelFor(cols.size(), num_threads_, 1, [&](int k, int tid) {
+          success[k] = AdvanceColumnStep_(cols[k], col_domains[cols[k]], t_inner, dt_inner);
+        });
+
+      for (int k=0; k!=cols.size(); ++k) {
+        int i = cols[k];
+        bool done = false;
+        if (success[k]) {
+          if (num_threads_ > 1) {
+            pos[i] += std::lround(dt_inner / tick);
+            t[i] = t_old + pos[i] * tick;
+          } else {
+            t[i] += dt_inner;
+          }
+          done = t[i] >= t_new - 1.e-10;
+        }
+
+        double dt_next = sub_pks_[i+1]->get_dt();
         if (vo_->os_OK(Teuchos::VERB_EXTREME))
-          *vo_->os() << "  failed, new timestep is " << dt_inner << std::endl;
-
-      } else {
-        sub_pks_[i]->CommitStep(t_inner, t_inner + dt_inner, S_next_);
-        t_inner += dt_inner;
-        if (t_inner >= t_new - 1.e-10) done = true;
-
-        S_inter_->AssignDomain(*S_next_, col_domain);
-        S_inter_->AssignDomain(*S_next_, "surface_"+col_domain);
-        S_inter_->AssignDomain(*S_next_, "snow_"+col_domain);
-        S_inter_->set_time(S_next_->time());
-        S_inter_->set_cycle(S_next_->cycle());
-        dt_inner = sub_pks_[i]->get_dt();
-        if (vo_->os_OK(Teuchos::VERB_EXTREME))
-          *vo_->os() << "  success, new timestep is " << dt_inner << std::endl;
-      }
-
-      if (dt_inner < 1.e-4) {
-        Errors::Message msg;
-        msg << "Column " << col_domain << " on PID " << my_pid << " crashing timestep in subcycling: dt = " << dt_inner;
-        Exceptions::amanzi_throw(msg);
+          *vo_->os() << "  " << col_domains[i] << (success[k] ? " success" : " failed")
+                     << ", new timestep is " << dt_next << std::endl;
+        if (dt_next < 1.e-4) {
+          Errors::Message msg;
+          msg << "Column " << col_domains[i] << " on PID " << my_pid << " crashing timestep in subcycling: dt = " << dt_next;
+          Exceptions::amanzi_throw(msg);
+        }
+        if (!done) active.push_back(i);
       }
     }
-    ++ds_iter;
   }
-  S_inter_->set_time(t_old);
+}
 
-  // Copy the primary into the star to advance
-  CopyPrimaryToStar(S_next_.ptr(), S_next_.ptr());
 
-  // this can never fail without error, because we always subcycle to ensure
-  // the full timestep.
-  return false;
+// -----------------------------------------------------------------------------
+// Attempt one step of column i, committing it on success and restoring the
+// column's data in S_next_ on failure.  Times are set by the caller.
+// -----------------------------------------------------------------------------
+bool MPCPermafrostSplitFluxColumnsSubcycled::AdvanceColumnStep_(int i,
+        const std::string& col_domain, double t_inner, double dt_inner)
+{
+  const auto& pk = sub_pks_[i+1];
+  bool fail_inner = pk->AdvanceStep(t_inner, t_inner+dt_inner, false);
+  bool valid_inner = pk->ValidStep();
+
+  if (fail_inner || !valid_inner) {
+    S_next_->AssignDomain(*S_inter_, col_domain);
+    S_next_->AssignDomain(*S_inter_, "surface_"+col_domain);
+    S_next_->AssignDomain(*S_inter_, "snow_"+col_domain);
+    return false;
+  }
+
+  pk->CommitStep(t_inner, t_inner + dt_inner, S_next_);
+  S_inter_->AssignDomain(*S_next_, col_domain);
+  S_inter_->AssignDomain(*S_next_, "surface_"+col_domain);
+  S_inter_->AssignDomain(*S_next_, "snow_"+col_domain);
+  return true;
 }
 
+
 bool MPCPermafrostSplitFluxColumnsSubcycled::ValidStep()
 {
   // this is always valid, because the inner steps were valid
@@ -33,6 +33,12 @@ dE_s / dt = (dE_s / dt)^* + QE_ext + h * Q_ext + qE_ss + h * q_ss
 dE / dt = div (  kappa grad T) + hq )
 kappa grad T |_s = qE_ss
 
+Columns are independent once the surface star system is advanced.  Setting
+"number of column threads" [int] (default 1) larger than one advances them on
+that many OpenMP threads.  This requires that column PKs and their evaluators
+do not share mutable data, and a Trilinos built with thread-safe Teuchos
+reference counting.
+
 
 ------------------------------------------------------------------------- */
 
@@ -67,10 +73,16 @@ class MPCPermafrostSplitFluxColumnsSubcycled : public MPCPermafrostSplitFluxColu
   virtual void CommitStep(double t_old, double t_new,
                           const Teuchos::RCP<State>& S) override;
 
+ protected:
+  void AdvanceColumns_(double t_old, double t_new);
+  bool AdvanceColumnStep_(int i, const std::string& col_domain,
+                          double t_inner, double dt_inner);
+
  protected:
   std::string subcycled_timestep_type_;
   double subcycled_target_time_;
   bool surface_star_subcycling_;
+  int num_threads_;
 
 private:
   // factory registration
@@ -1,55 +1,140 @@
 #include "mpc_surface_subsurface_helpers.hh"
 #include "errors.hh"
+#include "dbc.hh"
 
 namespace Amanzi {
 
+// -----------------------------------------------------------------------------
+// Cached surface cell to subsurface face map
+// -----------------------------------------------------------------------------
+SurfaceSubsurfaceFaceMap::SurfaceSubsurfaceFaceMap(
+    const Teuchos::RCP<const AmanziMesh::Mesh>& surf_mesh,
+    const Teuchos::RCP<const AmanziMesh::Mesh>& sub_mesh)
+{
+  int ncells_surf = surf_mesh->num_entities(AmanziMesh::CELL,
+          AmanziMesh::Parallel_type::OWNED);
+  const Epetra_Map& face_map = sub_mesh->face_map(false);
+  const Epetra_Map& bface_map = sub_mesh->exterior_face_map(false);
+
+  faces_.resize(ncells_surf);
+  bfaces_.resize(ncells_surf);
+  cells_.resize(ncells_surf);
+  AmanziMesh::Entity_ID_List cells;
+  for (int sc=0; sc!=ncells_surf; ++sc) {
+    int f = surf_mesh->entity_get_parent(AmanziMesh::CELL, sc);
+    faces_[sc] = f;
+    bfaces_[sc] = bface_map.LID(face_map.GID(f));
+
+    sub_mesh->face_get_cells(f, AmanziMesh::Parallel_type::ALL, &cells);
+    AMANZI_ASSERT(cells.size() == 1);
+    cells_[sc] = cells[0];
+  }
+}
+
+
+const std::vector<int>&
+SurfaceSubsurfaceFaceMap::FaceIndices(const CompositeVector& sub,
+        std::string& face_entity) const
+{
+  if (sub.HasComponent("face")) {
+    face_entity = "face";
+    return faces_;
+  } else if (sub.HasComponent("boundary_face")) {
+    face_entity = "boundary_face";
+    return bfaces_;
+  } else {
+    Errors::Message message("Subsurface vector does not have face component.");
+    Exceptions::amanzi_throw(message);
+  }
+  return faces_;
+}
+
+
 void
-CopySurfaceToSubsurface(const CompositeVector& surf,
-                        const Teuchos::Ptr<CompositeVector>& sub)
+SurfaceSubsurfaceFaceMap::CopySurfaceToSubsurface(const CompositeVector& surf,
+        const Teuchos::Ptr<CompositeVector>& sub) const
 {
   const Epetra_MultiVector& surf_c = *surf.ViewComponent("cell",false);
+  AMANZI_ASSERT(surf_c.MyLength() == (int) faces_.size());
 
-  for (unsigned int sc=0; sc!=surf_c.MyLength(); ++sc) {
-    AmanziMesh::Entity_ID f =
-        surf.Mesh()->entity_get_parent(AmanziMesh::CELL, sc);
-    SetDomainFaceValue(*sub, f, surf_c[0][sc]);
-  }
+  std::string face_entity;
+  const std::vector<int>& index = FaceIndices(*sub, face_entity);
+  double* sub_f = (*sub->ViewComponent(face_entity,false))[0];
+  const double* surf_cv = surf_c[0];
+
+  int ncells = index.size();
+  for (int sc=0; sc!=ncells; ++sc) sub_f[index[sc]] = surf_cv[sc];
 }
 
+
 void
-CopySubsurfaceToSurface(const CompositeVector& sub,
-                        const Teuchos::Ptr<CompositeVector>& surf)
+SurfaceSubsurfaceFaceMap::CopySubsurfaceToSurface(const CompositeVector& sub,
+        const Teuchos::Ptr<CompositeVector>& surf) const
 {
-  //  const Epetra_MultiVector& sub_f = *sub.ViewComponent("face",false);
   Epetra_MultiVector& surf_c = *surf->ViewComponent("cell",false);
+  AMANZI_ASSERT(surf_c.MyLength() == (int) faces_.size());
 
-  for (unsigned int sc=0; sc!=surf_c.MyLength(); ++sc) {
-    AmanziMesh::Entity_ID f =
-        surf->Mesh()->entity_get_parent(AmanziMesh::CELL, sc);
-    surf_c[0][sc] = GetDomainFaceValue(sub, f);
-  }
+  std::string face_entity;
+  const std::vector<int>& index = FaceIndices(sub, face_entity);
+  const double* sub_f = (*sub.ViewComponent(face_entity,false))[0];
+  double* surf_cv = surf_c[0];
+
+  int ncells = index.size();
+  for (int sc=0; sc!=ncells; ++sc) surf_cv[sc] = sub_f[index[sc]];
 }
 
+
 void
-MergeSubsurfaceAndSurfacePressure(const CompositeVector& h_prev,
-				  const Teuchos::Ptr<CompositeVector>& sub_p,
-				  const Teuchos::Ptr<CompositeVector>& surf_p)
+SurfaceSubsurfaceFaceMap::MergeSubsurfaceAndSurfacePressure(const CompositeVector& h_prev,
+        const Teuchos::Ptr<CompositeVector>& sub_p,
+        const Teuchos::Ptr<CompositeVector>& surf_p) const
 {
   Epetra_MultiVector& surf_p_c = *surf_p->ViewComponent("cell",false);
   const Epetra_MultiVector& h_c = *h_prev.ViewComponent("cell",false);
+  AMANZI_ASSERT(surf_p_c.MyLength() == (int) faces_.size());
   double p_atm = 101325.;
 
-  for (unsigned int sc=0; sc!=surf_p_c.MyLength(); ++sc) {
-    AmanziMesh::Entity_ID f =
-        surf_p->Mesh()->entity_get_parent(AmanziMesh::CELL, sc);
+  std::string face_entity;
+  const std::vector<int>& index = FaceIndices(*sub_p, face_entity);
+  double* sub_f = (*sub_p->ViewComponent(face_entity,false))[0];
+
+  int ncells = index.size();
+  for (int sc=0; sc!=ncells; ++sc) {
     if (h_c[0][sc] > 0. && surf_p_c[0][sc] > p_atm) {
-      SetDomainFaceValue(*sub_p, f,  surf_p_c[0][sc]);
+      sub_f[index[sc]] = surf_p_c[0][sc];
     } else {
-      surf_p_c[0][sc] = GetDomainFaceValue(*sub_p, f);
+      surf_p_c[0][sc] = sub_f[index[sc]];
     }
   }
 }
 
+
+// -----------------------------------------------------------------------------
+// Uncached versions, for meshes that change or are only used occasionally
+// -----------------------------------------------------------------------------
+void
+CopySurfaceToSubsurface(const CompositeVector& surf,
+                        const Teuchos::Ptr<CompositeVector>& sub)
+{
+  SurfaceSubsurfaceFaceMap(surf.Mesh(), sub->Mesh()).CopySurfaceToSubsurface(surf, sub);
+}
+
+void
+CopySubsurfaceToSurface(const CompositeVector& sub,
+                        const Teuchos::Ptr<CompositeVector>& surf)
+{
+  SurfaceSubsurfaceFaceMap(surf->Mesh(), sub.Mesh()).CopySubsurfaceToSurface(sub, surf);
+}
+
+void
+MergeSubsurfaceAndSurfacePressure(const CompositeVector& h_prev,
+				  const Teuchos::Ptr<CompositeVector>& sub_p,
+				  const Teuchos::Ptr<CompositeVector>& surf_p)
+{
+  SurfaceSubsurfaceFaceMap(surf_p->Mesh(), sub_p->Mesh())
+      .MergeSubsurfaceAndSurfacePressure(h_prev, sub_p, surf_p);
+}
+
 double
 GetDomainFaceValue(const CompositeVector& sub_p, int f)
 {
@@ -1,10 +1,49 @@
 #ifndef PKS_MPC_SURFACE_SUBSURFACE_HELPERS_HH_
 #define PKS_MPC_SURFACE_SUBSURFACE_HELPERS_HH_
 
+#include <vector>
+
 #include "CompositeVector.hh"
 
 namespace Amanzi {
 
+//
+// Precomputed map from surface cells to the subsurface faces beneath them,
+// as local IDs into both the "face" and "boundary_face" components, and
+// the subsurface cells below those faces.  Built
+// once, at setup, by MPCs which copy data between the surface and subsurface
+// every residual.  Vectors passed to the methods must live on the meshes used
+// to build the map.
+//
+class SurfaceSubsurfaceFaceMap {
+ public:
+  SurfaceSubsurfaceFaceMap(const Teuchos::RCP<const AmanziMesh::Mesh>& surf_mesh,
+                           const Teuchos::RCP<const AmanziMesh::Mesh>& sub_mesh);
+
+  const std::vector<int>& faces() const { return faces_; }
+  const std::vector<int>& boundary_faces() const { return bfaces_; }
+  const std::vector<int>& cells() const { return cells_; }
+
+  // The indices under each surface cell into the face component of sub,
+  // which is "face" if sub has one and "boundary_face" otherwise.
+  const std::vector<int>& FaceIndices(const CompositeVector& sub,
+          std::string& face_entity) const;
+
+  void CopySurfaceToSubsurface(const CompositeVector& surf,
+                               const Teuchos::Ptr<CompositeVector>& sub) const;
+  void CopySubsurfaceToSurface(const CompositeVector& sub,
+                               const Teuchos::Ptr<CompositeVector>& surf) const;
+  void MergeSubsurfaceAndSurfacePressure(const CompositeVector& h_prev,
+                                         const Teuchos::Ptr<CompositeVector>& sub_p,
+                                         const Teuchos::Ptr<CompositeVector>& surf_p) const;
+
+ private:
+  std::vector<int> faces_;
+  std::vector<int> bfaces_;
+  std::vector<int> cells_;
+};
+
+
 void
 CopySurfaceToSubsurface(const CompositeVector& surf,
                         const Teuchos::Ptr<CompositeVector>& sub);
@@ -16,6 +16,7 @@ See additional documentation in the base class src/pks/mpc/MPC.hh
 ------------------------------------------------------------------------- */
 
 #include "primary_variable_field_evaluator.hh"
+#include "cell_subset_evaluator.hh"
 #include "mpc_surface_subsurface_helpers.hh"
 
 #include "operator_split_mpc.hh"
@@ -77,17 +78,30 @@ bool OperatorSplitMPC::AdvanceStep(double t_old, double t_new, bool reinit) {
 
   // BEGIN THE NON-GENERIC PART TO BE REMOVED
   // also copy and mark the subsurface system
-  CopySurfaceToSubsurface(*S_inter_->GetFieldData(primary_variable_),
-                          S_inter_->GetFieldData("pressure",S_inter_->GetField("pressure")->owner()).ptr());
+  if (surf_sub_map_ == Teuchos::null) {
+    surf_sub_map_ = Teuchos::rcp(new SurfaceSubsurfaceFaceMap(
+        S_inter_->GetFieldData(primary_variable_)->Mesh(),
+        S_inter_->GetFieldData("pressure")->Mesh()));
+  }
+  surf_sub_map_->CopySurfaceToSubsurface(*S_inter_->GetFieldData(primary_variable_),
+          S_inter_->GetFieldData("pressure",S_inter_->GetField("pressure")->owner()).ptr());
   auto eval = S_inter_->GetFieldEvaluator("pressure");
   auto eval_pvfe = Teuchos::rcp_dynamic_cast<PrimaryVariableFieldEvaluator>(eval);
   eval_pvfe->SetFieldAsChanged(S_inter_.ptr());
 
-  CopySurfaceToSubsurface(*S_next_->GetFieldData(primary_variable_),
-                          S_next_->GetFieldData("pressure",S_next_->GetField("pressure")->owner()).ptr());
+  surf_sub_map_->CopySurfaceToSubsurface(*S_next_->GetFieldData(primary_variable_),
+          S_next_->GetFieldData("pressure",S_next_->GetField("pressure")->owner()).ptr());
   auto eval2 = S_next_->GetFieldEvaluator("pressure");
   auto eval_pvfe2 = Teuchos::rcp_dynamic_cast<PrimaryVariableFieldEvaluator>(eval2);
   eval_pvfe2->SetFieldAsChanged(S_next_.ptr());
+
+  // pressure changed only on the top faces, so the conserved quantities need
+  // only be recomputed on the top cells
+  std::vector<Key> conserved;
+  for (const auto& key : { Key("water_content"), Key("energy") }) {
+    if (S_next_->HasFieldEvaluator(key)) conserved.push_back(key);
+  }
+  UpdateFieldsOnCells(S_next_.ptr(), conserved, name_, surf_sub_map_->cells());
   // END THE NON-GENERIC PART TO BE REMOVED
 
 
@@ -17,6 +17,7 @@ See additional documentation in the base class src/pks/mpc/MPC.hh
 
 #include "PK.hh"
 #include "mpc.hh"
+#include "mpc_surface_subsurface_helpers.hh"
 
 namespace Amanzi {
 
@@ -56,6 +57,9 @@ class OperatorSplitMPC : public MPC<PK> {
  protected:
   Key primary_variable_;
   Key primary_variable_star_;
+
+  // built on first use, see AdvanceStep()
+  Teuchos::RCP<SurfaceSubsurfaceFaceMap> surf_sub_map_;
   
  private:
   // factory registration
@@ -0,0 +1,57 @@
+/* -*-  mode: c++; indent-tabs-mode: nil -*- */
+/*
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+*/
+
+//! Threaded loops over independent cells or columns.
+
+#pragma once
+
+#include <exception>
+#include <vector>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace Amanzi {
+
+// -----------------------------------------------------------------------------
+// Calls func(i, tid) for each i in [0, n), where tid in [0, nthreads) is the
+// calling thread, on nthreads OpenMP threads with dynamic scheduling in
+// chunks of the given size.
+//
+// Exceptions may not leave a parallel region.  The first exception thrown on
+// each thread is kept, that thread skips the rest of its iterations, and the
+// exception is rethrown after the loop, with its original type, so that
+// callers can still catch e.g. Errors::CutTimeStep.  Without OpenMP this is a
+// plain loop.
+// -----------------------------------------------------------------------------
+template<typename Func>
+void
+ParallelFor(int n, int nthreads, int chunk, const Func& func)
+{
+#ifdef _OPENMP
+  std::vector<std::exception_ptr> errors(nthreads);
+#pragma omp parallel for schedule(dynamic, chunk) num_threads(nthreads)
+  for (int i=0; i<n; ++i) {
+    int tid = omp_get_thread_num();
+    if (errors[tid]) continue;
+    try {
+      func(i, tid);
+    } catch (...) {
+      errors[tid] = std::current_exception();
+    }
+  }
+
+  for (const auto& error : errors) {
+    if (error) std::rethrow_exception(error);
+  }
+#else
+  for (int i=0; i!=n; ++i) func(i, 0);
+#endif
+}
+
+} // namespace
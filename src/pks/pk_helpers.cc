@@ -135,4 +135,15 @@ getBoundaryDirection(const AmanziMesh::Mesh& mesh, AmanziMesh::Entity_ID f) {
 
 
 
+// -----------------------------------------------------------------------------
+// Does a Debugger constructed from this list write anything?
+// -----------------------------------------------------------------------------
+bool
+isDebugging(const Teuchos::ParameterList& plist, const VerboseObject& vo,
+            Teuchos::EVerbosityLevel verb_level)
+{
+  return (plist.isParameter("debug cells") || plist.isParameter("debug faces")) &&
+      vo.getVerbLevel() >= verb_level;
+}
+
 } // namespace Amanzi
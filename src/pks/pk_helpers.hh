@@ -11,6 +11,9 @@
 
 #pragma once
 
+#include "Teuchos_ParameterList.hpp"
+
+#include "VerboseObject.hh"
 #include "Mesh.hh"
 #include "CompositeVector.hh"
 #include "BCs.hh"
@@ -73,4 +76,17 @@ int
 getBoundaryDirection(const AmanziMesh::Mesh& mesh, AmanziMesh::Entity_ID f);
 
 
+// -----------------------------------------------------------------------------
+// Does a Debugger constructed from this list write anything?
+//
+// Debugger writes are no-ops unless debug cells or faces are given and the
+// verbosity is at least the Debugger's level.  Debug output whose arguments
+// are expensive to assemble (name lists, GetFieldData calls) should be guarded
+// by this.  The result is the same on every rank.
+// -----------------------------------------------------------------------------
+bool
+isDebugging(const Teuchos::ParameterList& plist, const VerboseObject& vo,
+            Teuchos::EVerbosityLevel verb_level=Teuchos::VERB_HIGH);
+
+
 } // namespace Amanzi
@@ -9,6 +9,7 @@
    Default base with default implementations of methods for a physical PK.
    ------------------------------------------------------------------------- */
 #include "StateDefs.hh"
+#include "pk_helpers.hh"
 #include "pk_physical_default.hh"
 
 namespace Amanzi {
@@ -35,6 +36,9 @@ PK_Physical_Default::PK_Physical_Default(Teuchos::ParameterList& pk_tree,
   if (plist_->isSublist(name_ + " verbose object"))
     plist_->set("verbose object", plist_->sublist(name_ + " verbose object"));
   vo_ = Teuchos::rcp(new VerboseObject(*S->GetMesh(domain_)->get_comm(), name_, *plist_));
+
+  // debugger output is assembled only if the debugger writes anything
+  debugging_ = isDebugging(*plist_, *vo_);
 }
 
 // -----------------------------------------------------------------------------
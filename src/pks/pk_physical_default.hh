@@ -78,6 +78,9 @@ class PK_Physical_Default : public PK_Physical {
   // step validity
   double max_valid_change_;
 
+  // does db_ write anything?  Guards the assembly of debug output.
+  bool debugging_;
+
   // ENORM struct
   typedef struct ENorm_t {
     double value;
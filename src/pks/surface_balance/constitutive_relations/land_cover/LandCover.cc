@@ -9,6 +9,7 @@
 
 #include "exceptions.hh"
 #include "errors.hh"
+#include "mesh_cache.hh"
 
 #include "LandCover.hh"
 #include "seb_nan.hh"
@@ -57,6 +58,52 @@ LandCoverMap getLandCover(Teuchos::ParameterList& plist,
 }
 
 
+LandCoverIndex::LandCoverIndex(const AmanziMesh::Mesh& mesh, const LandCoverMap& lcm)
+{
+  int ncells = mesh.num_entities(AmanziMesh::Entity_kind::CELL, AmanziMesh::Parallel_type::OWNED);
+  cell_lc_.assign(ncells, -1);
+
+  for (const auto& lc : lcm) {
+    int i = regions_.size();
+    regions_.push_back(lc.first);
+    cells_.emplace_back();
+    mesh.get_set_entities(lc.first, AmanziMesh::Entity_kind::CELL,
+                          AmanziMesh::Parallel_type::OWNED, &cells_.back());
+    for (auto c : cells_.back()) cell_lc_[c] = i;
+  }
+}
+
+
+bool
+LandCoverIndex::matches(const LandCoverMap& lcm) const
+{
+  if (lcm.size() != regions_.size()) return false;
+  int i = 0;
+  for (const auto& lc : lcm) {
+    if (lc.first != regions_[i++]) return false;
+  }
+  return true;
+}
+
+
+Teuchos::RCP<const LandCoverIndex>
+getLandCoverIndex(const Teuchos::RCP<const AmanziMesh::Mesh>& mesh,
+                  const LandCoverMap& lcm)
+{
+  static MeshCache<LandCoverIndex> cache;
+  auto index = cache.get(mesh, [&](const AmanziMesh::Mesh& m) {
+      return Teuchos::rcp(new LandCoverIndex(m, lcm)); });
+
+  // every evaluator reads the same "land cover types" list
+  if (!index->matches(lcm)) {
+    Errors::Message msg;
+    msg << "LandCover: land cover regions differ from those of the cached index on this mesh";
+    Exceptions::amanzi_throw(msg);
+  }
+  return index;
+}
+
+
 namespace Impl {
 
 LandCoverMap getLandCover(Teuchos::ParameterList& plist)
@@ -127,7 +127,10 @@ same region-based partitioning.
 #pragma once
 
 #include <map>
+#include <vector>
 #include "Teuchos_ParameterList.hpp"
+#include "Teuchos_RCP.hpp"
+#include "Mesh.hh"
 
 namespace Amanzi {
 namespace SurfaceBalance {
@@ -187,6 +190,40 @@ using LandCoverMap = std::map<std::string, LandCover>;
 LandCoverMap getLandCover(Teuchos::ParameterList& plist,
                           const std::vector<std::string>& required_pars);
 
+
+//
+// Owned cells of each land cover region on a mesh, and the region of each
+// owned cell.  Regions are numbered in the (sorted) order of the
+// LandCoverMap, so cells(i) belongs to the i-th entry of the map, and of any
+// other map keyed by region name.
+//
+class LandCoverIndex {
+ public:
+  LandCoverIndex(const AmanziMesh::Mesh& mesh, const LandCoverMap& lcm);
+
+  int size() const { return regions_.size(); }
+  const std::string& region(int i) const { return regions_[i]; }
+  bool matches(const LandCoverMap& lcm) const;
+
+  // owned cells of region i
+  const AmanziMesh::Entity_ID_List& cells(int i) const { return cells_[i]; }
+
+  // region of owned cell c, or -1 if it is in no region.  If a cell is in
+  // several regions, the last one takes precedence.
+  int landCoverId(AmanziMesh::Entity_ID c) const { return cell_lc_[c]; }
+
+ private:
+  std::vector<std::string> regions_;
+  std::vector<AmanziMesh::Entity_ID_List> cells_;
+  std::vector<int> cell_lc_;
+};
+
+// Returns the index of the regions of lcm on mesh.  It is built on first use
+// and shared by all land cover evaluators on that mesh.
+Teuchos::RCP<const LandCoverIndex>
+getLandCoverIndex(const Teuchos::RCP<const AmanziMesh::Mesh>& mesh,
+                  const LandCoverMap& lcm);
+
 namespace Impl {
 
 void checkValid(const std::string& region, const LandCover& lc, const std::string& parname);
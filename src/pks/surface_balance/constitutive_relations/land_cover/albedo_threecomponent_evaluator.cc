@@ -53,8 +53,6 @@ void
 AlbedoThreeComponentEvaluator::EvaluateField_(const Teuchos::Ptr<State>& S,
         const std::vector<Teuchos::Ptr<CompositeVector> >& results)
 {
-  auto mesh = S->GetMesh(domain_);
-
   // collect dependencies
   const auto& snow_dens = *S->GetFieldData(snow_dens_key_)->ViewComponent("cell",false);
   const auto& unfrozen_fraction = *S->GetFieldData(unfrozen_fraction_key_)->ViewComponent("cell",false);
@@ -65,10 +63,9 @@ AlbedoThreeComponentEvaluator::EvaluateField_(const Teuchos::Ptr<State>& S,
 
   emissivity(2)->PutScalar(e_snow_);
 
+  int lc_id = 0;
   for (const auto& lc : land_cover_) {
-    AmanziMesh::Entity_ID_List lc_ids;
-    mesh->get_set_entities(lc.first, AmanziMesh::Entity_kind::CELL,
-                           AmanziMesh::Parallel_type::OWNED, &lc_ids);
+    const auto& lc_ids = lc_index_->cells(lc_id++);
 
     for (auto c : lc_ids) {
       // albedo of the snow
@@ -92,9 +89,11 @@ AlbedoThreeComponentEvaluator::EvaluateFieldPartialDerivative_(const Teuchos::Pt
 void AlbedoThreeComponentEvaluator::EnsureCompatibility(const Teuchos::Ptr<State>& S)
 {
   // new state!
-  if (land_cover_.size() == 0)
+  if (land_cover_.size() == 0) {
     land_cover_ = getLandCover(S->ICList().sublist("land cover types"),
             {"albedo_ground", "emissivity_ground"});
+    lc_index_ = getLandCoverIndex(S->GetMesh(domain_), land_cover_);
+  }
 
   CompositeVectorSpace domain_fac;
   domain_fac.SetMesh(S->GetMesh(domain_))
@@ -55,8 +55,6 @@ void
 AlbedoTwoComponentEvaluator::EvaluateField_(const Teuchos::Ptr<State>& S,
         const std::vector<Teuchos::Ptr<CompositeVector> >& results)
 {
-  auto mesh = S->GetMesh(domain_);
-
   // collect dependencies
   const auto& snow_dens = *S->GetFieldData(snow_dens_key_)->ViewComponent("cell",false);
   const auto& ponded_depth = *S->GetFieldData(ponded_depth_key_)->ViewComponent("cell",false);
@@ -67,10 +65,9 @@ AlbedoTwoComponentEvaluator::EvaluateField_(const Teuchos::Ptr<State>& S,
   auto& emissivity = *results[1]->ViewComponent("cell",false);
   emissivity(1)->PutScalar(e_snow_);
 
+  int lc_id = 0;
   for (const auto& lc : land_cover_) {
-    AmanziMesh::Entity_ID_List lc_ids;
-    mesh->get_set_entities(lc.first, AmanziMesh::Entity_kind::CELL,
-                           AmanziMesh::Parallel_type::OWNED, &lc_ids);
+    const auto& lc_ids = lc_index_->cells(lc_id++);
 
     for (auto c : lc_ids) {
       // albedo of the snow
@@ -104,9 +101,11 @@ void
 AlbedoTwoComponentEvaluator::EnsureCompatibility(const Teuchos::Ptr<State>& S)
 {
   // new state!
-  if (land_cover_.size() == 0)
+  if (land_cover_.size() == 0) {
     land_cover_ = getLandCover(S->ICList().sublist("land cover types"),
             {"emissivity_ground", "albedo_ground"});
+    lc_index_ = getLandCoverIndex(S->GetMesh(domain_), land_cover_);
+  }
 
   CompositeVectorSpace domain_fac;
   domain_fac.SetMesh(S->GetMesh(domain_))
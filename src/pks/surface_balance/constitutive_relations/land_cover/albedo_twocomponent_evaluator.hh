@@ -81,6 +81,7 @@ class AlbedoTwoComponentEvaluator : public SecondaryVariablesFieldEvaluator {
   // this is horrid, because this cannot yet live in state
   // bring on new state!
   LandCoverMap land_cover_;
+  Teuchos::RCP<const LandCoverIndex> lc_index_;
 
  private:
   static Utils::RegisteredFactory<FieldEvaluator,AlbedoTwoComponentEvaluator> reg_;
@@ -48,10 +48,9 @@ AreaFractionsThreeComponentEvaluator::EvaluateField_(const Teuchos::Ptr<State>&
   const auto& sd = *S->GetFieldData(snow_depth_key_)->ViewComponent("cell",false);
   const auto& pd = *S->GetFieldData(ponded_depth_key_)->ViewComponent("cell",false);
 
+  int lc_id = 0;
   for (const auto& lc : land_cover_) {
-    AmanziMesh::Entity_ID_List lc_ids;
-    mesh->get_set_entities(lc.first, AmanziMesh::Entity_kind::CELL,
-                           AmanziMesh::Parallel_type::OWNED, &lc_ids);
+    const auto& lc_ids = lc_index_->cells(lc_id++);
 
     for (auto c : lc_ids) {
       // calculate area of land
@@ -137,9 +136,11 @@ AreaFractionsThreeComponentEvaluator::EvaluateField_(const Teuchos::Ptr<State>&
 void
 AreaFractionsThreeComponentEvaluator::EnsureCompatibility(const Teuchos::Ptr<State>& S)
 {
-  if (land_cover_.size() == 0)
+  if (land_cover_.size() == 0) {
     land_cover_ = getLandCover(S->ICList().sublist("land cover types"),
             {"snow_transition_depth", "water_transition_depth"});
+    lc_index_ = getLandCoverIndex(S->GetMesh(domain_), land_cover_);
+  }
 
 
   // see if we can find a master fac
@@ -84,6 +84,7 @@ class AreaFractionsThreeComponentEvaluator : public SecondaryVariableFieldEvalua
   // this is horrid, because this cannot yet live in state
   // bring on new state!
   LandCoverMap land_cover_;
+  Teuchos::RCP<const LandCoverIndex> lc_index_;
 
  private:
   static Utils::RegisteredFactory<FieldEvaluator,AreaFractionsThreeComponentEvaluator> reg_;
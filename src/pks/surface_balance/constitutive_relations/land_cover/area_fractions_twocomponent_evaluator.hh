@@ -78,6 +78,7 @@ class AreaFractionsTwoComponentEvaluator : public SecondaryVariableFieldEvaluato
   // this is horrid, because this cannot yet live in state
   // bring on new state!
   LandCoverMap land_cover_;
+  Teuchos::RCP<const LandCoverIndex> lc_index_;
 
  private:
   static Utils::RegisteredFactory<FieldEvaluator,AreaFractionsTwoComponentEvaluator> reg_;
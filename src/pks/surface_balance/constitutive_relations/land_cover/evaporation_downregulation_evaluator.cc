@@ -62,12 +62,10 @@ EvaporationDownregulationEvaluator::EvaluateField_(const Teuchos::Ptr<State>& S,
   const Epetra_MultiVector& pot_evap = *S->GetFieldData(pot_evap_key_)->ViewComponent("cell",false);
   Epetra_MultiVector& surf_evap = *result->ViewComponent("cell",false);
   auto& sub_mesh = *S->GetMesh(domain_sub_);
-  auto& surf_mesh = *S->GetMesh(domain_surf_);
 
+  int lc_id = 0;
   for (const auto& region_model : models_) {
-    AmanziMesh::Entity_ID_List lc_ids;
-    surf_mesh.get_set_entities(region_model.first, AmanziMesh::Entity_kind::CELL,
-                           AmanziMesh::Parallel_type::OWNED, &lc_ids);
+    const auto& lc_ids = lc_index_->cells(lc_id++);
 
     for (AmanziMesh::Entity_ID sc : lc_ids) {
       auto c = sub_mesh.cells_of_column(sc)[0];
@@ -87,12 +85,10 @@ EvaporationDownregulationEvaluator::EvaluateFieldPartialDerivative_(const Teucho
     const Epetra_MultiVector& pot_evap = *S->GetFieldData(pot_evap_key_)->ViewComponent("cell",false);
     Epetra_MultiVector& surf_evap = *result->ViewComponent("cell",false);
     auto& sub_mesh = *S->GetMesh(domain_sub_);
-    auto& surf_mesh = *S->GetMesh(domain_surf_);
 
+    int lc_id = 0;
     for (const auto& region_model : models_) {
-      AmanziMesh::Entity_ID_List lc_ids;
-      surf_mesh.get_set_entities(region_model.first, AmanziMesh::Entity_kind::CELL,
-              AmanziMesh::Parallel_type::OWNED, &lc_ids);
+      const auto& lc_ids = lc_index_->cells(lc_id++);
       for (AmanziMesh::Entity_ID sc : lc_ids) {
         auto c = sub_mesh.cells_of_column(sc)[0];
         surf_evap[0][sc] = region_model.second->DEvaporationDPotentialEvaporation(sat_gas[0][c], poro[0][c], pot_evap[0][sc]);
@@ -108,6 +104,7 @@ EvaporationDownregulationEvaluator::EnsureCompatibility(const Teuchos::Ptr<State
   if (!consistent_) {
     land_cover_ = getLandCover(S->ICList().sublist("land cover types"),
             {"dessicated_zone_thickness", "clapp_horn_b"});
+    lc_index_ = getLandCoverIndex(S->GetMesh(domain_surf_), land_cover_);
     for (const auto& lc : land_cover_) {
       models_[lc.first] = Teuchos::rcp(new EvaporationDownregulationModel(lc.second));
     }
@@ -67,6 +67,7 @@ class EvaporationDownregulationEvaluator : public SecondaryVariableFieldEvaluato
   bool consistent_;
 
   LandCoverMap land_cover_;
+  Teuchos::RCP<const LandCoverIndex> lc_index_;
   std::map<std::string, Teuchos::RCP<EvaporationDownregulationModel>> models_;
 
  private:
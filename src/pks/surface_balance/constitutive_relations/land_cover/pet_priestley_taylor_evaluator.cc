@@ -117,13 +117,11 @@ PETPriestleyTaylorEvaluator::EvaluateField_(const Teuchos::Ptr<State>& S,
   const auto& elev = *S->GetFieldData(elev_key_)->ViewComponent("cell", false);
   const auto& rad = *S->GetFieldData(rad_key_)->ViewComponent("cell",false);
 
-  auto mesh = result->Mesh();
   auto& res = *result->ViewComponent("cell", false);
 
+  int lc_id = 0;
   for (const auto& lc : land_cover_) {
-    AmanziMesh::Entity_ID_List lc_ids;
-    mesh->get_set_entities(lc.first, AmanziMesh::Entity_kind::CELL,
-                           AmanziMesh::Parallel_type::OWNED, &lc_ids);
+    const auto& lc_ids = lc_index_->cells(lc_id++);
 
     double alpha = 0.;
     bool is_snow = false;
@@ -194,6 +192,7 @@ PETPriestleyTaylorEvaluator::EnsureCompatibility(const Teuchos::Ptr<State>& S)
   if (!compatible_) {
     land_cover_ = getLandCover(S->ICList().sublist("land cover types"),
             {"pt_alpha_"+evap_type_});
+    lc_index_ = getLandCoverIndex(S->GetMesh(domain_), land_cover_);
 
     // see if we can find a master fac
     auto my_fac = S->RequireField(my_key_, my_key_);
@@ -132,6 +132,7 @@ class PETPriestleyTaylorEvaluator : public SecondaryVariableFieldEvaluator {
   bool compatible_;
 
   LandCoverMap land_cover_;
+  Teuchos::RCP<const LandCoverIndex> lc_index_;
 
  private:
   static Utils::RegisteredFactory<FieldEvaluator,PETPriestleyTaylorEvaluator> reg_;
@@ -45,6 +45,7 @@ PlantWiltingFactorEvaluator::EvaluateField_(const Teuchos::Ptr<State>& S,
   if (models_.size() == 0) {
     land_cover_ = getLandCover(S->ICList().sublist("land cover types"),
             {"stomata_closed_mafic_potential", "stomata_open_mafic_potential"});
+    lc_index_ = getLandCoverIndex(S->GetMesh(domain_surf_), land_cover_);
     for (const auto& lc : land_cover_) {
       models_[lc.first] = Teuchos::rcp(new PlantWiltingFactorModel(lc.second));
     }
@@ -54,12 +55,10 @@ PlantWiltingFactorEvaluator::EvaluateField_(const Teuchos::Ptr<State>& S,
   Epetra_MultiVector& result_v = *result->ViewComponent("cell",false);
 
   auto& subsurf_mesh = *S->GetMesh(domain_sub_);
-  auto& surf_mesh = *S->GetMesh(domain_surf_);
 
+  int lc_id = 0;
   for (const auto& region_model : models_) {
-    AmanziMesh::Entity_ID_List lc_ids;
-    surf_mesh.get_set_entities(region_model.first, AmanziMesh::Entity_kind::CELL,
-                           AmanziMesh::Parallel_type::OWNED, &lc_ids);
+    const auto& lc_ids = lc_index_->cells(lc_id++);
 
     for (int sc : lc_ids) {
       for (auto c : subsurf_mesh.cells_of_column(sc)) {
@@ -79,12 +78,10 @@ PlantWiltingFactorEvaluator::EvaluateFieldPartialDerivative_(const Teuchos::Ptr<
     Epetra_MultiVector& result_v = *result->ViewComponent("cell",false);
 
     auto& subsurf_mesh = *S->GetMesh(domain_sub_);
-    auto& surf_mesh = *S->GetMesh(domain_surf_);
 
+    int lc_id = 0;
     for (const auto& region_model : models_) {
-      AmanziMesh::Entity_ID_List lc_ids;
-      surf_mesh.get_set_entities(region_model.first, AmanziMesh::Entity_kind::CELL,
-              AmanziMesh::Parallel_type::OWNED, &lc_ids);
+      const auto& lc_ids = lc_index_->cells(lc_id++);
 
       for (int sc : lc_ids) {
         for (auto c : subsurf_mesh.cells_of_column(sc)) {
@@ -71,6 +71,7 @@ class PlantWiltingFactorEvaluator : public SecondaryVariableFieldEvaluator {
   Key domain_sub_;
 
   LandCoverMap land_cover_;
+  Teuchos::RCP<const LandCoverIndex> lc_index_;
   std::map<std::string,Teuchos::RCP<PlantWiltingFactorModel>> models_;
 
  private:
@@ -68,6 +68,7 @@ RadiationBalanceEvaluator::EnsureCompatibility(const Teuchos::Ptr<State>& S)
   if (!compatible_) {
     land_cover_ = getLandCover(S->ICList().sublist("land cover types"),
             {"beers_law_lw", "beers_law_sw", "emissivity_canopy", "albedo_canopy"});
+    lc_index_ = getLandCoverIndex(S->GetMesh(domain_surf_), land_cover_);
 
     for (const auto& my_key : my_keys_) {
       // require all domains are the same
@@ -117,12 +118,9 @@ RadiationBalanceEvaluator::EvaluateField_(const Teuchos::Ptr<State>& S,
   const Epetra_MultiVector& area_frac = *S->GetFieldData(area_frac_key_)->ViewComponent("cell",false);
   const Epetra_MultiVector& lai = *S->GetFieldData(lai_key_)->ViewComponent("cell",false);
 
-  auto mesh = results[0]->Mesh();
-
+  int lc_id = 0;
   for (const auto& lc : land_cover_) {
-    AmanziMesh::Entity_ID_List lc_ids;
-    mesh->get_set_entities(lc.first, AmanziMesh::Entity_kind::CELL,
-                           AmanziMesh::Parallel_type::OWNED, &lc_ids);
+    const auto& lc_ids = lc_index_->cells(lc_id++);
 
     for (auto c : lc_ids) {
       // Beer's law to find attenuation of radiation to surface in sw
@@ -88,6 +88,7 @@ class RadiationBalanceEvaluator : public SecondaryVariablesFieldEvaluator {
   // this is horrid, because this cannot yet live in state
   // bring on new state!
   LandCoverMap land_cover_;
+  Teuchos::RCP<const LandCoverIndex> lc_index_;
 
  private:
   static Utils::RegisteredFactory<FieldEvaluator,RadiationBalanceEvaluator> reg_;
@@ -63,12 +63,10 @@ RootingDepthFractionEvaluator::EvaluateField_(const Teuchos::Ptr<State>& S,
   Epetra_MultiVector& result_v = *result->ViewComponent("cell", false);
 
   auto& subsurf_mesh = *S->GetMesh(domain_sub_);
-  auto& surf_mesh = *S->GetMesh(domain_surf_);
 
+  int lc_id = 0;
   for (const auto& region_model : models_) {
-    AmanziMesh::Entity_ID_List lc_ids;
-    surf_mesh.get_set_entities(region_model.first, AmanziMesh::Entity_kind::CELL,
-                           AmanziMesh::Parallel_type::OWNED, &lc_ids);
+    const auto& lc_ids = lc_index_->cells(lc_id++);
 
     for (int sc : lc_ids) {
       double column_total = 0.;
@@ -105,6 +103,7 @@ RootingDepthFractionEvaluator::EnsureCompatibility(const Teuchos::Ptr<State>& S)
   if (models_.size() == 0) {
     land_cover_ = getLandCover(S->ICList().sublist("land cover types"),
             {"rooting_profile_alpha", "rooting_profile_beta", "rooting_depth_max"});
+    lc_index_ = getLandCoverIndex(S->GetMesh(domain_surf_), land_cover_);
     for (const auto& lc : land_cover_) {
       models_[lc.first] = Teuchos::rcp(new RootingDepthFractionModel(lc.second));
     }
@@ -72,6 +72,7 @@ class RootingDepthFractionEvaluator : public SecondaryVariableFieldEvaluator {
   Key domain_sub_;
 
   LandCoverMap land_cover_;
+  Teuchos::RCP<const LandCoverIndex> lc_index_;
   std::map<std::string, Teuchos::RCP<RootingDepthFractionModel>> models_;
 
  private:
@@ -18,6 +18,8 @@
 #ifndef SURFACEBALANCE_SEB_PHYSICS_DEFS_HH_
 #define SURFACEBALANCE_SEB_PHYSICS_DEFS_HH_
 
+#include <string>
+
 #include "Teuchos_ParameterList.hpp"
 #include "seb_nan.hh"
 
@@ -59,7 +61,8 @@ struct ModelParams {
       evap_transition_width(100.), // transition on evaporation from surface to
                                    // evaporation from subsurface [m],
                                    // THIS IS DEPRECATED
-      Clapp_Horn_b(1.)          // Clapp and Hornberger "b" [-]
+      Clapp_Horn_b(1.),         // Clapp and Hornberger "b" [-]
+      snow_temp_solver("toms")  // root finder for the snow temperature
   {}
 
   ModelParams(Teuchos::ParameterList& plist) :
@@ -68,6 +71,7 @@ struct ModelParams {
     thermalK_snow_exp = plist.get<double>("thermal conductivity of snow aging exponent [-]", thermalK_snow_exp);
     density_snow_max = plist.get<double>("max density of snow [kg m^-3]", density_snow_max);
     evap_transition_width = plist.get<double>("evaporation transition width [Pa]", evap_transition_width);
+    snow_temp_solver = plist.get<std::string>("snow temperature solver", snow_temp_solver);
   }
 
   // likely constants
@@ -85,6 +89,7 @@ struct ModelParams {
 
   // other parameters
   double evap_transition_width;
+  std::string snow_temp_solver;   // one of "toms", "newton", or "bisection"
 };
 
 
@@ -11,6 +11,7 @@
 #include <iostream>
 #include <cmath>
 #include <algorithm>
+#include <limits>
 #include "boost/math/tools/roots.hpp"
 
 #include "dbc.hh"
@@ -222,16 +223,21 @@ double LatentHeat(double resistance_coef,
     * (vapor_pressure_air - vapor_pressure_skin) / p_atm;
 }
 
-double ConductedHeatIfSnow(double ground_temp,
-                           const SnowProperties& snow, const ModelParams& params)
+double SnowThermalConductivity(const SnowProperties& snow, const ModelParams& params)
 {
-  // Calculate heat conducted to ground, if snow
   double density = snow.density;
   if (density > 150) {
     // adjust for frost hoar
     density = 1. / ((0.90/density) + (0.10/150));
   }
-  double Ks = params.thermalK_freshsnow * std::pow(density/params.density_freshsnow, params.thermalK_snow_exp);
+  return params.thermalK_freshsnow * std::pow(density/params.density_freshsnow, params.thermalK_snow_exp);
+}
+
+double ConductedHeatIfSnow(double ground_temp,
+                           const SnowProperties& snow, const ModelParams& params)
+{
+  // Calculate heat conducted to ground, if snow
+  double Ks = SnowThermalConductivity(snow, params);
   return Ks * (snow.temp - ground_temp) / snow.height;
 }
 
@@ -265,6 +271,45 @@ void UpdateEnergyBalanceWithSnow_Inner(const GroundProperties& surf,
   eb.fQm = eb.fQswIn + eb.fQlwIn - eb.fQlwOut + eb.fQh - eb.fQc + eb.fQe;
 }
 
+double DEnergyBalanceWithSnowDSnowTemp_Inner(const GroundProperties& surf,
+        const SnowProperties& snow,
+        const MetData& met,
+        const ModelParams& params)
+{
+  // outgoing radiation
+  double dQlwOut = 4 * snow.emissivity * c_stephan_boltzmann * std::pow(snow.temp,3);
+
+  // stability function, as in StabilityFunction(), and its derivative
+  double Dhe = WindFactor(met.Us, met.Z_Us, CalcRoughnessFactor(snow.height, surf.roughness, snow.roughness));
+  double dRi = -params.gravity * met.Z_Us / (met.air_temp * std::pow(met.Us,2));
+  double Ri = dRi * (snow.temp - met.air_temp);
+  double Sqig, dSqig;
+  if (Ri >= 0.) {
+    Sqig = 1. / (1 + 10*Ri);
+    dSqig = -10 * dRi * Sqig * Sqig;
+  } else {
+    Sqig = 1 - 10*Ri;
+    dSqig = -10 * dRi;
+  }
+
+  // sensible heat
+  double dQh = Dhe * params.density_air * params.Cp_air
+               * (dSqig * (met.air_temp - snow.temp) - Sqig);
+
+  // latent heat, with the derivative of SaturatedVaporPressure()
+  double vapor_pressure_air = VaporPressureAir(met.air_temp, met.relative_humidity);
+  double vapor_pressure_skin = SaturatedVaporPressure(snow.temp);
+  double tempC = snow.temp - 273.15;
+  double dvapor_pressure_skin = vapor_pressure_skin * 17.67 * 243.5 / std::pow(tempC + 243.5, 2);
+  double dQe = Dhe * params.density_air * params.H_sublimation * 0.622 / params.P_atm
+               * (dSqig * (vapor_pressure_air - vapor_pressure_skin) - Sqig * dvapor_pressure_skin);
+
+  // conducted heat
+  double dQc = SnowThermalConductivity(snow, params) / snow.height;
+
+  return -dQlwOut + dQh - dQc + dQe;
+}
+
 EnergyBalance UpdateEnergyBalanceWithSnow(const GroundProperties& surf,
         const MetData& met,
         const ModelParams& params,
@@ -274,7 +319,7 @@ EnergyBalance UpdateEnergyBalanceWithSnow(const GroundProperties& surf,
 
   // snow on the ground, solve for snow temperature
   std::tie(eb.fQswIn, eb.fQlwIn) = IncomingRadiation(met, snow.albedo);
-  snow.temp = DetermineSnowTemperature(surf, met, params, snow, eb);
+  snow.temp = DetermineSnowTemperature(surf, met, params, snow, eb, params.snow_temp_solver);
 
   if (snow.temp > 273.15) {
     // limit snow temp to 0, then melt with the remaining energy
@@ -344,6 +389,42 @@ double DetermineSnowTemperature(const GroundProperties& surf,
         std::string method)
 {
   SnowTemperatureFunctor_ func(&surf, &snow, &met, &params, &eb);
+
+  if (method == "newton") {
+    // The residual decreases with snow temperature, so iterates with a
+    // positive (negative) residual are lower (upper) bounds on the root.
+    // Until the root is bracketed, Newton steps are limited in size; after,
+    // steps that leave the bracket are replaced by bisection.
+    const double max_step = 10.;
+    double lower = -std::numeric_limits<double>::infinity();
+    double upper = std::numeric_limits<double>::infinity();
+    double temp = std::isnan(snow.temp) ? surf.temp : snow.temp;
+
+    for (int it=0; it!=100; ++it) {
+      double res = func(temp);
+      if (res > 0.) lower = temp;
+      else upper = temp;
+
+      double dres = func.derivative(temp);
+      double temp_new = temp - res / dres;
+      bool bracketed = std::isfinite(lower) && std::isfinite(upper);
+      if (bracketed) {
+        if (!(temp_new > lower && temp_new < upper)) temp_new = (lower + upper) / 2.;
+      } else if (!(dres < 0.)) {
+        temp_new = res > 0. ? temp + 1. : temp - 1.;
+      } else {
+        temp_new = std::min(std::max(temp_new, temp - max_step), temp + max_step);
+      }
+
+      if (std::abs(temp_new - temp) <= ENERGY_BALANCE_TOL ||
+          (bracketed && upper - lower <= ENERGY_BALANCE_TOL)) {
+        return temp_new;
+      }
+      temp = temp_new;
+    }
+    throw("Nonconverged Surface Energy Balance");
+  }
+
   Tol_ tol(ENERGY_BALANCE_TOL);
   boost::uintmax_t max_it(100);
   double left, right;
@@ -118,6 +118,11 @@ double LatentHeat(double resistance_coef,
                   double vapor_pressure_skin,
                   double Apa);
 
+//
+// Thermal conductivity of snow as a function of density.
+// ------------------------------------------------------------------------------------------
+double SnowThermalConductivity(const SnowProperties& snow, const ModelParams& params);
+
 //
 // Heat conducted to ground via simple diffusion model between snow and skin surface.
 // ------------------------------------------------------------------------------------------
@@ -136,10 +141,24 @@ void UpdateEnergyBalanceWithSnow_Inner(const GroundProperties& surf,
         const ModelParams& params,
         EnergyBalance& eb);
 
+//
+// Derivative of the energy available for melting, eb.fQm as calculated by
+// UpdateEnergyBalanceWithSnow_Inner(), with respect to snow temperature.
+// ------------------------------------------------------------------------------------------
+double DEnergyBalanceWithSnowDSnowTemp_Inner(const GroundProperties& surf,
+        const SnowProperties& snow,
+        const MetData& met,
+        const ModelParams& params);
+
 //
 // Determine the snow temperature by solving for energy balance, i.e. the snow
 // temp at equilibrium.  Assumes no melting (and therefore T_snow calculated
 // can be greater than 0 C.
+//
+// The "newton" method is a safeguarded Newton iteration started from
+// snow.temp if it is set (e.g. the last snow temperature in this cell) and
+// the skin temperature otherwise.  "toms" and "bisection" bracket the root
+// by stepping from the skin temperature and then call the boost solvers.
 // ------------------------------------------------------------------------------------------
 double DetermineSnowTemperature(const GroundProperties& surf,
         const MetData& met,
@@ -151,6 +170,7 @@ double DetermineSnowTemperature(const GroundProperties& surf,
 
 //
 // Update the energy balance, solving for the amount of heat conducted to the ground.
+// On input, snow.temp is an initial guess for the snow temperature, or NaN.
 //
 // NOTE, this CAN be used directly.
 // ------------------------------------------------------------------------------------------
@@ -224,6 +244,11 @@ class SnowTemperatureFunctor_ {
     return eb_->fQm;
   }
 
+  double derivative(double temp) {
+    snow_->temp = temp;
+    return DEnergyBalanceWithSnowDSnowTemp_Inner(*surf_, *snow_, *met_, *params_);
+  }
+
  private:
   GroundProperties const * const surf_;
   ModelParams const * const params_;
@@ -29,6 +29,7 @@ respectively.
 #include "seb_twocomponent_evaluator.hh"
 #include "seb_physics_defs.hh"
 #include "seb_physics_funcs.hh"
+#include "parallel_for.hh"
 
 namespace Amanzi {
 namespace SurfaceBalance {
@@ -104,6 +105,15 @@ SEBTwoComponentEvaluator::SEBTwoComponentEvaluator(Teuchos::ParameterList& plist
     my_keys_.push_back(qE_cond_key_);
   }
 
+  // The Newton snow temperature solver starts from the last snow temperature
+  // in each cell, so that field is kept, and checkpointed, even without
+  // diagnostics.
+  warm_start_ = plist.get<std::string>("snow temperature solver", "toms") == "newton";
+  if (warm_start_ && !diagnostics_) {
+    snow_temp_key_ = Keys::readKey(plist, domain_snow_, "snow temperature", "temperature");
+    my_keys_.push_back(snow_temp_key_);
+  }
+
   // dependencies
   // -- met data
   met_sw_key_ = Keys::readKey(plist, domain_,"incoming shortwave radiation", "incoming_shortwave_radiation");
@@ -163,6 +173,16 @@ SEBTwoComponentEvaluator::SEBTwoComponentEvaluator(Teuchos::ParameterList& plist
   min_rel_hum_ = plist.get<double>("minimum relative humidity [-]", 0.1);
   min_wind_speed_ = plist.get<double>("minimum wind speed [m s^-1]", 1.0);
   wind_speed_ref_ht_ = plist.get<double>("wind speed reference height [m]", 2.0);
+
+  num_threads_ = plist.get<int>("number of threads", 1);
+  if (num_threads_ < 1) {
+    Errors::Message msg;
+    msg << "SEB evaluator: \"number of threads\" must be positive, not " << num_threads_;
+    Exceptions::amanzi_throw(msg);
+  }
+#ifndef _OPENMP
+  num_threads_ = 1;
+#endif
 }
 
 void
@@ -216,9 +236,6 @@ SEBTwoComponentEvaluator::EvaluateField_(const Teuchos::Ptr<State>& S,
   snow_source.PutScalar(0.);
   new_snow.PutScalar(0.);
 
-  const auto& mesh = *S->GetMesh(domain_);
-  const auto& mesh_ss = *S->GetMesh(domain_ss_);
-
   Epetra_MultiVector *melt_rate(nullptr), *evap_rate(nullptr), *snow_temp(nullptr);
   Epetra_MultiVector *qE_sh(nullptr), *qE_lh(nullptr), *qE_sm(nullptr);
   Epetra_MultiVector *qE_lw_out(nullptr), *qE_cond(nullptr), *albedo(nullptr);
@@ -229,8 +246,6 @@ SEBTwoComponentEvaluator::EvaluateField_(const Teuchos::Ptr<State>& S,
     melt_rate->PutScalar(0.);
     evap_rate = S->GetFieldData(evap_key_, evap_key_)->ViewComponent("cell",false).get();
     evap_rate->PutScalar(0.);
-    snow_temp = S->GetFieldData(snow_temp_key_, snow_temp_key_)->ViewComponent("cell",false).get();
-    snow_temp->PutScalar(273.15);
     qE_sh = S->GetFieldData(qE_sh_key_, qE_sh_key_)->ViewComponent("cell",false).get();
     qE_sh->PutScalar(0.);
     qE_lh = S->GetFieldData(qE_lh_key_, qE_lh_key_)->ViewComponent("cell",false).get();
@@ -243,171 +258,193 @@ SEBTwoComponentEvaluator::EvaluateField_(const Teuchos::Ptr<State>& S,
     qE_cond->PutScalar(0.);
   }
 
-  for (const auto& lc : land_cover_) {
-    AmanziMesh::Entity_ID_List lc_ids;
-    mesh.get_set_entities(lc.first, AmanziMesh::Entity_kind::CELL,
-                           AmanziMesh::Parallel_type::OWNED, &lc_ids);
+  // the last snow temperature is the initial guess of the Newton solver,
+  // unless it has never been calculated
+  std::vector<double> snow_temp_guess;
+  if (diagnostics_ || warm_start_) {
+    snow_temp = S->GetFieldData(snow_temp_key_, snow_temp_key_)->ViewComponent("cell",false).get();
+    if (warm_start_ && S->GetField(snow_temp_key_)->initialized()) {
+      snow_temp_guess.assign((*snow_temp)[0], (*snow_temp)[0] + snow_temp->MyLength());
+    }
+    snow_temp->PutScalar(273.15);
+  }
+
+  // land cover of each region, numbered as in the index
+  std::vector<const LandCover*> lcs;
+  for (const auto& lc : land_cover_) lcs.push_back(&lc.second);
+
+  // Each surface cell writes only to itself and to the one subsurface cell
+  // below it, so cells are independent and the result does not depend on
+  // the order in which they are evaluated, or on the number of threads.
+  auto evaluate_cell = [&](AmanziMesh::Entity_ID c, const LandCover& lc) {
+    AmanziMesh::Entity_ID c_ss = top_cell_[c];
+
+    // met data structure
+    Relations::MetData met;
+    met.Z_Us = wind_speed_ref_ht_;
+    met.Us = std::max(wind_speed[0][c], min_wind_speed_);
+    met.QswIn = qSW_in[0][c];
+    met.QlwIn = qLW_in[0][c];
+    met.air_temp = air_temp[0][c];
+    met.relative_humidity = std::max(rel_hum[0][c], min_rel_hum_);
+    met.Pr = Prain[0][c];
+
+    // non-snow covered column
+    if (area_fracs[0][c] > 0) {
+      Relations::GroundProperties surf;
+      surf.temp = surf_temp[0][c];
+      surf.water_transition_depth = lc.water_transition_depth;
+      if (ponded_depth[0][c] > lc.water_transition_depth) {
+        surf.pressure = surf_pres[0][c];
+        surf.porosity = 1.;
+        surf.saturation_gas = 0.;
+      } else {
+        double factor = std::max(ponded_depth[0][c],0.) /
+          lc.water_transition_depth;
+        surf.pressure = factor*surf_pres[0][c] + (1-factor)*ss_pres[0][c_ss];
+        surf.porosity = factor + (1-factor)*poro[0][c_ss];
+        surf.saturation_gas = (1-factor)*sat_gas[0][c_ss];
+      }
+      if (model_1p1_) surf.pressure = surf_pres[0][c];
+      surf.ponded_depth = ponded_depth[0][c];
+      surf.unfrozen_fraction = unfrozen_fraction[0][c];
+      surf.roughness = lc.roughness_ground;
+      if (model_1p1_) surf.density_w = 1000.;
+      else surf.density_w = mass_dens[0][c];
+      surf.dz = lc.dessicated_zone_thickness;
+      surf.albedo = sg_albedo[0][c];
+      surf.emissivity = emissivity[0][c];
+
+      // must ensure that energy is put into melting snow precip, even if it
+      // all melts so there is no snow column
+      if (area_fracs[1][c] == 0.) {
+        met.Ps = Psnow[0][c];
+        surf.snow_death_rate = snow_death_rate[0][c]; // m H20 / s
+      } else {
+        met.Ps = 0.;
+        surf.snow_death_rate = 0.;
+      }
+
+      // calculate the surface balance
+      const Relations::EnergyBalance eb = Relations::UpdateEnergyBalanceWithoutSnow(surf, met, params);
+      Relations::MassBalance mb = Relations::UpdateMassBalanceWithoutSnow(surf, params, eb);
+      Relations::FluxBalance flux = Relations::UpdateFluxesWithoutSnow(surf, met, params, eb, mb, model_1p1_);
+
+      // fQe, Me positive is condensation, water flux positive to surface
+      water_source[0][c] += area_fracs[0][c] * flux.M_surf;
+      energy_source[0][c] += area_fracs[0][c] * flux.E_surf * 1.e-6; // convert to MW/m^2
+
+      double area_to_volume = area_to_volume_[c];
+      double ss_water_source_l;
+      if (model_1p1_) ss_water_source_l = flux.M_subsurf * area_to_volume * surf.density_w / 0.0180153; // convert from m/s to mol/m^3/s
+      else ss_water_source_l = flux.M_subsurf * area_to_volume * mol_dens[0][c]; // convert from m/s to mol/m^3/s
+      ss_water_source[0][c_ss] += area_fracs[0][c] * ss_water_source_l;
+      double ss_energy_source_l = flux.E_subsurf * area_to_volume * 1.e-6; // convert from W/m^2 to MW/m^3
+      ss_energy_source[0][c_ss] += area_fracs[0][c] * ss_energy_source_l;
+
+      snow_source[0][c] += area_fracs[0][c] * flux.M_snow;
+      new_snow[0][c] += area_fracs[0][c] * met.Ps;
+
+      if (vo_->os_OK(Teuchos::VERB_EXTREME)) {
+#ifdef _OPENMP
+#pragma omp critical
+#endif
+        *vo_->os() << "CELL " << c << " NO_SNOW"
+                   << ": Ms = " << flux.M_surf << ", Es = " << flux.E_surf * 1.e-6
+                   << ", Mss = " << ss_water_source_l << ", Ess = " << ss_energy_source_l
+                   << ", Sn = " << flux.M_snow << std::endl;
+      }
+
+      // diagnostics
+      if (diagnostics_) {
+        (*evap_rate)[0][c] -= area_fracs[0][c] * mb.Me;
+        (*qE_sh)[0][c] += area_fracs[0][c] * eb.fQh;
+        (*qE_lh)[0][c] += area_fracs[0][c] * eb.fQe;
+        (*qE_lw_out)[0][c] += area_fracs[0][c] * eb.fQlwOut;
+        (*qE_cond)[0][c] += area_fracs[0][c] * eb.fQc;
+        (*albedo)[0][c] += area_fracs[0][c] * surf.albedo;
 
-    for (auto c : lc_ids) {
-      // get the top cell
-      AmanziMesh::Entity_ID subsurf_f = mesh.entity_get_parent(AmanziMesh::CELL, c);
-      AmanziMesh::Entity_ID_List cells;
-      mesh_ss.face_get_cells(subsurf_f, AmanziMesh::Parallel_type::OWNED, &cells);
-      AMANZI_ASSERT(cells.size() == 1);
-
-      // met data structure
-      Relations::MetData met;
-      met.Z_Us = wind_speed_ref_ht_;
-      met.Us = std::max(wind_speed[0][c], min_wind_speed_);
-      met.QswIn = qSW_in[0][c];
-      met.QlwIn = qLW_in[0][c];
-      met.air_temp = air_temp[0][c];
-      met.relative_humidity = std::max(rel_hum[0][c], min_rel_hum_);
-      met.Pr = Prain[0][c];
-
-      // non-snow covered column
-      if (area_fracs[0][c] > 0) {
-        Relations::GroundProperties surf;
-        surf.temp = surf_temp[0][c];
-        surf.water_transition_depth = lc.second.water_transition_depth;
-        if (ponded_depth[0][c] > lc.second.water_transition_depth) {
-          surf.pressure = surf_pres[0][c];
-          surf.porosity = 1.;
-          surf.saturation_gas = 0.;
-        } else {
-          double factor = std::max(ponded_depth[0][c],0.) /
-            lc.second.water_transition_depth;
-          surf.pressure = factor*surf_pres[0][c] + (1-factor)*ss_pres[0][cells[0]];
-          surf.porosity = factor + (1-factor)*poro[0][cells[0]];
-          surf.saturation_gas = (1-factor)*sat_gas[0][cells[0]];
-        }
-        if (model_1p1_) surf.pressure = surf_pres[0][c];
-        surf.ponded_depth = ponded_depth[0][c];
-        surf.unfrozen_fraction = unfrozen_fraction[0][c];
-        surf.roughness = lc.second.roughness_ground;
-        if (model_1p1_) surf.density_w = 1000.;
-        else surf.density_w = mass_dens[0][c];
-        surf.dz = lc.second.dessicated_zone_thickness;
-        surf.albedo = sg_albedo[0][c];
-        surf.emissivity = emissivity[0][c];
-
-        // must ensure that energy is put into melting snow precip, even if it
-        // all melts so there is no snow column
         if (area_fracs[1][c] == 0.) {
-          met.Ps = Psnow[0][c];
-          surf.snow_death_rate = snow_death_rate[0][c]; // m H20 / s
-        } else {
-          met.Ps = 0.;
-          surf.snow_death_rate = 0.;
+          (*qE_sm)[0][c] = eb.fQm;
+          (*melt_rate)[0][c] = mb.Mm;
+          (*snow_temp)[0][c] = 273.15;
         }
+      }
+    }
 
-        // calculate the surface balance
-        const Relations::EnergyBalance eb = Relations::UpdateEnergyBalanceWithoutSnow(surf, met, params);
-        Relations::MassBalance mb = Relations::UpdateMassBalanceWithoutSnow(surf, params, eb);
-        Relations::FluxBalance flux = Relations::UpdateFluxesWithoutSnow(surf, met, params, eb, mb, model_1p1_);
-
-        // fQe, Me positive is condensation, water flux positive to surface
-        water_source[0][c] += area_fracs[0][c] * flux.M_surf;
-        energy_source[0][c] += area_fracs[0][c] * flux.E_surf * 1.e-6; // convert to MW/m^2
-
-        double area_to_volume = mesh.cell_volume(c) / mesh_ss.cell_volume(cells[0]);
-        double ss_water_source_l;
-        if (model_1p1_) ss_water_source_l = flux.M_subsurf * area_to_volume * surf.density_w / 0.0180153; // convert from m/s to mol/m^3/s
-        else ss_water_source_l = flux.M_subsurf * area_to_volume * mol_dens[0][c]; // convert from m/s to mol/m^3/s
-        ss_water_source[0][cells[0]] += area_fracs[0][c] * ss_water_source_l;
-        double ss_energy_source_l = flux.E_subsurf * area_to_volume * 1.e-6; // convert from W/m^2 to MW/m^3
-        ss_energy_source[0][cells[0]] += area_fracs[0][c] * ss_energy_source_l;
-
-        snow_source[0][c] += area_fracs[0][c] * flux.M_snow;
-        new_snow[0][c] += area_fracs[0][c] * met.Ps;
-
-        if (vo_->os_OK(Teuchos::VERB_EXTREME))
-          *vo_->os() << "CELL " << c << " NO_SNOW"
-                     << ": Ms = " << flux.M_surf << ", Es = " << flux.E_surf * 1.e-6
-                     << ", Mss = " << ss_water_source_l << ", Ess = " << ss_energy_source_l
-                     << ", Sn = " << flux.M_snow << std::endl;
-
-        // diagnostics
-        if (diagnostics_) {
-          (*evap_rate)[0][c] -= area_fracs[0][c] * mb.Me;
-          (*qE_sh)[0][c] += area_fracs[0][c] * eb.fQh;
-          (*qE_lh)[0][c] += area_fracs[0][c] * eb.fQe;
-          (*qE_lw_out)[0][c] += area_fracs[0][c] * eb.fQlwOut;
-          (*qE_cond)[0][c] += area_fracs[0][c] * eb.fQc;
-          (*albedo)[0][c] += area_fracs[0][c] * surf.albedo;
-
-          if (area_fracs[1][c] == 0.) {
-            (*qE_sm)[0][c] = eb.fQm;
-            (*melt_rate)[0][c] = mb.Mm;
-            (*snow_temp)[0][c] = 273.15;
-          }
-        }
+    // snow column
+    if (area_fracs[1][c] > 0.) {
+      Relations::GroundProperties surf;
+      surf.temp = surf_temp[0][c];
+      surf.pressure = surf_pres[0][c];
+      surf.ponded_depth = ponded_depth[0][c];
+      surf.porosity = 1.;
+      surf.saturation_gas = 0.;
+      surf.unfrozen_fraction = unfrozen_fraction[0][c];
+      surf.roughness = lc.roughness_ground;
+      if (model_1p1_) surf.density_w = 1000;
+      else surf.density_w = mass_dens[0][c];
+      surf.dz = lc.dessicated_zone_thickness;
+      surf.albedo = sg_albedo[1][c];
+      surf.emissivity = emissivity[1][c];
+      surf.water_transition_depth = lc.water_transition_depth;
+
+      met.Ps = Psnow[0][c] / area_fracs[1][c];
+
+      Relations::SnowProperties snow;
+      snow.height = snow_depth[0][c] / area_fracs[1][c]; // all snow on this patch
+      AMANZI_ASSERT(snow.height >= lc.snow_transition_depth - 1.e-6);
+      // area_fracs may have been set to 1 for snow depth < snow_ground_trans
+      // due to min fractional area option in area_fractions evaluator.
+      // Decreasing the tol by 1e-6 is about equivalent to a min fractional
+      // area of 1e-5 (the default)
+      snow.density = snow_dens[0][c];
+      snow.albedo = surf.albedo;
+      snow.emissivity = surf.emissivity;
+      snow.roughness = lc.roughness_snow;
+      snow.temp = snow_temp_guess.empty() ? Relations::NaN : snow_temp_guess[c];
+
+      const Relations::EnergyBalance eb = Relations::UpdateEnergyBalanceWithSnow(surf, met, params, snow);
+      const Relations::MassBalance mb = Relations::UpdateMassBalanceWithSnow(surf, params, eb);
+      Relations::FluxBalance flux = Relations::UpdateFluxesWithSnow(surf, met, params, snow, eb, mb);
+
+      // fQe, Me positive is condensation, water flux positive to surface.  No
+      // need for subsurf as there is snow present.
+      water_source[0][c] += area_fracs[1][c] * flux.M_surf;
+      energy_source[0][c] += area_fracs[1][c] * flux.E_surf * 1.e-6; // convert to MW/m^2 from W/m^2
+      snow_source[0][c] += area_fracs[1][c] * flux.M_snow;
+      new_snow[0][c] += std::max(met.Ps + mb.Me, 0.) * area_fracs[1][c];
+
+      if (vo_->os_OK(Teuchos::VERB_EXTREME)) {
+#ifdef _OPENMP
+#pragma omp critical
+#endif
+        *vo_->os() << "CELL " << c << " SNOW"
+                   << ": Ms = " << flux.M_surf << ", Es = " << flux.E_surf * 1.e-6
+                   << ", Mss = " << 0. << ", Ess = " << 0.
+                   << ", Sn = " << flux.M_snow << std::endl;
       }
 
-      // snow column
-      if (area_fracs[1][c] > 0.) {
-        Relations::GroundProperties surf;
-        surf.temp = surf_temp[0][c];
-        surf.pressure = surf_pres[0][c];
-        surf.ponded_depth = ponded_depth[0][c];
-        surf.porosity = 1.;
-        surf.saturation_gas = 0.;
-        surf.unfrozen_fraction = unfrozen_fraction[0][c];
-        surf.roughness = lc.second.roughness_ground;
-        if (model_1p1_) surf.density_w = 1000;
-        else surf.density_w = mass_dens[0][c];
-        surf.dz = lc.second.dessicated_zone_thickness;
-        surf.albedo = sg_albedo[1][c];
-        surf.emissivity = emissivity[1][c];
-        surf.water_transition_depth = lc.second.water_transition_depth;
-
-        met.Ps = Psnow[0][c] / area_fracs[1][c];
-
-        Relations::SnowProperties snow;
-        snow.height = snow_depth[0][c] / area_fracs[1][c]; // all snow on this patch
-        AMANZI_ASSERT(snow.height >= lc.second.snow_transition_depth - 1.e-6);
-        // area_fracs may have been set to 1 for snow depth < snow_ground_trans
-        // due to min fractional area option in area_fractions evaluator.
-        // Decreasing the tol by 1e-6 is about equivalent to a min fractional
-        // area of 1e-5 (the default)
-        snow.density = snow_dens[0][c];
-        snow.albedo = surf.albedo;
-        snow.emissivity = surf.emissivity;
-        snow.roughness = lc.second.roughness_snow;
-
-        const Relations::EnergyBalance eb = Relations::UpdateEnergyBalanceWithSnow(surf, met, params, snow);
-        const Relations::MassBalance mb = Relations::UpdateMassBalanceWithSnow(surf, params, eb);
-        Relations::FluxBalance flux = Relations::UpdateFluxesWithSnow(surf, met, params, snow, eb, mb);
-
-        // fQe, Me positive is condensation, water flux positive to surface.  No
-        // need for subsurf as there is snow present.
-        water_source[0][c] += area_fracs[1][c] * flux.M_surf;
-        energy_source[0][c] += area_fracs[1][c] * flux.E_surf * 1.e-6; // convert to MW/m^2 from W/m^2
-        snow_source[0][c] += area_fracs[1][c] * flux.M_snow;
-        new_snow[0][c] += std::max(met.Ps + mb.Me, 0.) * area_fracs[1][c];
-
-        if (vo_->os_OK(Teuchos::VERB_EXTREME))
-          *vo_->os() << "CELL " << c << " SNOW"
-                     << ": Ms = " << flux.M_surf << ", Es = " << flux.E_surf * 1.e-6
-                     << ", Mss = " << 0. << ", Ess = " << 0.
-                     << ", Sn = " << flux.M_snow << std::endl;
-
-        // diagnostics
-        if (diagnostics_) {
-          (*evap_rate)[0][c] -= area_fracs[1][c] * mb.Me;
-          (*qE_sh)[0][c] += area_fracs[1][c] * eb.fQh;
-          (*qE_lh)[0][c] += area_fracs[1][c] * eb.fQe;
-          (*qE_lw_out)[0][c] += area_fracs[1][c] * eb.fQlwOut;
-          (*qE_cond)[0][c] += area_fracs[1][c] * eb.fQc;
-
-          (*qE_sm)[0][c] = area_fracs[1][c] * eb.fQm;
-          (*melt_rate)[0][c] = area_fracs[1][c] * mb.Mm;
-          (*snow_temp)[0][c] = snow.temp;
-          (*albedo)[0][c] += area_fracs[1][c] * surf.albedo;
-        }
+      // diagnostics
+      if (diagnostics_) {
+        (*evap_rate)[0][c] -= area_fracs[1][c] * mb.Me;
+        (*qE_sh)[0][c] += area_fracs[1][c] * eb.fQh;
+        (*qE_lh)[0][c] += area_fracs[1][c] * eb.fQe;
+        (*qE_lw_out)[0][c] += area_fracs[1][c] * eb.fQlwOut;
+        (*qE_cond)[0][c] += area_fracs[1][c] * eb.fQc;
+
+        (*qE_sm)[0][c] = area_fracs[1][c] * eb.fQm;
+        (*melt_rate)[0][c] = area_fracs[1][c] * mb.Mm;
+        (*albedo)[0][c] += area_fracs[1][c] * surf.albedo;
       }
+      if (snow_temp) (*snow_temp)[0][c] = snow.temp;
     }
-  }
+  };
+
+  ParallelFor(lc_cells_.size(), num_threads_, 64, [&](int i, int tid) {
+    AmanziMesh::Entity_ID c = lc_cells_[i];
+    evaluate_cell(c, *lcs[lc_index_->landCoverId(c)]);
+  });
 
   // debugging
   if (diagnostics_ && vo_->os_OK(Teuchos::VERB_HIGH)) {
@@ -540,11 +577,35 @@ SEBTwoComponentEvaluator::EnsureCompatibility(const Teuchos::Ptr<State>& S)
       db_ss_ = Teuchos::rcp(new Debugger(S->GetMesh(domain_ss_), my_keys_[0], plist));
     }
 
-    if (land_cover_.size() == 0)
+    if (land_cover_.size() == 0) {
       land_cover_ = getLandCover(S->ICList().sublist("land cover types"),
               {"roughness_snow", "roughness_ground",
                "water_transition_depth", "snow_transition_depth",
                "dessicated_zone_thickness"});
+      lc_index_ = getLandCoverIndex(S->GetMesh(domain_), land_cover_);
+
+      // cells with a land cover, in cell order
+      int ncells = S->GetMesh(domain_)->num_entities(AmanziMesh::CELL,
+              AmanziMesh::Parallel_type::OWNED);
+      for (AmanziMesh::Entity_ID c=0; c!=ncells; ++c) {
+        if (lc_index_->landCoverId(c) >= 0) lc_cells_.push_back(c);
+      }
+
+      // the subsurface cell below each of those cells, and the ratio of
+      // their sizes
+      const auto& mesh = *S->GetMesh(domain_);
+      const auto& mesh_ss = *S->GetMesh(domain_ss_);
+      top_cell_.resize(ncells);
+      area_to_volume_.resize(ncells);
+      AmanziMesh::Entity_ID_List cells;
+      for (auto c : lc_cells_) {
+        AmanziMesh::Entity_ID subsurf_f = mesh.entity_get_parent(AmanziMesh::CELL, c);
+        mesh_ss.face_get_cells(subsurf_f, AmanziMesh::Parallel_type::OWNED, &cells);
+        AMANZI_ASSERT(cells.size() == 1);
+        top_cell_[c] = cells[0];
+        area_to_volume_[c] = mesh.cell_volume(c) / mesh_ss.cell_volume(cells[0]);
+      }
+    }
 
     CompositeVectorSpace domain_fac;
     domain_fac.SetMesh(S->GetMesh(domain_))
@@ -598,7 +659,8 @@ SEBTwoComponentEvaluator::EnsureCompatibility(const Teuchos::Ptr<State>& S)
       bool io_my_key = plist_.get<bool>("visualize", true);
       S->GetField(my_key, my_key)->set_io_vis(io_my_key);
       bool checkpoint_my_key = plist_.get<bool>("checkpoint", false);
-      S->GetField(my_key, my_key)->set_io_checkpoint(checkpoint_my_key);
+      S->GetField(my_key, my_key)->set_io_checkpoint(checkpoint_my_key
+              || (warm_start_ && my_key == snow_temp_key_));
     }
 
     if (diagnostics_) {
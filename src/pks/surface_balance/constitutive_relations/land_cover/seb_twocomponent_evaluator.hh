@@ -26,6 +26,15 @@ the ground from the atmosphere.
    * `"minimum relative humidity [-]`" ``[double]`` **1.0** Sets a floor on relative
      humidity for potential wierd data.  Models have trouble with no
      humidity.
+   * `"snow temperature solver`" ``[string]`` **toms** Root finder for the
+     snow temperature, one of `"toms`", `"newton`", or `"bisection`".
+     `"newton`" is a safeguarded Newton iteration on the analytic derivative
+     of the energy balance, started from the last snow temperature in each
+     cell, which is then always stored and checkpointed as `"snow
+     temperature`".
+   * `"number of threads`" ``[int]`` **1** Cells are independent, and are
+     evaluated on this many OpenMP threads.  Ignored if ATS is built without
+     OpenMP.
 
    * `"save diagnostic data`" ``[bool]`` **false** Saves a suite of diagnostic variables to vis.
 
@@ -100,6 +109,9 @@ the ground from the atmosphere.
 
 #pragma once
 
+#include <utility>
+#include <vector>
+
 #include "Factory.hh"
 #include "Debugger.hh"
 #include "secondary_variables_field_evaluator.hh"
@@ -161,14 +173,25 @@ class SEBTwoComponentEvaluator : public SecondaryVariablesFieldEvaluator {
   double wind_speed_ref_ht_;    // reference height of the met data
 
   LandCoverMap land_cover_;
+  Teuchos::RCP<const LandCoverIndex> lc_index_;
 
   bool diagnostics_;
+  bool warm_start_;
   Teuchos::RCP<Debugger> db_;
   Teuchos::RCP<Debugger> db_ss_;
   Teuchos::ParameterList plist_;
 
   bool compatible_;
   bool model_1p1_;
+
+  // cells with a land cover, in cell order, and the subsurface cell below
+  // and ratio of surface area to subsurface volume of each cell
+  std::vector<AmanziMesh::Entity_ID> lc_cells_;
+  std::vector<AmanziMesh::Entity_ID> top_cell_;
+  std::vector<double> area_to_volume_;
+
+  int num_threads_;
+
  private:
   static Utils::RegisteredFactory<FieldEvaluator,SEBTwoComponentEvaluator> reg_;
 };
@@ -37,6 +37,7 @@ SnowMeltRateEvaluator::EnsureCompatibility(const Teuchos::Ptr<State>& S)
   // new state!
   land_cover_ = getLandCover(S->ICList().sublist("land cover types"),
                              {"snow_transition_depth"});
+  lc_index_ = getLandCoverIndex(S->GetMesh(domain_), land_cover_);
   SecondaryVariableFieldEvaluator::EnsureCompatibility(S);
 }
 
@@ -45,16 +46,13 @@ void
 SnowMeltRateEvaluator::EvaluateField_(const Teuchos::Ptr<State>& S,
         const Teuchos::Ptr<CompositeVector>& result)
 {
-  auto mesh = S->GetMesh(domain_);
-
   const auto& air_temp = *S->GetFieldData(temp_key_)->ViewComponent("cell", false);
   const auto& swe = *S->GetFieldData(snow_key_)->ViewComponent("cell", false);
   auto& res = *result->ViewComponent("cell", false);
 
+  int lc_id = 0;
   for (const auto& lc : land_cover_) {
-    AmanziMesh::Entity_ID_List lc_ids;
-    mesh->get_set_entities(lc.first, AmanziMesh::Entity_kind::CELL,
-                           AmanziMesh::Parallel_type::OWNED, &lc_ids);
+    const auto& lc_ids = lc_index_->cells(lc_id++);
 
     for (auto c : lc_ids) {
       if (air_temp[0][c] - snow_temp_shift_ > 273.15) {
@@ -76,16 +74,14 @@ void
 SnowMeltRateEvaluator::EvaluateFieldPartialDerivative_(const Teuchos::Ptr<State>& S,
           Key wrt_key, const Teuchos::Ptr<CompositeVector>& result)
 {
-  auto mesh = S->GetMesh(domain_);
   const auto& air_temp = *S->GetFieldData(temp_key_)->ViewComponent("cell", false);
   const auto& swe = *S->GetFieldData(snow_key_)->ViewComponent("cell", false);
   auto& res = *result->ViewComponent("cell", false);
 
   if (wrt_key == temp_key_) {
+    int lc_id = 0;
     for (const auto& lc : land_cover_) {
-      AmanziMesh::Entity_ID_List lc_ids;
-      mesh->get_set_entities(lc.first, AmanziMesh::Entity_kind::CELL,
-                             AmanziMesh::Parallel_type::OWNED, &lc_ids);
+      const auto& lc_ids = lc_index_->cells(lc_id++);
       for (auto c : lc_ids) {
         if (air_temp[0][c] - snow_temp_shift_ > 273.15) {
           res[0][c] = melt_rate_;
@@ -99,10 +95,9 @@ SnowMeltRateEvaluator::EvaluateFieldPartialDerivative_(const Teuchos::Ptr<State>
     }
 
   } else if (wrt_key == snow_key_) {
+    int lc_id = 0;
     for (const auto& lc : land_cover_) {
-      AmanziMesh::Entity_ID_List lc_ids;
-      mesh->get_set_entities(lc.first, AmanziMesh::Entity_kind::CELL,
-                             AmanziMesh::Parallel_type::OWNED, &lc_ids);
+      const auto& lc_ids = lc_index_->cells(lc_id++);
       for (auto c : lc_ids) {
         if (swe[0][c] < lc.second.snow_transition_depth && air_temp[0][c] - snow_temp_shift_ > 273.15) {
           res[0][c] = melt_rate_ * (air_temp[0][c] - snow_temp_shift_ - 273.15) / lc.second.snow_transition_depth;
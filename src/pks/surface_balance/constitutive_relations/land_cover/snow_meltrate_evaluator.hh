@@ -80,6 +80,7 @@ class SnowMeltRateEvaluator : public SecondaryVariableFieldEvaluator {
   bool compatibility_checked_;
 
   LandCoverMap land_cover_;
+  Teuchos::RCP<const LandCoverIndex> lc_index_;
 
  private:
   static Utils::RegisteredFactory<FieldEvaluator,SnowMeltRateEvaluator> reg_;
@@ -93,26 +93,32 @@ TranspirationDistributionEvaluator::EvaluateField_(const Teuchos::Ptr<State>& S,
 
   double p_atm = *S->GetScalarData("atmospheric_pressure");
 
-  auto& subsurf_mesh = *S->GetMesh(domain_sub_);
-  auto& surf_mesh = *S->GetMesh(domain_surf_);
+  if (columns_ == Teuchos::null)
+    columns_ = Teuchos::rcp(new ColumnView(*S->GetMesh(domain_sub_), potential_trans.MyLength()));
+  const ColumnView& columns = *columns_;
+
+  // workspace for columns that are not contiguous in the subsurface vectors
+  std::vector<double> f_wp_work(columns.max_num_cells());
+  std::vector<double> f_root_work(columns.max_num_cells());
+  std::vector<double> cv_work(columns.max_num_cells());
+  std::vector<double> result_col(columns.max_num_cells());
 
   result_v.PutScalar(0.);
+  int lc_id = 0;
   for (const auto& region_lc : land_cover_) {
-    AmanziMesh::Entity_ID_List lc_ids;
-    surf_mesh.get_set_entities(region_lc.first, AmanziMesh::Entity_kind::CELL,
-                           AmanziMesh::Parallel_type::OWNED, &lc_ids);
+    const auto& lc_ids = lc_index_->cells(lc_id++);
 
     if (TranspirationPeriod_(S->time(), region_lc.second.leaf_on_doy, region_lc.second.leaf_off_doy)) {
       for (int sc : lc_ids) {
+        int ncells = columns.num_cells(sc);
+        const double* f_wp_col = columns.column(*f_wp(0), sc, f_wp_work.data());
+        const double* f_root_col = columns.column(*f_root(0), sc, f_root_work.data());
+        const double* cv_col = columns.column(*cv(0), sc, cv_work.data());
+
         double column_total = 0.;
-        double f_root_total = 0.;
-        double f_wp_total = 0.;
-        double var_dz = 0.;
-        for (auto c : subsurf_mesh.cells_of_column(sc)) {
-          column_total += f_wp[0][c] * f_root[0][c] * cv[0][c];
-          result_v[0][c] = f_wp[0][c] * f_root[0][c];
-          if (f_wp[0][c] * f_root[0][c] > 0)
-            var_dz += cv[0][c];
+        for (int i=0; i!=ncells; ++i) {
+          result_col[i] = f_wp_col[i] * f_root_col[i];
+          column_total += result_col[i] * cv_col[i];
         }
 
         if (column_total > 0.) {
@@ -125,13 +131,14 @@ TranspirationDistributionEvaluator::EvaluateField_(const Teuchos::Ptr<State>& S,
             coef *= limiting_factor;
           }
 
-          for (auto c : subsurf_mesh.cells_of_column(sc)) {
-            result_v[0][c] *= coef;
+          for (int i=0; i!=ncells; ++i) {
+            result_col[i] *= coef;
             if (limiter_local_) {
-              result_v[0][c] *= f_wp[0][c];
+              result_col[i] *= f_wp_col[i];
             }
           }
         }
+        columns.ScatterColumn(result_col.data(), sc, *result_v(0));
       }
     }
   }
@@ -150,9 +157,11 @@ void
 TranspirationDistributionEvaluator::EnsureCompatibility(const Teuchos::Ptr<State>& S)
 {
   // new state!
-  if (land_cover_.size() == 0)
+  if (land_cover_.size() == 0) {
     land_cover_ = getLandCover(S->ICList().sublist("land cover types"),
             {"leaf_on_doy", "leaf_off_doy"});
+    lc_index_ = getLandCoverIndex(S->GetMesh(domain_surf_), land_cover_);
+  }
 
   // Ensure my field exists.  Requirements should be already set.
   AMANZI_ASSERT(!my_key_.empty());
@@ -81,6 +81,7 @@ from the LandCover type.
 #include "Factory.hh"
 #include "secondary_variable_field_evaluator.hh"
 #include "LandCover.hh"
+#include "column_view.hh"
 
 namespace Amanzi {
 
@@ -123,6 +124,8 @@ class TranspirationDistributionEvaluator : public SecondaryVariableFieldEvaluato
   double year_duration_;
 
   LandCoverMap land_cover_;
+  Teuchos::RCP<const LandCoverIndex> lc_index_;
+  Teuchos::RCP<ColumnView> columns_;
 
   bool limiter_local_;
   Teuchos::RCP<Function> limiter_;
@@ -0,0 +1,95 @@
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <tuple>
+#include "UnitTest++.h"
+
+#include "seb_physics_defs.hh"
+#include "seb_physics_funcs.hh"
+
+using namespace Amanzi::SurfaceBalance::Relations;
+
+namespace {
+
+// A random, physically reasonable snow-covered cell.
+struct SnowCell {
+  GroundProperties surf;
+  SnowProperties snow;
+  MetData met;
+  EnergyBalance eb;
+
+  explicit SnowCell(std::mt19937& gen) {
+    auto uniform = [&gen](double a, double b) {
+      return std::uniform_real_distribution<double>(a, b)(gen);
+    };
+
+    surf.temp = uniform(250., 275.);
+    surf.roughness = uniform(0.005, 0.1);
+
+    snow.height = uniform(0.02, 1.);
+    snow.density = uniform(100., 450.);
+    snow.albedo = uniform(0.5, 0.9);
+    snow.emissivity = uniform(0.95, 0.99);
+    snow.roughness = 0.002;
+
+    met.Us = uniform(0.5, 10.);
+    met.Z_Us = 2.;
+    met.QswIn = uniform(0., 500.);
+    met.QlwIn = uniform(150., 350.);
+    met.air_temp = uniform(240., 280.);
+    met.relative_humidity = uniform(0.3, 1.);
+
+    std::tie(eb.fQswIn, eb.fQlwIn) = IncomingRadiation(met, snow.albedo);
+  }
+};
+
+} // namespace
+
+
+TEST(SEB_SNOW_TEMPERATURE_DERIVATIVE) {
+  std::mt19937 gen(7);
+  ModelParams params;
+  const double h = 1.e-4;
+
+  for (int n=0; n!=1000; ++n) {
+    SnowCell cell(gen);
+    for (double temp = 230.; temp < 290.; temp += 3.7) {
+      // the stability function has a kink at the air temperature
+      if (std::abs(temp - cell.met.air_temp) < 2*h) continue;
+
+      cell.snow.temp = temp + h;
+      UpdateEnergyBalanceWithSnow_Inner(cell.surf, cell.snow, cell.met, params, cell.eb);
+      double fQm_plus = cell.eb.fQm;
+      cell.snow.temp = temp - h;
+      UpdateEnergyBalanceWithSnow_Inner(cell.surf, cell.snow, cell.met, params, cell.eb);
+      double fQm_minus = cell.eb.fQm;
+      double fd = (fQm_plus - fQm_minus) / (2*h);
+
+      cell.snow.temp = temp;
+      double dfQm = DEnergyBalanceWithSnowDSnowTemp_Inner(cell.surf, cell.snow, cell.met, params);
+      CHECK_CLOSE(fd, dfQm, 1.e-5 * std::max(1., std::abs(fd)));
+    }
+  }
+}
+
+
+TEST(SEB_SNOW_TEMPERATURE_NEWTON_VS_TOMS) {
+  std::mt19937 gen(11);
+  ModelParams params;
+
+  for (int n=0; n!=1000; ++n) {
+    SnowCell cell(gen);
+
+    cell.snow.temp = NaN;
+    double temp_toms = DetermineSnowTemperature(cell.surf, cell.met, params, cell.snow, cell.eb, "toms");
+
+    cell.snow.temp = NaN;
+    double temp_newton = DetermineSnowTemperature(cell.surf, cell.met, params, cell.snow, cell.eb, "newton");
+    CHECK_CLOSE(temp_toms, temp_newton, 1.e-6);
+
+    // an initial guess may change the iteration, but not the root
+    cell.snow.temp = temp_toms + 5.;
+    double temp_guess = DetermineSnowTemperature(cell.surf, cell.met, params, cell.snow, cell.eb, "newton");
+    CHECK_CLOSE(temp_toms, temp_guess, 1.e-6);
+  }
+}
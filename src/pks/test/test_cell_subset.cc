@@ -0,0 +1,232 @@
+/* -*-  mode: c++; indent-tabs-mode: nil -*- */
+/*
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+*/
+
+#include <vector>
+#include "UnitTest++.h"
+
+#include "Teuchos_ParameterList.hpp"
+
+#include "AmanziComm.hh"
+#include "GeometricModel.hh"
+#include "MeshFactory.hh"
+#include "State.hh"
+#include "primary_variable_field_evaluator.hh"
+#include "secondary_variable_field_evaluator.hh"
+
+#include "cell_subset_evaluator.hh"
+
+using namespace Amanzi;
+
+namespace {
+
+// f = a * dep + b on cells, counting the cells it is evaluated on.
+class LinearEvaluator : public SecondaryVariableFieldEvaluator {
+ public:
+  LinearEvaluator(Teuchos::ParameterList& plist) :
+      SecondaryVariableFieldEvaluator(plist)
+  {
+    dep_key_ = plist_.get<std::string>("dependency");
+    dependencies_.insert(dep_key_);
+    a_ = plist_.get<double>("a");
+    b_ = plist_.get<double>("b");
+  }
+
+  Teuchos::RCP<FieldEvaluator> Clone() const {
+    return Teuchos::rcp(new LinearEvaluator(*this));
+  }
+
+  virtual void EvaluateField_(const Teuchos::Ptr<State>& S,
+          const Teuchos::Ptr<CompositeVector>& result) {
+    const Epetra_MultiVector& dep = *S->GetFieldData(dep_key_)->ViewComponent("cell",false);
+    Epetra_MultiVector& res = *result->ViewComponent("cell",false);
+    for (int c=0; c!=res.MyLength(); ++c) res[0][c] = a_ * dep[0][c] + b_;
+    nevaluated += res.MyLength();
+  }
+
+  virtual void EvaluateFieldPartialDerivative_(const Teuchos::Ptr<State>& S,
+          Key wrt_key, const Teuchos::Ptr<CompositeVector>& result) {
+    result->PutScalar(a_);
+  }
+
+  int nevaluated = 0;
+
+ protected:
+  Key dep_key_;
+  double a_, b_;
+};
+
+
+// The same, but able to update a subset of cells.
+class LinearSubsetEvaluator : public LinearEvaluator,
+                              public CellSubsetEvaluator {
+ public:
+  using LinearEvaluator::LinearEvaluator;
+
+  Teuchos::RCP<FieldEvaluator> Clone() const {
+    return Teuchos::rcp(new LinearSubsetEvaluator(*this));
+  }
+
+  virtual CellSubsetChange HasFieldChangedOnCells(const Teuchos::Ptr<State>& S,
+          const Key& request, const AmanziMesh::Entity_ID_List& cells) {
+    return HasFieldChangedOnCells_(S, request, cells, my_key_, dependencies_, requests_,
+            [&]() { return EvaluateFieldOnCells_(S, cells); },
+            [&]() { UpdateField_(S); });
+  }
+
+ protected:
+  virtual void UpdateField_(const Teuchos::Ptr<State>& S) {
+    changed_on_cells_ = false;
+    LinearEvaluator::UpdateField_(S);
+  }
+
+  bool EvaluateFieldOnCells_(const Teuchos::Ptr<State>& S,
+          const AmanziMesh::Entity_ID_List& cells) {
+    Teuchos::RCP<CompositeVector> result = S->GetFieldData(my_key_, my_key_);
+    std::vector<AmanziMesh::Entity_ID_List> entities;
+    if (!getCellSubsetEntities(*result, cells, entities)) return false;
+
+    const Epetra_MultiVector& dep = *S->GetFieldData(dep_key_)->ViewComponent("cell",false);
+    Epetra_MultiVector& res = *result->ViewComponent("cell",false);
+    for (auto c : entities[0]) res[0][c] = a_ * dep[0][c] + b_;
+    nevaluated += entities[0].size();
+    return true;
+  }
+};
+
+
+// A column of four cells with primary variable p.
+struct ColumnState {
+  ColumnState() {
+    auto comm = getDefaultComm();
+    auto gm = Teuchos::rcp(new AmanziGeometry::GeometricModel(3));
+    AmanziMesh::MeshFactory factory(comm, gm);
+    mesh = factory.create(0.0, 0.0, 0.0, 1.0, 1.0, 4.0, 1, 1, 4);
+
+    Teuchos::ParameterList state_list("state");
+    S = Teuchos::rcp(new State(state_list));
+    S->RegisterDomainMesh(mesh);
+
+    Teuchos::ParameterList p_list("p");
+    p_list.set("evaluator name", "p");
+    p_eval = Teuchos::rcp(new PrimaryVariableFieldEvaluator(p_list));
+    Require("p", p_eval);
+  }
+
+  void Require(const Key& key, const Teuchos::RCP<FieldEvaluator>& eval) {
+    S->RequireField(key, key)->SetMesh(mesh)->SetGhosted(false)
+        ->SetComponent("cell", AmanziMesh::CELL, 1);
+    S->SetFieldEvaluator(key, eval);
+  }
+
+  template<typename Eval>
+  Teuchos::RCP<Eval> RequireLinear(const Key& key, const Key& dep, double a, double b) {
+    Teuchos::ParameterList plist(key);
+    plist.set("evaluator name", key);
+    plist.set("dependency", dep);
+    plist.set("a", a);
+    plist.set("b", b);
+    auto eval = Teuchos::rcp(new Eval(plist));
+    Require(key, eval);
+    return eval;
+  }
+
+  void Setup() {
+    S->Setup();
+    S->GetFieldData("p", "p")->PutScalar(1.0);
+    S->GetField("p", "p")->set_initialized();
+  }
+
+  // change p on cells and tell its evaluator
+  void SetPressure(const AmanziMesh::Entity_ID_List& cells, double value) {
+    Epetra_MultiVector& p = *S->GetFieldData("p", "p")->ViewComponent("cell",false);
+    for (auto c : cells) p[0][c] = value;
+    p_eval->SetFieldAsChanged(S.ptr());
+  }
+
+  double Value(const Key& key, int c) {
+    return (*S->GetFieldData(key)->ViewComponent("cell",false))[0][c];
+  }
+
+  Teuchos::RCP<AmanziMesh::Mesh> mesh;
+  Teuchos::RCP<State> S;
+  Teuchos::RCP<PrimaryVariableFieldEvaluator> p_eval;
+};
+
+} // namespace
+
+
+TEST(CELL_SUBSET_UPDATES_ONLY_CELLS) {
+  ColumnState cs;
+  auto wc = cs.RequireLinear<LinearSubsetEvaluator>("wc", "p", 2.0, 0.0);
+  cs.Setup();
+
+  // never evaluated, so evaluated everywhere
+  AmanziMesh::Entity_ID_List cells = { 1, 2 };
+  CHECK(CellSubsetChange::ALL == wc->HasFieldChangedOnCells(cs.S.ptr(), "mpc", cells));
+  CHECK_EQUAL(4, wc->nevaluated);
+  CHECK(CellSubsetChange::NONE == wc->HasFieldChangedOnCells(cs.S.ptr(), "mpc", cells));
+  CHECK_EQUAL(4, wc->nevaluated);
+
+  cs.SetPressure(cells, 3.0);
+  UpdateFieldsOnCells(cs.S.ptr(), { "wc" }, "mpc", cells);
+  CHECK_EQUAL(6, wc->nevaluated);
+  for (int c=0; c!=4; ++c) {
+    double p = (c == 1 || c == 2) ? 3.0 : 1.0;
+    CHECK_CLOSE(2.0 * p, cs.Value("wc", c), 1.e-12);
+  }
+
+  // other consumers see the change without a further evaluation
+  CHECK(!wc->HasFieldChanged(cs.S.ptr(), "mpc"));
+  CHECK(wc->HasFieldChanged(cs.S.ptr(), "pk"));
+  CHECK(!wc->HasFieldChanged(cs.S.ptr(), "pk"));
+  CHECK_EQUAL(6, wc->nevaluated);
+
+  // as do those asking about a subset
+  CHECK(CellSubsetChange::NONE == wc->HasFieldChangedOnCells(cs.S.ptr(), "pk", cells));
+  CHECK(CellSubsetChange::CELLS == wc->HasFieldChangedOnCells(cs.S.ptr(), "other", cells));
+  CHECK_EQUAL(6, wc->nevaluated);
+}
+
+
+TEST(CELL_SUBSET_PROPAGATES_THROUGH_SUBSET_EVALUATORS) {
+  ColumnState cs;
+  auto sat = cs.RequireLinear<LinearSubsetEvaluator>("sat", "p", 0.5, 0.0);
+  auto wc = cs.RequireLinear<LinearSubsetEvaluator>("wc", "sat", 4.0, 1.0);
+  cs.Setup();
+  CHECK(wc->HasFieldChanged(cs.S.ptr(), "mpc"));
+
+  AmanziMesh::Entity_ID_List cells = { 3 };
+  cs.SetPressure(cells, 5.0);
+  CHECK(CellSubsetChange::CELLS == wc->HasFieldChangedOnCells(cs.S.ptr(), "mpc", cells));
+  CHECK_EQUAL(5, sat->nevaluated);
+  CHECK_EQUAL(5, wc->nevaluated);
+  CHECK_CLOSE(4.0 * 0.5 * 5.0 + 1.0, cs.Value("wc", 3), 1.e-12);
+  CHECK_CLOSE(4.0 * 0.5 * 1.0 + 1.0, cs.Value("wc", 0), 1.e-12);
+}
+
+
+TEST(CELL_SUBSET_FALLS_BACK_TO_FULL_EVALUATION) {
+  ColumnState cs;
+  auto sat = cs.RequireLinear<LinearEvaluator>("sat", "p", 0.5, 0.0);
+  auto wc = cs.RequireLinear<LinearSubsetEvaluator>("wc", "sat", 4.0, 1.0);
+  cs.Setup();
+  CHECK(wc->HasFieldChanged(cs.S.ptr(), "mpc"));
+
+  // sat may have changed anywhere, so wc is evaluated everywhere
+  AmanziMesh::Entity_ID_List cells = { 0 };
+  cs.SetPressure(cells, 5.0);
+  CHECK(CellSubsetChange::ALL == wc->HasFieldChangedOnCells(cs.S.ptr(), "mpc", cells));
+  CHECK_EQUAL(8, sat->nevaluated);
+  CHECK_EQUAL(8, wc->nevaluated);
+  CHECK_CLOSE(4.0 * 0.5 * 5.0 + 1.0, cs.Value("wc", 0), 1.e-12);
+
+  // a later full update is not taken for a subset one
+  cs.SetPressure(cells, 7.0);
+  CHECK(wc->HasFieldChanged(cs.S.ptr(), "mpc"));
+  CHECK(CellSubsetChange::ALL == wc->HasFieldChangedOnCells(cs.S.ptr(), "pk", cells));
+  CHECK_CLOSE(4.0 * 0.5 * 7.0 + 1.0, cs.Value("wc", 0), 1.e-12);
+}
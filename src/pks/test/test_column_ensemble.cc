@@ -0,0 +1,149 @@
+#include <cmath>
+#include <vector>
+#include "UnitTest++.h"
+
+#include "column_ensemble.hh"
+#include "column_newton.hh"
+
+using namespace Amanzi;
+
+namespace {
+
+// Columns of differing lengths, in domain set order.
+const std::vector<int> column_ncells = { 3, 5, 3, 3, 5, 4 };
+
+std::vector<Key>
+ColumnDomains()
+{
+  std::vector<Key> domains;
+  for (int i=0; i!=column_ncells.size(); ++i) domains.emplace_back("column_" + std::to_string(i));
+  return domains;
+}
+
+// F = -u_k-1 + 2 u_k - u_k+1 + u_k^3 - f_k in one column, zero outside.
+double
+ColumnResidual(const double* u, const double* f, int ncells, int k)
+{
+  double um = k > 0 ? u[k-1] : 0.;
+  double up = k < ncells-1 ? u[k+1] : 0.;
+  return -um + 2*u[k] - up + u[k]*u[k]*u[k] - f[k];
+}
+
+// The same residual for all columns of a group, in ensemble-packed layout.
+struct PackedModel {
+  PackedModel(int ncols, int ncells, std::vector<double>&& f) :
+      n(ncols), ncells(ncells), f(f) {}
+
+  void Residual(const double* u, double* r) {
+    for (int k=0; k!=ncells; ++k) {
+      for (int i=0; i!=n; ++i) {
+        double um = k > 0 ? u[(k-1)*n + i] : 0.;
+        double up = k < ncells-1 ? u[(k+1)*n + i] : 0.;
+        double uk = u[k*n + i];
+        r[k*n + i] = -um + 2*uk - up + uk*uk*uk - f[k*n + i];
+      }
+    }
+  }
+
+  void Jacobian(const double* u, BatchedBlockTridiagonal& J) {
+    for (int j=0; j!=ncells*n; ++j) {
+      J.D(0,0)[j] = 2 + 3*u[j]*u[j];
+      J.L(0,0)[j] = -1.;
+      J.U(0,0)[j] = -1.;
+    }
+  }
+
+  int n, ncells;
+  std::vector<double> f;
+};
+
+} // namespace
+
+
+TEST(COLUMN_ENSEMBLE_GROUPS) {
+  ColumnEnsemble ensemble(ColumnDomains(), column_ncells);
+
+  // groups in order of first appearance
+  CHECK_EQUAL(3, ensemble.num_groups());
+  CHECK_EQUAL(3, ensemble.num_cells(0));
+  CHECK_EQUAL(5, ensemble.num_cells(1));
+  CHECK_EQUAL(4, ensemble.num_cells(2));
+  CHECK_EQUAL(3, ensemble.num_columns(0));
+  CHECK_EQUAL(2, ensemble.num_columns(1));
+  CHECK_EQUAL(1, ensemble.num_columns(2));
+  CHECK_EQUAL(9, ensemble.size(0));
+
+  // columns keep domain set order within a group
+  CHECK(ensemble.domains(0) == std::vector<Key>({"column_0", "column_2", "column_3"}));
+  CHECK(ensemble.domains(1) == std::vector<Key>({"column_1", "column_4"}));
+  CHECK(ensemble.domains(2) == std::vector<Key>({"column_5"}));
+
+  const std::vector<std::pair<int,int> > positions =
+    { {0,0}, {1,0}, {0,1}, {0,2}, {1,1}, {2,0} };
+  for (int i=0; i!=positions.size(); ++i) {
+    CHECK(ensemble.position(i) == positions[i]);
+    const auto& pos = ensemble.position(i);
+    CHECK_EQUAL(column_ncells[i], ensemble.num_cells(pos.first));
+    CHECK_EQUAL(ColumnDomains()[i], ensemble.domains(pos.first)[pos.second]);
+  }
+}
+
+
+TEST(COLUMN_ENSEMBLE_LAYOUT) {
+  ColumnEnsemble ensemble(ColumnDomains(), column_ncells);
+
+  for (int g=0; g!=ensemble.num_groups(); ++g) {
+    int ncols = ensemble.num_columns(g);
+    int ncells = ensemble.num_cells(g);
+    std::vector<double> packed(ensemble.size(g), -1.);
+    for (int i=0; i!=ncols; ++i) {
+      std::vector<double> col(ncells);
+      for (int k=0; k!=ncells; ++k) col[k] = 100.*i + k;
+      ensemble.GatherColumn(col.data(), g, i, packed.data());
+    }
+
+    // cell-major: cell k of column i is packed[k*ncols + i]
+    for (int k=0; k!=ncells; ++k) {
+      for (int i=0; i!=ncols; ++i) CHECK_EQUAL(100.*i + k, packed[k*ncols + i]);
+    }
+
+    for (int i=0; i!=ncols; ++i) {
+      std::vector<double> col(ncells, -1.);
+      ensemble.ScatterColumn(packed.data(), g, i, col.data());
+      for (int k=0; k!=ncells; ++k) CHECK_EQUAL(100.*i + k, col[k]);
+    }
+  }
+}
+
+
+TEST(COLUMN_ENSEMBLE_NEWTON) {
+  // Solve each group in batch, then check each column against its own,
+  // unbatched residual.
+  ColumnEnsemble ensemble(ColumnDomains(), column_ncells);
+
+  for (int g=0; g!=ensemble.num_groups(); ++g) {
+    int ncols = ensemble.num_columns(g);
+    int ncells = ensemble.num_cells(g);
+
+    // column-specific source, packed
+    std::vector<std::vector<double> > f_cols(ncols, std::vector<double>(ncells));
+    std::vector<double> f(ensemble.size(g));
+    for (int i=0; i!=ncols; ++i) {
+      for (int k=0; k!=ncells; ++k) f_cols[i][k] = 0.1 * (i+1) + 0.05 * k;
+      ensemble.GatherColumn(f_cols[i].data(), g, i, f.data());
+    }
+
+    PackedModel model(ncols, ncells, std::move(f));
+    std::vector<double> u(ensemble.size(g), 0.);
+    int its = 0;
+    CHECK_EQUAL(0, ColumnNewton(model, ensemble, g, 1, u.data(), 1.e-12, 20, its));
+
+    std::vector<double> u_col(ncells);
+    for (int i=0; i!=ncols; ++i) {
+      ensemble.ScatterColumn(u.data(), g, i, u_col.data());
+      for (int k=0; k!=ncells; ++k) {
+        CHECK_CLOSE(0., ColumnResidual(u_col.data(), f_cols[i].data(), ncells, k), 1.e-12);
+      }
+    }
+  }
+}
@@ -0,0 +1,146 @@
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+#include "UnitTest++.h"
+
+#include "column_block_tridiagonal.hh"
+#include "column_newton.hh"
+
+using namespace Amanzi;
+
+namespace {
+
+// Two coupled nonlinear diffusion equations per column, with zero Dirichlet
+// data outside of the column:
+//
+//   F0 = -u_k-1 + 2 u_k - u_k+1 + u_k^3 + 0.5 v_k - f0_k
+//   F1 = -v_k-1 + 2 v_k - v_k+1 + v_k + 0.1 u_k^2 - f1_k
+//
+// with f chosen so that the exact solution is known.
+struct CoupledDiffusion {
+  CoupledDiffusion(int ncols, int ncells) :
+      n(ncols), ncells(ncells), exact(2*ncols*ncells), f(2*ncols*ncells)
+  {
+    for (int k=0; k!=ncells; ++k) {
+      for (int i=0; i!=n; ++i) {
+        exact[k*n + i] = 0.5 + 0.1 * i + 0.01 * k;
+        exact[(ncells + k)*n + i] = 1. - 0.05 * i + 0.02 * k;
+      }
+    }
+    std::vector<double> r(f.size());
+    Residual(exact.data(), r.data());
+    f = r;
+  }
+
+  double u(const double* x, int r, int k, int i) const {
+    return (k < 0 || k >= ncells) ? 0. : x[(r*ncells + k)*n + i];
+  }
+
+  void Residual(const double* x, double* r) {
+    for (int k=0; k!=ncells; ++k) {
+      for (int i=0; i!=n; ++i) {
+        double u0 = u(x,0,k,i), v0 = u(x,1,k,i);
+        double& r0 = r[k*n + i];
+        double& r1 = r[(ncells + k)*n + i];
+        r0 = -u(x,0,k-1,i) + 2*u0 - u(x,0,k+1,i) + u0*u0*u0 + 0.5*v0;
+        r1 = -u(x,1,k-1,i) + 2*v0 - u(x,1,k+1,i) + v0 + 0.1*u0*u0;
+        r0 -= f[k*n + i];
+        r1 -= f[(ncells + k)*n + i];
+        if (i == nan_col) r0 = std::numeric_limits<double>::quiet_NaN();
+      }
+    }
+  }
+
+  void Jacobian(const double* x, BatchedBlockTridiagonal& J) {
+    J.PutScalar(0.);
+    for (int k=0; k!=ncells; ++k) {
+      for (int i=0; i!=n; ++i) {
+        if (i == singular_col) continue;
+        int ki = k*n + i;
+        double u0 = u(x,0,k,i);
+        J.D(0,0)[ki] = 2 + 3*u0*u0;
+        J.D(0,1)[ki] = 0.5;
+        J.D(1,0)[ki] = 0.2*u0;
+        J.D(1,1)[ki] = 3.;
+        J.L(0,0)[ki] = J.L(1,1)[ki] = -1.;
+        J.U(0,0)[ki] = J.U(1,1)[ki] = -1.;
+      }
+    }
+  }
+
+  int n, ncells;
+  std::vector<double> exact, f;
+  int singular_col = -1;
+  int nan_col = -1;
+};
+
+} // namespace
+
+
+TEST(BLOCK_TRIDIAGONAL_SOLVE) {
+  const int ncols = 7, ncells = 9, nvars = 2;
+  BatchedBlockTridiagonal A(ncols, ncells, nvars);
+
+  // random, block diagonally dominant
+  std::mt19937 gen(42);
+  std::uniform_real_distribution<double> dist(-1., 1.);
+  for (int r=0; r!=nvars; ++r) {
+    for (int s=0; s!=nvars; ++s) {
+      for (int j=0; j!=ncells*ncols; ++j) {
+        A.L(r,s)[j] = dist(gen);
+        A.U(r,s)[j] = dist(gen);
+        A.D(r,s)[j] = dist(gen) + (r == s ? 8. : 0.);
+      }
+    }
+  }
+
+  std::vector<double> x(A.size()), b(A.size());
+  for (auto& xj : x) xj = dist(gen);
+  A.Apply(x.data(), b.data());
+
+  BatchedBlockTridiagonal LU(A);
+  CHECK_EQUAL(0, LU.Factor());
+  LU.Solve(b.data());
+  for (int j=0; j!=A.size(); ++j) CHECK_CLOSE(x[j], b[j], 1.e-12);
+}
+
+
+TEST(COLUMN_NEWTON) {
+  const int ncols = 13, ncells = 20;
+  CoupledDiffusion model(ncols, ncells);
+  BatchedBlockTridiagonal J(ncols, ncells, 2);
+
+  // start within the basin of quadratic convergence
+  std::vector<double> u(J.size());
+  for (int j=0; j!=J.size(); ++j) u[j] = 0.9 * model.exact[j];
+  int its = 0;
+  CHECK_EQUAL(0, ColumnNewton(model, J, u.data(), 1.e-10, 20, its));
+  CHECK(its <= 5);
+  for (int j=0; j!=J.size(); ++j) CHECK_CLOSE(model.exact[j], u[j], 1.e-9);
+}
+
+
+TEST(COLUMN_NEWTON_SINGULAR) {
+  const int ncols = 6, ncells = 10;
+  CoupledDiffusion model(ncols, ncells);
+  model.singular_col = 2;
+  model.nan_col = 4;
+  BatchedBlockTridiagonal J(ncols, ncells, 2);
+
+  std::vector<double> u(J.size(), 0.25);
+  int its = 0;
+  CHECK_EQUAL(2, ColumnNewton(model, J, u.data(), 1.e-10, 20, its));
+  CHECK(its < 20);
+
+  for (int j=0; j!=2*ncells; ++j) {
+    for (int i=0; i!=ncols; ++i) {
+      if (i == model.singular_col) {
+        // never updated
+        CHECK_EQUAL(0.25, u[j*ncols + i]);
+      } else if (i != model.nan_col) {
+        CHECK_CLOSE(model.exact[j*ncols + i], u[j*ncols + i], 1.e-9);
+      }
+    }
+  }
+}
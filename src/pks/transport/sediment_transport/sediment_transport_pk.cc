@@ -34,6 +34,7 @@
 #include "PK_Utils.hh"
 
 #include "sediment_transport_pk.hh"
+#include "transport_species_layout.hh"
 #include "TransportDomainFunction.hh"
 
 
@@ -548,6 +549,8 @@ void SedimentTransport_PK::InitializeAll_()
   // global transport parameters
   cfl_ = tp_list_->get<double>("cfl", 1.0);
 
+  interleave_species_ = tp_list_->get<bool>("species-interleaved advection", false);
+
   spatial_disc_order = tp_list_->get<int>("spatial discretization order", 1);
   if (spatial_disc_order < 1 || spatial_disc_order > 2) spatial_disc_order = 1;
   temporal_disc_order = tp_list_->get<int>("temporal discretization order", 1);
@@ -1026,31 +1029,43 @@ void SedimentTransport_PK::AdvanceDonorUpwind(double dt_cycle)
 
   
   // advance all components at once
-  for (int f = 0; f < nfaces_wghost; f++) {  // loop over master and slave faces
-    int c1 = (*upwind_cell_)[f];
-    int c2 = (*downwind_cell_)[f];
+  if (interleave_species_) {
+    std::vector<double> bc_mass(num_advect, 0.);
+    Transport::PackSpecies(tcc_prev, num_advect, ncells_wghost, tcc_interleaved_);
+    Transport::PackSpecies(*conserve_qty_, num_advect, ncells_wghost, cons_interleaved_);
+    Transport::DonorUpwindSpecies(dt_, num_advect, nfaces_wghost, ncells_owned,
+            *upwind_cell_, *downwind_cell_, *flux_,
+            tcc_interleaved_.data(), cons_interleaved_.data(), bc_mass.data());
+    Transport::UnpackSpecies(cons_interleaved_, num_advect, ncells_wghost, *conserve_qty_);
+    for (int i = 0; i < num_advect; i++) mass_sediment_bc_ += bc_mass[i];
 
-    double u = fabs((*flux_)[0][f]);
+  } else {
+    for (int f = 0; f < nfaces_wghost; f++) {  // loop over master and slave faces
+      int c1 = (*upwind_cell_)[f];
+      int c2 = (*downwind_cell_)[f];
 
-    if (c1 >=0 && c1 < ncells_owned && c2 >= 0 && c2 < ncells_owned) {
-      for (int i = 0; i < num_advect; i++) {
-        tcc_flux = dt_ * u * tcc_prev[i][c1];
-        (*conserve_qty_)[i][c1] -= tcc_flux;
-        (*conserve_qty_)[i][c2] += tcc_flux;
-      }
+      double u = fabs((*flux_)[0][f]);
+
+      if (c1 >=0 && c1 < ncells_owned && c2 >= 0 && c2 < ncells_owned) {
+        for (int i = 0; i < num_advect; i++) {
+          tcc_flux = dt_ * u * tcc_prev[i][c1];
+          (*conserve_qty_)[i][c1] -= tcc_flux;
+          (*conserve_qty_)[i][c2] += tcc_flux;
+        }
 
-    }
-    else if (c1 >=0 && c1 < ncells_owned && (c2 >= ncells_owned || c2 < 0)) {
-      for (int i = 0; i < num_advect; i++) {
-        tcc_flux = dt_ * u * tcc_prev[i][c1];
-        (*conserve_qty_)[i][c1] -= tcc_flux;
-        if (c2 < 0) mass_sediment_bc_ -= tcc_flux;
       }
+      else if (c1 >=0 && c1 < ncells_owned && (c2 >= ncells_owned || c2 < 0)) {
+        for (int i = 0; i < num_advect; i++) {
+          tcc_flux = dt_ * u * tcc_prev[i][c1];
+          (*conserve_qty_)[i][c1] -= tcc_flux;
+          if (c2 < 0) mass_sediment_bc_ -= tcc_flux;
+        }
 
-    } else if (c1 >= ncells_owned && c2 >= 0 && c2 < ncells_owned) {
-      for (int i = 0; i < num_advect; i++) {
-        tcc_flux = dt_ * u * tcc_prev[i][c1];
-        (*conserve_qty_)[i][c2] += tcc_flux;
+      } else if (c1 >= ncells_owned && c2 >= 0 && c2 < ncells_owned) {
+        for (int i = 0; i < num_advect; i++) {
+          tcc_flux = dt_ * u * tcc_prev[i][c1];
+          (*conserve_qty_)[i][c2] += tcc_flux;
+        }
       }
     }
   }
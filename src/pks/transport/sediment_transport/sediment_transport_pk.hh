@@ -249,6 +249,10 @@ typedef double AnalyticFunction(const AmanziGeometry::Point&, const double);
 
   double cfl_, dt_, dt_debug_, t_physics_;  
 
+  // species-interleaved work arrays for advection
+  bool interleave_species_;
+  std::vector<double> tcc_interleaved_, cons_interleaved_;
+
   double mass_sediment_exact_, mass_sediment_source_;  // mass for all sediment
   double mass_sediment_bc_, mass_sediment_stepstart_;
   std::vector<std::string> runtime_sediment_;  // names of trached sediment
@@ -109,6 +109,19 @@ The advection-diffusion equation for component *i* in the surface may be written
     * `"transport subcycling`" ``[bool]`` **true** The code will default to subcycling for transport within
       the master PK if there is one.
 
+    * `"local time stepping`" ``[bool]`` **false** When subcycling, advance
+      each cell with its own stable step instead of the globally smallest
+      one.  Steps are power-of-two fractions of a coarse step, and fluxes are
+      exchanged conservatively between cells of different steps.  Only
+      available with first-order spatial discretization.
+
+    * `"local time stepping maximum levels`" ``[int]`` **6** Maximum number
+      of halvings of the coarse step used by local time stepping.
+
+    * `"species-interleaved advection`" ``[bool]`` **false** Pack
+      concentrations cell-major (all species of a cell contiguous) for the
+      first-order advection face loop.  This is faster for many species.
+
 
     Developer parameters:
 
@@ -253,6 +266,7 @@ The advection-diffusion equation for component *i* in the surface may be written
 // Amanzi
 #include "CompositeVector.hh"
 #include "DiffusionPhase.hh"
+#include "face_cell_connectivity.hh"
 #include "Explicit_TI_FnBase.hh"
 #include "MaterialProperties.hh"
 #include "PK.hh"
@@ -388,6 +402,7 @@ private:
 
   // advection members
   void AdvanceDonorUpwind(double dT);
+  int AdvanceDonorUpwindLocal_(double t_old, double t_new, double dt_shift, double dt_global);
   void AdvanceSecondOrderUpwindRKn(double dT);
   void AdvanceSecondOrderUpwindRK1(double dT);
   void AdvanceSecondOrderUpwindRK2(double dT);
@@ -480,6 +495,7 @@ protected:
   Teuchos::RCP<CompositeVector> tcc_w_src;
   Teuchos::RCP<CompositeVector> tcc_tmp;  // next tcc
   Teuchos::RCP<CompositeVector> tcc;  // smart mirrow of tcc
+  Teuchos::RCP<CompositeVector> tcc_work_;  // second subcycling buffer, swapped with tcc_tmp
   Teuchos::RCP<Epetra_MultiVector> conserve_qty_, solid_qty_, water_qty_;
   Teuchos::RCP<const Epetra_MultiVector> flux_;
   Teuchos::RCP<const Epetra_MultiVector> ws_, ws_prev_, phi_, mol_dens_, mol_dens_prev_;
@@ -492,6 +508,7 @@ protected:
 
   Teuchos::RCP<Epetra_IntVector> upwind_cell_;
   Teuchos::RCP<Epetra_IntVector> downwind_cell_;
+  Teuchos::RCP<Operators::FaceCellConnectivity> connectivity_;
 
   Teuchos::RCP<const Epetra_MultiVector> ws_start, ws_end;  // data for subcycling
   Teuchos::RCP<const Epetra_MultiVector> mol_dens_start, mol_dens_end;  // data for subcycling
@@ -531,6 +548,15 @@ protected:
 
   double cfl_, dt_, dt_debug_, t_physics_;
 
+  // species-interleaved work arrays for advection
+  bool interleave_species_;
+  std::vector<double> tcc_interleaved_, cons_interleaved_;
+
+  // local time stepping
+  bool local_time_stepping_;
+  int lts_max_levels_;
+  std::vector<double> dt_local_;  // stable time step of each owned cell
+
   std::vector<double> mass_solutes_exact_, mass_solutes_source_;  // mass for all solutes
   std::vector<double> mass_solutes_bc_, mass_solutes_stepstart_;
   std::vector<std::string> runtime_solutes_;  // names of trached solutes
@@ -551,6 +577,7 @@ protected:
 
   Teuchos::RCP<VerboseObject> vo_;
   Teuchos::RCP<Debugger> db_;
+  bool debugging_;  // does db_ write anything?
 
   // Forbidden.
   Transport_ATS(const Transport_ATS&);
@@ -39,6 +39,19 @@ void Transport_ATS::InitializeAll_()
   temporal_disc_order = plist_->get<int>("temporal discretization order", 1);
   if (temporal_disc_order < 1 || temporal_disc_order > 2) temporal_disc_order = 1;
 
+  interleave_species_ = plist_->get<bool>("species-interleaved advection", false);
+
+  local_time_stepping_ = plist_->get<bool>("local time stepping", false);
+  lts_max_levels_ = plist_->get<int>("local time stepping maximum levels", 6);
+  if (local_time_stepping_ && spatial_disc_order != 1) {
+    Errors::Message msg("Transport PK: \"local time stepping\" requires \"spatial discretization order\" 1.");
+    Exceptions::amanzi_throw(msg);
+  }
+  if (lts_max_levels_ < 0 || lts_max_levels_ > 20) {
+    Errors::Message msg("Transport PK: \"local time stepping maximum levels\" must be in [0, 20].");
+    Exceptions::amanzi_throw(msg);
+  }
+
   num_aqueous = plist_->get<int>("number of aqueous components", component_names_.size());
   num_gaseous = plist_->get<int>("number of gaseous components", 0);
 
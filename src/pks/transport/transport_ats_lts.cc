@@ -0,0 +1,288 @@
+/*
+  Transport PK
+
+  Copyright 2010-201x held jointly by LANS/LANL, LBNL, and PNNL.
+  Amanzi is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Author: Ethan Coon (ecoon@lanl.gov)
+*/
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "Epetra_Import.h"
+#include "Epetra_Vector.h"
+
+#include "transport_ats.hh"
+
+namespace Amanzi {
+namespace Transport {
+
+namespace {
+
+// level of the cells whose step starts (or ends) at fine step j of a coarse
+// step split into 2^L fine steps: all levels k >= L - (trailing zeros of j)
+int FirstActiveLevel_(int j, int L)
+{
+  if (j == 0) return 0;
+  int tz = 0;
+  while (tz < L && (j & 1) == 0) { j >>= 1; ++tz; }
+  return L - tz;
+}
+
+} // namespace
+
+
+/* *******************************************************************
+* Multirate version of AdvanceDonorUpwind() for subcycled transport.
+*
+* The MPC step is split into coarse steps H which are stable in every
+* cell after at most "local time stepping maximum levels" halvings.  A
+* cell of level k is advanced with H / 2^k, the largest such step below
+* its own stable step, and a face is advanced with the step of the finer
+* of its two cells.  Fluxes are accumulated into the conserved mass of
+* both neighbors, so that the scheme is conservative, and a cell's
+* concentration is recovered only at the end of its own step.  Since a
+* cell's outflow over its step is bounded by its own stable step,
+* positivity is preserved as in the global scheme.
+*
+* Returns the number of fine steps taken.
+******************************************************************* */
+int Transport_ATS::AdvanceDonorUpwindLocal_(double t_old, double t_new,
+        double dt_shift, double dt_global)
+{
+  double dt_MPC = t_new - t_old;
+  int num_advect = num_aqueous;
+  int num_components = tcc_tmp->ViewComponent("cell", false)->NumVectors();
+
+  mass_solutes_source_.assign(num_aqueous + num_gaseous, 0.0);
+  mass_solutes_bc_.assign(num_aqueous + num_gaseous, 0.0);
+
+  // coarse step, chosen so that its finest subdivision is globally stable
+  int max_levels = lts_max_levels_;
+  int ncoarse = std::max(1, (int) std::ceil(dt_MPC / (dt_ * (1 << max_levels)) - 1.e-10));
+  double H = dt_MPC / ncoarse;
+
+  // cell levels, ghosted for the face levels
+  const Epetra_Map& cmap_owned = mesh_->cell_map(false);
+  const Epetra_Map& cmap_wghost = mesh_->cell_map(true);
+  if (cell_importer == Teuchos::null)
+    cell_importer = Teuchos::rcp(new Epetra_Import(cmap_wghost, cmap_owned));
+
+  Epetra_Vector level_owned(cmap_owned);
+  int L_local = 0;
+  for (int c = 0; c < ncells_owned; c++) {
+    int k = 0;
+    while (k < max_levels && H / (1 << k) > dt_local_[c] * (1 + 1.e-10)) k++;
+    level_owned[c] = k;
+    L_local = std::max(L_local, k);
+  }
+  int L = L_local;
+  mesh_->get_comm()->MaxAll(&L_local, &L, 1);
+
+  Epetra_Vector level(cmap_wghost);
+  level.Import(level_owned, *cell_importer, Insert);
+
+  std::vector<std::vector<int> > cells_by_level(L + 1), faces_by_level(L + 1);
+  for (int c = 0; c < ncells_owned; c++) {
+    cells_by_level[(int) level[c]].push_back(c);
+  }
+  std::vector<int> face_level(nfaces_wghost, -1);
+  for (int f = 0; f < nfaces_wghost; f++) {
+    int c1 = (*upwind_cell_)[f];
+    int c2 = (*downwind_cell_)[f];
+    int k = std::max(c1 >= 0 ? (int) level[c1] : -1, c2 >= 0 ? (int) level[c2] : -1);
+    if (k >= 0) {
+      face_level[f] = k;
+      faces_by_level[k].push_back(f);
+    }
+  }
+
+  int nfine = 1 << L;
+  double h = H / nfine;
+
+  // saturation and water in a cell at time s past the beginning of the MPC step
+  auto saturation = [&,this](int c, double s) {
+    double a = (dt_shift + s) / dt_global;
+    return (1.0 - a) * (*ws_prev_)[0][c] + a * (*ws_)[0][c];
+  };
+  auto water = [&,this](int c, double s) {
+    double a = (dt_shift + s) / dt_global;
+    return mesh_->cell_volume(c) * (*phi_)[0][c] * saturation(c, s)
+        * ((1.0 - a) * (*mol_dens_prev_)[0][c] + a * (*mol_dens_)[0][c]);
+  };
+
+  // all work is done in tcc_tmp, which holds the concentration at the start
+  // of each cell's current step
+  *tcc_tmp = *tcc;
+  tcc_tmp->ScatterMasterToGhosted("cell");
+  Epetra_MultiVector& tcc_next = *tcc_tmp->ViewComponent("cell", true);
+  conserve_qty_->PutScalar(0.);
+
+  // boundary inflow and source rates, evaluated once per coarse step
+  struct BCEntry { int f, c2, k; double value; };
+  std::vector<std::vector<BCEntry> > bcs_by_level(L + 1);
+  std::vector<double> src_rate, src_water;
+
+  for (int n = 0; n < ncoarse; n++) {
+    double t0 = t_old + n * H;
+
+    for (auto& bcs : bcs_by_level) bcs.clear();
+    for (int m = 0; m < bcs_.size(); m++) {
+      bcs_[m]->Compute(t0, t0 + H);
+      std::vector<int>& tcc_index = bcs_[m]->tcc_index();
+      for (auto it = bcs_[m]->begin(); it != bcs_[m]->end(); ++it) {
+        int f = it->first;
+        int c2 = (*downwind_cell_)[f];
+        if (c2 < 0) continue;
+        for (int i = 0; i < tcc_index.size(); i++) {
+          if (tcc_index[i] < num_advect)
+            bcs_by_level[face_level[f]].push_back(BCEntry{f, c2, tcc_index[i], it->second[i]});
+        }
+      }
+    }
+
+    if (srcs_.size() != 0) {
+      src_rate.assign(ncells_owned * num_advect, 0.0);
+      src_water.assign(ncells_owned, 0.0);
+      for (int m = 0; m < srcs_.size(); m++) {
+        srcs_[m]->Compute(t0, t0 + H);
+        std::vector<int> tcc_index = srcs_[m]->tcc_index();
+        for (auto it = srcs_[m]->begin(); it != srcs_[m]->end(); ++it) {
+          int c = it->first;
+          if (c >= ncells_owned) continue;
+          std::vector<double>& values = it->second;
+
+          if (srcs_[m]->name() == "domain coupling") src_water[c] += values[num_components];
+          for (int k = 0; k < tcc_index.size(); ++k) {
+            int i = tcc_index[k];
+            if (i < num_advect) src_rate[c * num_advect + i] += mesh_->cell_volume(c) * values[k];
+          }
+        }
+      }
+    }
+
+    for (int j = 0; j < nfine; j++) {
+      double s0 = n * H + j * h;
+
+      // cells starting a step: conserved quantities from the current state
+      for (int k = FirstActiveLevel_(j, L); k <= L; k++) {
+        double hk = H / (1 << k);
+        for (int c : cells_by_level[k]) {
+          double vol_phi_ws_den = water(c, s0);
+          double ws_start = saturation(c, s0);
+          (*conserve_qty_)[num_components][c] = 0.;
+          (*conserve_qty_)[num_components+1][c] = vol_phi_ws_den;
+
+          for (int i = 0; i < num_advect; i++) {
+            (*conserve_qty_)[i][c] = tcc_next[i][c] * vol_phi_ws_den;
+
+            if (dissolution_) {
+              if ((ws_start > water_tolerance_) && ((*solid_qty_)[i][c] > 0)) {
+                double add_mass = std::min((*solid_qty_)[i][c], max_tcc_ * vol_phi_ws_den - (*conserve_qty_)[i][c]);
+                (*solid_qty_)[i][c] -= add_mass;
+                (*conserve_qty_)[i][c] += add_mass;
+              }
+            }
+          }
+
+          if (srcs_.size() != 0) {
+            (*conserve_qty_)[num_components][c] += src_water[c];
+            for (int i = 0; i < num_advect; i++) {
+              double value = src_rate[c * num_advect + i];
+              (*conserve_qty_)[i][c] += hk * value;
+              mass_solutes_exact_[i] += hk * value;
+            }
+          }
+        }
+      }
+
+      // active faces: donor upwind fluxes over the face's step
+      for (int k = FirstActiveLevel_(j, L); k <= L; k++) {
+        double hk = H / (1 << k);
+        for (int f : faces_by_level[k]) {
+          int c1 = (*upwind_cell_)[f];
+          int c2 = (*downwind_cell_)[f];
+          double u = hk * fabs((*flux_)[0][f]);
+
+          bool own1 = c1 >= 0 && c1 < ncells_owned;
+          bool own2 = c2 >= 0 && c2 < ncells_owned;
+          if (own1) {
+            for (int i = 0; i < num_advect; i++) {
+              double tcc_flux = u * tcc_next[i][c1];
+              (*conserve_qty_)[i][c1] -= tcc_flux;
+              if (own2) (*conserve_qty_)[i][c2] += tcc_flux;
+              else if (c2 < 0) mass_solutes_bc_[i] -= tcc_flux;
+            }
+            (*conserve_qty_)[num_components+1][c1] -= u;
+            if (own2) (*conserve_qty_)[num_components+1][c2] += u;
+          } else if (own2) {
+            if (c1 >= ncells_owned) {
+              for (int i = 0; i < num_advect; i++) {
+                (*conserve_qty_)[i][c2] += u * tcc_next[i][c1];
+              }
+            }
+            (*conserve_qty_)[num_components+1][c2] += u;
+          }
+        }
+
+        for (const auto& bc : bcs_by_level[k]) {
+          double tcc_flux = hk * fabs((*flux_)[0][bc.f]) * bc.value;
+          (*conserve_qty_)[bc.k][bc.c2] += tcc_flux;
+          mass_solutes_bc_[bc.k] += tcc_flux;
+        }
+      }
+
+      // cells ending a step: recover concentration from conserved quantities
+      double s1 = s0 + h;
+      for (int k = FirstActiveLevel_(j + 1, L); k <= L; k++) {
+        for (int c : cells_by_level[k]) {
+          double water_new = water(c, s1);
+          double water_sink = (*conserve_qty_)[num_components][c];
+          double water_total = water_new + water_sink;
+          AMANZI_ASSERT(water_total >= water_new);
+          (*conserve_qty_)[num_components][c] = water_total;
+
+          for (int i = 0; i < num_advect; i++) {
+            if (water_new > water_tolerance_ && (*conserve_qty_)[i][c] > 0) {
+              tcc_next[i][c] = (*conserve_qty_)[i][c] / water_total;
+            } else if (water_sink > water_tolerance_ && (*conserve_qty_)[i][c] > 0) {
+              tcc_next[i][c] = 0.;
+            } else {
+              (*solid_qty_)[i][c] += std::max((*conserve_qty_)[i][c], 0.);
+              (*conserve_qty_)[i][c] = 0.;
+              tcc_next[i][c] = 0.;
+            }
+          }
+        }
+      }
+
+      tcc_tmp->ScatterMasterToGhosted("cell");
+    }
+
+    if (multiscale_porosity_) {
+      AddMultiscalePorosity_(t_old, t_new, t0, t0 + H);
+    }
+  }
+
+  t_physics_ = t_new;
+  if (debugging_) db_->WriteCellVector("cons (lts)", *conserve_qty_);
+  if (debugging_) db_->WriteCellVector("tcc_new", tcc_next);
+
+  if (internal_tests) {
+    VV_CheckGEDproperty(*tcc_tmp->ViewComponent("cell"));
+  }
+
+  if (vo_->os_OK(Teuchos::VERB_HIGH)) {
+    Teuchos::OSTab tab = vo_->getOSTab();
+    *vo_->os() << "local time stepping: " << ncoarse << " coarse steps of " << L + 1
+               << " levels, H=" << units_.OutputTime(H) << " [sec]" << std::endl;
+  }
+  return ncoarse * nfine;
+}
+
+}  // namespace Transport
+}  // namespace Amanzi
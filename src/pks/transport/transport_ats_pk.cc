@@ -38,7 +38,9 @@
 #include "TransportSourceFunction_Alquimia.hh"
 #include "TransportDomainFunction_UnitConversion.hh"
 
+#include "pk_helpers.hh"
 #include "transport_ats.hh"
+#include "transport_species_layout.hh"
 
 namespace Amanzi {
 namespace Transport {
@@ -263,6 +265,7 @@ void Transport_ATS::Setup(const Teuchos::Ptr<State>& S)
   auto pk_name = Keys::cleanPListName(plist_->name());
   vo_ = Teuchos::rcp(new VerboseObject(pk_name, *plist_));
   db_ = Teuchos::rcp(new Debugger(mesh_, pk_name, *plist_));
+  debugging_ = isDebugging(*plist_, *vo_);
 }
 
 
@@ -347,6 +350,7 @@ void Transport_ATS::Initialize(const Teuchos::Ptr<State>& S)
   const Epetra_Map& fmap_wghost = mesh_->face_map(true);
   upwind_cell_ = Teuchos::rcp(new Epetra_IntVector(fmap_wghost));
   downwind_cell_ = Teuchos::rcp(new Epetra_IntVector(fmap_wghost));
+  connectivity_ = Teuchos::rcp(new Operators::FaceCellConnectivity(*mesh_));
 
   IdentifyUpwindCells();
 
@@ -663,12 +667,14 @@ double Transport_ATS::StableTimeStep()
   vol=0;
   dt_ = dt_cell = TRANSPORT_LARGE_TIME_STEP;
   int cmin_dt = 0;
+  if (local_time_stepping_) dt_local_.assign(ncells_owned, TRANSPORT_LARGE_TIME_STEP);
   for (int c = 0; c < ncells_owned; c++) {
     outflux = total_outflux[c];
 
     if ((outflux > 0) && ((*ws_prev_)[0][c]>0) && ((*ws_)[0][c]>0) && ((*phi_)[0][c] > 0 )) {
       vol = mesh_->cell_volume(c);
       dt_cell = vol * (*mol_dens_)[0][c] * (*phi_)[0][c] * std::min( (*ws_prev_)[0][c], (*ws_)[0][c] ) / outflux;
+      if (local_time_stepping_) dt_local_[c] = cfl_ * std::min(dt_cell, dt_debug_);
     }
     if (dt_cell < dt_) {
       dt_ = dt_cell;
@@ -803,7 +809,7 @@ bool Transport_ATS::AdvanceStep(double t_old, double t_new, bool reinit)
   // We use original tcc and make a copy of it later if needed.
   tcc = S_inter_->GetFieldData(tcc_key_, name_);
   Epetra_MultiVector& tcc_prev = *tcc->ViewComponent("cell");
-  db_->WriteVector("tcc_old", tcc.ptr());
+  if (debugging_) db_->WriteVector("tcc_old", tcc.ptr());
 
   // calculate stable time step
   double dt_shift = 0.0, dt_global = dt_MPC;
@@ -844,7 +850,7 @@ bool Transport_ATS::AdvanceStep(double t_old, double t_new, bool reinit)
     mol_dens_end = mol_dens_;
   }
 
-  db_->WriteVector("sat_old", S_inter_->GetFieldData(prev_saturation_key_).ptr());
+  if (debugging_) db_->WriteVector("sat_old", S_inter_->GetFieldData(prev_saturation_key_).ptr());
   for (int c = 0; c < ncells_owned; c++) {
     double vol_phi_ws_den;
     vol_phi_ws_den = mesh_->cell_volume(c) * (*phi_)[0][c] * (*ws_prev_)[0][c] * (*mol_dens_prev_)[0][c];
@@ -853,7 +859,17 @@ bool Transport_ATS::AdvanceStep(double t_old, double t_new, bool reinit)
     }
   }
 
+  // Subcycles ping-pong between tcc_tmp and a work vector, so that the
+  // result of one subcycle is the initial state of the next without new
+  // memory.  The final result is moved back into tcc_tmp below.
+  Teuchos::RCP<CompositeVector> tcc_result = tcc_tmp;
+
   int ncycles = 0, swap = 1;
+  if (subcycling_ && local_time_stepping_) {
+    ncycles = AdvanceDonorUpwindLocal_(t_old, t_new, dt_shift, dt_global);
+    dt_sum = dt_MPC;
+  }
+
   while (dt_sum < dt_MPC - 1e-6) {
     // update boundary conditions
     time = t_physics_ + dt_cycle / 2;
@@ -915,8 +931,20 @@ bool Transport_ATS::AdvanceStep(double t_old, double t_new, bool reinit)
       AddMultiscalePorosity_(t_old, t_new, t_int1, t_int2);
     }
 
-    if (! final_cycle) {  // rotate concentrations (we need new memory for tcc)
-      tcc = Teuchos::RCP<CompositeVector>(new CompositeVector(*tcc_tmp));
+    if (! final_cycle) {  // rotate concentrations
+      if (tcc_work_ == Teuchos::null) {
+        tcc_work_ = Teuchos::rcp(new CompositeVector(*tcc_tmp));
+      } else if (ncycles == 0) {
+        // components which are not advanced are not written, keep them in sync
+        Epetra_MultiVector& work = *tcc_work_->ViewComponent("cell", false);
+        const Epetra_MultiVector& next = *tcc_tmp->ViewComponent("cell", false);
+        for (int i = num_aqueous; i < next.NumVectors(); i++) {
+          work(i)->Update(1.0, *next(i), 0.0);
+        }
+      }
+      Teuchos::RCP<CompositeVector> tcc_free = (tcc_tmp == tcc_result) ? tcc_work_ : tcc_result;
+      tcc = tcc_tmp;
+      tcc_tmp = tcc_free;
     }
 
     ncycles++;
@@ -924,6 +952,12 @@ bool Transport_ATS::AdvanceStep(double t_old, double t_new, bool reinit)
 
   dt_ = dt_stable;  // restore the original time step (just in case)
 
+  if (tcc_tmp != tcc_result) {
+    *tcc_result->ViewComponent("cell", true) = *tcc_tmp->ViewComponent("cell", true);
+    tcc = tcc_tmp;
+    tcc_tmp = tcc_result;
+  }
+
   Epetra_MultiVector& tcc_next = *tcc_tmp->ViewComponent("cell", false);
 
   Advance_Dispersion_Diffusion(t_old, t_new);
@@ -1279,46 +1313,64 @@ void Transport_ATS::AdvanceDonorUpwind(double dt_cycle)
     }
   }
 
-  db_->WriteCellVector("cons (start)", *conserve_qty_);
+  if (debugging_) db_->WriteCellVector("cons (start)", *conserve_qty_);
   tmp1 = mass_start;
   mesh_->get_comm()->SumAll(&tmp1, &mass_start, 1);
 
   // advance all components at once
-  for (int f = 0; f < nfaces_wghost; f++) {  // loop over master and slave faces
-    int c1 = (*upwind_cell_)[f];
-    int c2 = (*downwind_cell_)[f];
-    double u = fabs((*flux_)[0][f]);
-
-    if (c1 >=0 && c1 < ncells_owned && c2 >= 0 && c2 < ncells_owned) {
-      for (int i = 0; i < num_advect; i++) {
-        double tcc_flux = dt_ * u * tcc_prev[i][c1];
-        (*conserve_qty_)[i][c1] -= tcc_flux;
-        (*conserve_qty_)[i][c2] += tcc_flux;
-      }
-      (*conserve_qty_)[num_components+1][c1] -= dt_ * u;
-      (*conserve_qty_)[num_components+1][c2] += dt_ * u;
+  if (interleave_species_) {
+    PackSpecies(tcc_prev, num_advect, ncells_wghost, tcc_interleaved_);
+    PackSpecies(*conserve_qty_, num_advect, ncells_wghost, cons_interleaved_);
+    DonorUpwindSpecies(dt_, num_advect, nfaces_wghost, ncells_owned,
+                       *upwind_cell_, *downwind_cell_, *flux_,
+                       tcc_interleaved_.data(), cons_interleaved_.data(), mass_solutes_bc_.data());
+    UnpackSpecies(cons_interleaved_, num_advect, ncells_wghost, *conserve_qty_);
+
+    for (int f = 0; f < nfaces_wghost; f++) {
+      int c1 = (*upwind_cell_)[f];
+      int c2 = (*downwind_cell_)[f];
+      double u = fabs((*flux_)[0][f]);
+      if (c1 >= 0 && c1 < ncells_owned) (*conserve_qty_)[num_components+1][c1] -= dt_ * u;
+      if (c2 >= 0 && c2 < ncells_owned) (*conserve_qty_)[num_components+1][c2] += dt_ * u;
     }
-    else if (c1 >=0 && c1 < ncells_owned && (c2 >= ncells_owned || c2 < 0)) {
-      for (int i = 0; i < num_advect; i++) {
-        double tcc_flux = dt_ * u * tcc_prev[i][c1];
-        (*conserve_qty_)[i][c1] -= tcc_flux;
-        if (c2 < 0) mass_solutes_bc_[i] -= tcc_flux;
-        //AmanziGeometry::Point normal = mesh_->face_normal(f);
-      }
-      (*conserve_qty_)[num_components+1][c1] -= dt_ * u;
 
-    } else if (c1 >= ncells_owned && c2 >= 0 && c2 < ncells_owned) {
-      for (int i = 0; i < num_advect; i++) {
-        double tcc_flux = dt_ * u * tcc_prev[i][c1];
-        (*conserve_qty_)[i][c2] += tcc_flux;
+  } else {
+    for (int f = 0; f < nfaces_wghost; f++) {  // loop over master and slave faces
+      int c1 = (*upwind_cell_)[f];
+      int c2 = (*downwind_cell_)[f];
+      double u = fabs((*flux_)[0][f]);
+
+      if (c1 >=0 && c1 < ncells_owned && c2 >= 0 && c2 < ncells_owned) {
+        for (int i = 0; i < num_advect; i++) {
+          double tcc_flux = dt_ * u * tcc_prev[i][c1];
+          (*conserve_qty_)[i][c1] -= tcc_flux;
+          (*conserve_qty_)[i][c2] += tcc_flux;
+        }
+        (*conserve_qty_)[num_components+1][c1] -= dt_ * u;
+        (*conserve_qty_)[num_components+1][c2] += dt_ * u;
       }
-      (*conserve_qty_)[num_components+1][c2] += dt_ * u;
+      else if (c1 >=0 && c1 < ncells_owned && (c2 >= ncells_owned || c2 < 0)) {
+        for (int i = 0; i < num_advect; i++) {
+          double tcc_flux = dt_ * u * tcc_prev[i][c1];
+          (*conserve_qty_)[i][c1] -= tcc_flux;
+          if (c2 < 0) mass_solutes_bc_[i] -= tcc_flux;
+          //AmanziGeometry::Point normal = mesh_->face_normal(f);
+        }
+        (*conserve_qty_)[num_components+1][c1] -= dt_ * u;
 
-    } else if (c2 < 0 && c1 >= 0 && c1 < ncells_owned) {
-      (*conserve_qty_)[num_components+1][c1] -= dt_ * u;
+      } else if (c1 >= ncells_owned && c2 >= 0 && c2 < ncells_owned) {
+        for (int i = 0; i < num_advect; i++) {
+          double tcc_flux = dt_ * u * tcc_prev[i][c1];
+          (*conserve_qty_)[i][c2] += tcc_flux;
+        }
+        (*conserve_qty_)[num_components+1][c2] += dt_ * u;
 
-    } else if (c1 < 0 && c2 >= 0 && c2 < ncells_owned) {
-      (*conserve_qty_)[num_components+1][c2] += dt_ * u;
+      } else if (c2 < 0 && c1 >= 0 && c1 < ncells_owned) {
+        (*conserve_qty_)[num_components+1][c1] -= dt_ * u;
+
+      } else if (c1 < 0 && c2 >= 0 && c2 < ncells_owned) {
+        (*conserve_qty_)[num_components+1][c2] += dt_ * u;
+      }
     }
   }
 
@@ -1346,14 +1398,14 @@ void Transport_ATS::AdvanceDonorUpwind(double dt_cycle)
       }
     }
   }
-  db_->WriteCellVector("cons (adv)", *conserve_qty_);
+  if (debugging_) db_->WriteCellVector("cons (adv)", *conserve_qty_);
 
   // process external sources
   if (srcs_.size() != 0) {
     double time = t_physics_;
     ComputeAddSourceTerms(time, dt_, *conserve_qty_, 0, num_advect - 1);
   }
-  db_->WriteCellVector("cons (src)", *conserve_qty_);
+  if (debugging_) db_->WriteCellVector("cons (src)", *conserve_qty_);
 
   // recover concentration from new conservative state
   for (int c = 0; c < ncells_owned; c++) {
@@ -1388,7 +1440,7 @@ void Transport_ATS::AdvanceDonorUpwind(double dt_cycle)
       }
     }
   }
-  db_->WriteCellVector("tcc_new", tcc_next);
+  if (debugging_) db_->WriteCellVector("tcc_new", tcc_next);
 
   double mass_final = 0;
   for (int c = 0; c < ncells_owned; c++) {
@@ -1427,7 +1479,7 @@ void Transport_ATS::AdvanceSecondOrderUpwindRK1(double dt_cycle)
   const Epetra_Map& cmap_wghost = mesh_->cell_map(true);
 
   // distribute vector of concentrations
-  S_inter_->GetFieldData(tcc_key_)->ScatterMasterToGhosted("cell");
+  tcc->ScatterMasterToGhosted("cell");
   Epetra_MultiVector& tcc_prev = *tcc->ViewComponent("cell", true);
   Epetra_MultiVector& tcc_next = *tcc_tmp->ViewComponent("cell", true);
 
@@ -1463,7 +1515,7 @@ void Transport_ATS::AdvanceSecondOrderUpwindRK1(double dt_cycle)
     Epetra_Vector*& component = tcc_prev(i);
     FunctionalTimeDerivative(T, *component, *(*conserve_qty_)(i));
   }
-  db_->WriteCellVector("cons (time_deriv)", *conserve_qty_);
+  if (debugging_) db_->WriteCellVector("cons (time_deriv)", *conserve_qty_);
 
   // calculate the new conc
   for (int c = 0; c < ncells_owned; c++) {
@@ -1491,7 +1543,7 @@ void Transport_ATS::AdvanceSecondOrderUpwindRK1(double dt_cycle)
       }
     }
   }
-  db_->WriteCellVector("tcc_new", tcc_next);
+  if (debugging_) db_->WriteCellVector("tcc_new", tcc_next);
 
   // update mass balance
   for (int i = 0; i < num_aqueous + num_gaseous; i++) {
@@ -1519,7 +1571,7 @@ void Transport_ATS::AdvanceSecondOrderUpwindRK2(double dt_cycle)
   Epetra_Vector f_component(cmap_wghost);//,  f_component2(cmap_wghost);
 
   // distribute old vector of concentrations
-  S_inter_->GetFieldData(tcc_key_)->ScatterMasterToGhosted("cell");
+  tcc->ScatterMasterToGhosted("cell");
   Epetra_MultiVector& tcc_prev = *tcc->ViewComponent("cell", true);
   Epetra_MultiVector& tcc_next = *tcc_tmp->ViewComponent("cell", true);
 
@@ -1769,21 +1821,16 @@ void Transport_ATS::IdentifyUpwindCells()
   for (int f = 0; f < nfaces_wghost; f++) {
     (*upwind_cell_)[f] = -1;  // negative value indicates boundary
     (*downwind_cell_)[f] = -1;
-  }
-
-  AmanziMesh::Entity_ID_List faces;
-  std::vector<int> dirs;
-  for (int c = 0; c < ncells_wghost; c++) {
-    mesh_->cell_get_faces_and_dirs(c, &faces, &dirs);
 
-    for (int i = 0; i < faces.size(); i++) {
-      int f = faces[i];
-      double tmp = (*flux_)[0][f] * dirs[i];
+    for (int n = 0; n < connectivity_->num_cells(f); n++) {
+      int c = connectivity_->cell(f, n);
+      int dir = connectivity_->dir(f, n);
+      double tmp = (*flux_)[0][f] * dir;
       if (tmp > 0.0) {
         (*upwind_cell_)[f] = c;
       } else if (tmp < 0.0) {
         (*downwind_cell_)[f] = c;
-      } else if (dirs[i] > 0) {
+      } else if (dir > 0) {
         (*upwind_cell_)[f] = c;
       } else {
         (*downwind_cell_)[f] = c;
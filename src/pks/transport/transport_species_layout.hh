@@ -0,0 +1,93 @@
+/*
+  Transport PK
+
+  Copyright 2010-201x held jointly by LANS/LANL, LBNL, and PNNL.
+  Amanzi is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Author: Ethan Coon (ecoon@lanl.gov)
+*/
+
+/*
+  Species-interleaved (cell-major) work arrays for multi-species kernels.
+
+  Concentrations are stored species-major, one Epetra vector per species, so
+  that a face loop over all species touches one cache line per species.
+  Kernels instead work on arrays packed as packed[c * nspecies + i], which
+  are filled and emptied once per subcycle.
+*/
+
+#ifndef AMANZI_TRANSPORT_SPECIES_LAYOUT_HH_
+#define AMANZI_TRANSPORT_SPECIES_LAYOUT_HH_
+
+#include <cmath>
+#include <vector>
+
+#include "Epetra_IntVector.h"
+#include "Epetra_MultiVector.h"
+
+namespace Amanzi {
+namespace Transport {
+
+// Copy the first nspecies vectors of v on cells [0, ncells) into packed.
+inline void
+PackSpecies(const Epetra_MultiVector& v, int nspecies, int ncells,
+            std::vector<double>& packed)
+{
+  packed.resize(ncells * nspecies);
+  for (int i = 0; i < nspecies; i++) {
+    const double* vi = v[i];
+    for (int c = 0; c < ncells; c++) packed[c * nspecies + i] = vi[c];
+  }
+}
+
+
+// Copy packed back into the first nspecies vectors of v on cells [0, ncells).
+inline void
+UnpackSpecies(const std::vector<double>& packed, int nspecies, int ncells,
+              Epetra_MultiVector& v)
+{
+  for (int i = 0; i < nspecies; i++) {
+    double* vi = v[i];
+    for (int c = 0; c < ncells; c++) vi[c] = packed[c * nspecies + i];
+  }
+}
+
+
+// Donor upwind fluxes of all species over a step dt on packed arrays.  Mass
+// is moved from the upwind to the downwind cell where those are owned, and
+// mass leaving through the domain boundary is accumulated in bc_mass.
+inline void
+DonorUpwindSpecies(double dt, int nspecies, int nfaces, int ncells_owned,
+                   const Epetra_IntVector& upwind_cell,
+                   const Epetra_IntVector& downwind_cell,
+                   const Epetra_MultiVector& flux,
+                   const double* tcc, double* cons, double* bc_mass)
+{
+  for (int f = 0; f < nfaces; f++) {
+    int c1 = upwind_cell[f];
+    int c2 = downwind_cell[f];
+    bool own1 = c1 >= 0 && c1 < ncells_owned;
+    bool own2 = c2 >= 0 && c2 < ncells_owned;
+    if (c1 < 0 || !(own1 || own2)) continue;
+
+    double u = dt * std::abs(flux[0][f]);
+    const double* tcc1 = tcc + c1 * nspecies;
+    if (own1) {
+      double* cons1 = cons + c1 * nspecies;
+      for (int i = 0; i < nspecies; i++) cons1[i] -= u * tcc1[i];
+    }
+    if (own2) {
+      double* cons2 = cons + c2 * nspecies;
+      for (int i = 0; i < nspecies; i++) cons2[i] += u * tcc1[i];
+    } else if (c2 < 0) {
+      for (int i = 0; i < nspecies; i++) bc_mass[i] -= u * tcc1[i];
+    }
+  }
+}
+
+}  // namespace Transport
+}  // namespace Amanzi
+
+#endif
@@ -1,4 +1,5 @@
 import sys,os
+import sympy
 from sympy.printing import ccode
 
 _template_directory = os.path.dirname(os.path.abspath(__file__))
@@ -98,11 +99,31 @@ class EvalGen(object):
     def renderMyMethodDeclarationArgs(self):
         return ", ".join(["double %s"%var for var in self.vars])
 
+    def renderMyBatchArgs(self):
+        return ", ".join(["%s_v[0]"%var for var in self.vars])
+
+    def renderMyMethodBatchDeclarationArgs(self):
+        return ", ".join(["const double* %s"%var for var in self.vars])
+
+    def renderScalarCall(self, method, index=""):
+        """A call to a scalar model method, at point i of the argument arrays if index."""
+        return "%s(%s)"%(method, ", ".join([var+index for var in self.vars]))
+
+    def derivMethod(self, arg):
+        return "D%sD%s"%(self.d['myKeyMethod'],''.join([word[0].upper()+word[1:] for word in arg.split("_")]))
+
+    def batchExpression(self, expr):
+        """Substitutes point i of the argument arrays for the arguments."""
+        subs = dict((sym, sympy.Symbol("%s[i]"%sym.name)) for sym in expr.free_symbols
+                    if sym.name in self.vars)
+        return expr.subs(subs)
+
     def renderEvaluateModel(self):
         d = dict()
         d['keyEpetraVectorList'] = self.renderKeyEpetraVector()
         d['myKeyMethod'] = self.d['myKeyMethod']
         d['myMethodArgs'] = self.renderMyMethodArgs()
+        d['myBatchArgs'] = self.renderMyBatchArgs()
         return render('evaluator_evaluateModel.cc', d)
 
     def renderEvaluateDerivs(self):
@@ -139,7 +160,7 @@ class EvalGen(object):
 
     def renderModelDerivDeclarations(self):
         return '\n'.join([render('model_declaration.hh',
-                                 dict(myMethod="D%sD%s"%(self.d['myKeyMethod'],''.join([word[0].upper()+word[1:] for word in arg.split("_")])),
+                                 dict(myMethod=self.derivMethod(arg),
                                       myMethodDeclarationArgs=self.d['myMethodDeclarationArgs'])) for arg in self.args])
 
     def renderModelMethodImplementation(self):
@@ -163,11 +184,88 @@ class EvalGen(object):
                 implementation = "ASSERT(False)"
             impls.append(render('model_methodImplementation.cc',
                                 dict(evalClassName=self.d['evalClassName'],
-                                     myMethod="D%sD%s"%(self.d['myKeyMethod'],''.join([word[0].upper()+word[1:] for word in arg.split("_")])),
+                                     myMethod=self.derivMethod(arg),
                                      myMethodDeclarationArgs=self.d['myMethodDeclarationArgs'],
                                      myMethodImplementation=implementation)))
         return '\n\n'.join(impls)
     
+    def renderModelDerivativesImplementation(self):
+        """All partial derivatives in one call, sharing common subexpressions."""
+        if self.expression is not None:
+            derivs = [self.expression.diff(var) for var in self.vars]
+            temps, derivs = sympy.cse(derivs, symbols=sympy.numbered_symbols("t"))
+            lines = ["  double %s = %s;"%(t, ccode(e)) for t,e in temps]
+            lines += ["  d[%d] = %s;"%(k, ccode(e)) for k,e in enumerate(derivs)]
+            implementation = '\n'.join(lines)
+        else:
+            # no expression to differentiate, so call the hand-written derivatives
+            implementation = '\n'.join(["  d[%d] = %s;"%(k, self.renderScalarCall(self.derivMethod(arg)))
+                                        for k,arg in enumerate(self.args)])
+        return render('model_derivativesImplementation.cc',
+                      dict(evalClassName=self.d['evalClassName'],
+                           myMethod=self.d['myKeyMethod'],
+                           myMethodDeclarationArgs=self.d['myMethodDeclarationArgs'],
+                           myMethodImplementation=implementation))
+
+    def renderModelBatchImplementation(self):
+        if self.expression is not None:
+            implementation = "    out[i] = %s;"%ccode(self.batchExpression(self.expression))
+        else:
+            implementation = "    out[i] = %s;"%self.renderScalarCall(self.d['myKeyMethod'], "[i]")
+        return render('model_batchImplementation.cc',
+                      dict(evalClassName=self.d['evalClassName'],
+                           myMethod=self.d['myKeyMethod'],
+                           myMethodBatchDeclarationArgs=self.d['myMethodBatchDeclarationArgs'],
+                           myMethodImplementation=implementation))
+
+    def renderModelDerivativesBatchImplementation(self):
+        """All partial derivatives at all points, sharing common subexpressions."""
+        if self.expression is not None:
+            derivs = [self.batchExpression(self.expression.diff(var)) for var in self.vars]
+            temps, derivs = sympy.cse(derivs, symbols=sympy.numbered_symbols("t"))
+            lines = ["    double %s = %s;"%(t, ccode(e)) for t,e in temps]
+            lines += ["    d[%d*n + i] = %s;"%(k, ccode(e)) for k,e in enumerate(derivs)]
+            implementation = '\n'.join(lines)
+        else:
+            implementation = '\n'.join(["    d[%d*n + i] = %s;"%(k, self.renderScalarCall(self.derivMethod(arg), "[i]"))
+                                        for k,arg in enumerate(self.args)])
+        return render('model_derivativesBatchImplementation.cc',
+                      dict(evalClassName=self.d['evalClassName'],
+                           myMethod=self.d['myKeyMethod'],
+                           myMethodBatchDeclarationArgs=self.d['myMethodBatchDeclarationArgs'],
+                           myMethodImplementation=implementation))
+
+    def renderUpdateDerivative(self):
+        d = dict(self.d)
+        d['argKeyList'] = ", ".join(["%s_key_"%var for var in self.vars])
+        d['keyCompositeVectorListIndented'] = '\n'.join(["  "+line for line in self.renderKeyCompositeVector().split('\n')])
+        d['keyEpetraVectorList'] = self.renderKeyEpetraVector()
+        d['nargs'] = len(self.vars)
+        d['myBatchArgs'] = self.renderMyBatchArgs()
+        return render('evaluator_updateDerivative.cc', d)
+
+    def renderBenchmark(self):
+        d = dict(self.d)
+        d['nargs'] = len(self.vars)
+        d['benchArgs'] = ", ".join(["x[%d][i]"%k for k in range(len(self.vars))])
+        d['benchBatchArgs'] = ", ".join(["x[%d].data()"%k for k in range(len(self.vars))])
+
+        p_sets = []
+        for p, pname, pdefault in zip(self.pars, self.par_names, self.par_defaults):
+            if pdefault is not None:
+                p_sets.append('  plist.set<%s>("%s", %s);'%(p[0], pname, str(pdefault)))
+            elif p[0] == "double":
+                p_sets.append('  plist.set<double>("%s", 1.0);'%pname)
+        d['benchParamList'] = '\n'.join(p_sets)
+
+        calls = []
+        for k,arg in enumerate(self.args):
+            calls.append("    d_separate[i*nargs + %d] = model.D%sD%s(%s);"%(k, self.d['myKeyMethod'],
+                                     ''.join([word[0].upper()+word[1:] for word in arg.split("_")]),
+                                     d['benchArgs']))
+        d['benchSeparateCalls'] = '\n'.join(calls)
+        return render('model_bench.cc', d)
+
     def renderModelParamDeclarations(self):
         return '\n'.join(['  %s %s;'%p for p in self.pars])
 
@@ -190,6 +288,7 @@ class EvalGen(object):
         self.d['keyCompositeVectorList'] = self.renderKeyCompositeVector()
         self.d['myMethodArgs'] = self.renderMyMethodArgs()
         self.d['myMethodDeclarationArgs'] = self.renderMyMethodDeclarationArgs()
+        self.d['myMethodBatchDeclarationArgs'] = self.renderMyMethodBatchDeclarationArgs()
         self.d['evaluateModel'] = self.renderEvaluateModel()
         self.d['evaluateDerivs'] = self.renderEvaluateDerivs()
 
@@ -200,6 +299,10 @@ class EvalGen(object):
         self.d['modelMethodImplementation'] = self.renderModelMethodImplementation()
         self.d['modelDerivImplementationList'] = self.renderModelDerivImplementations()
         self.d['modelInitializeParamsList'] = self.renderModelParamInitializations()
+        self.d['modelDerivativesImplementation'] = self.renderModelDerivativesImplementation()
+        self.d['modelBatchImplementation'] = self.renderModelBatchImplementation()
+        self.d['modelDerivativesBatchImplementation'] = self.renderModelDerivativesBatchImplementation()
+        self.d['updateDerivative'] = self.renderUpdateDerivative()
 
 def generate_evaluator(name, namespace, descriptor, my_key, dependencies, parameters, **kwargs):
     """Generates an evaluator whose class is [name]Evaluator and model is [name]Model.
@@ -231,12 +334,17 @@ def generate_evaluator(name, namespace, descriptor, my_key, dependencies, parame
 
       directory: directory where output files are created
 
+      benchmark: if True, also write a standalone micro-benchmark comparing
+                 per-derivative model calls to the fused and batched
+                 derivatives calls
+
     Outputs:
       writes files: [name]_evaluator.hh
                     [name]_evaluator.cc
                     [name]_evaluator_reg.hh
                     [name]_model.hh
                     [name]_model.cc
+                    [name]_model_bench.cc (if benchmark)
     """
     eg = EvalGen(name, namespace, descriptor, my_key, **kwargs)
     for dep in dependencies:
@@ -260,6 +368,10 @@ def generate_evaluator(name, namespace, descriptor, my_key, dependencies, parame
         with open(os.path.join(directory, "%s_%s"%(name,outfile)), 'w') as fid:
             fid.write(render(outfile, eg.d))
 
+    if kwargs.get('benchmark', False):
+        with open(os.path.join(directory, "%s_model_bench.cc"%name), 'w') as fid:
+            fid.write(eg.renderBenchmark())
+
 
       
         
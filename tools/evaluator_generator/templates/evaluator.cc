@@ -4,6 +4,9 @@
   Generated via evaluator_generator.
 */
 
+#include <algorithm>
+#include <vector>
+
 #include "{evalName}_evaluator.hh"
 #include "{evalName}_model.hh"
 
@@ -69,6 +72,9 @@ void
 }}
 
 
+{updateDerivative}
+
+
 }} //namespace
 }} //namespace
 }} //namespace
@@ -39,6 +39,9 @@ class {evalClassName}Evaluator : public SecondaryVariableFieldEvaluator {{
  protected:
   void InitializeFromPlist_();
 
+  // Assembles the chain rule in a single pass over all partial derivatives.
+  virtual void UpdateFieldDerivative_(const Teuchos::Ptr<State>& S, Key wrt_key);
+
 {keyDeclarationList}
 
   Teuchos::RCP<{evalClassName}Model> model_;
@@ -4,7 +4,5 @@
     Epetra_MultiVector& result_v = *result->ViewComponent(*comp,false);
 
     int ncomp = result->size(*comp, false);
-    for (int i=0; i!=ncomp; ++i) {{
-      result_v[0][i] = model_->{myKeyMethod}({myMethodArgs});
-    }}
+    model_->{myKeyMethod}Batch({myBatchArgs}, result_v[0], ncomp);
   }}
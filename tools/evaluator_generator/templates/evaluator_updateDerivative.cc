@@ -0,0 +1,73 @@
+/* ******************************************************************
+* Fused chain rule for d({myKeyMethod})/d(wrt_key).
+*
+* The default implementation makes one sweep over the entities, and one
+* temporary vector, per dependency that depends upon wrt_key.  Here all
+* partial derivatives of the model are evaluated together, and the chain
+* rule is summed in a second pass, in the same order as the default.
+****************************************************************** */
+void
+{evalClassName}Evaluator::UpdateFieldDerivative_(const Teuchos::Ptr<State>& S,
+        Key wrt_key)
+{{
+  Key dmy_key = Keys::getDerivKey(my_key_, wrt_key);
+
+  Teuchos::RCP<CompositeVector> dmy;
+  if (S->HasField(dmy_key)) {{
+    dmy = S->GetFieldData(dmy_key, my_key_);
+  }} else {{
+    // or create the field.  Note we have to do extra work that is normally
+    // done by State in initialize.
+    Teuchos::RCP<CompositeVectorSpace> my_fac = S->RequireField(my_key_);
+    Teuchos::RCP<CompositeVectorSpace> new_fac = S->RequireField(dmy_key, my_key_);
+    new_fac->Update(*my_fac);
+    dmy = Teuchos::rcp(new CompositeVector(*my_fac));
+    S->SetData(dmy_key, my_key_, dmy);
+    S->GetField(dmy_key, my_key_)->set_initialized();
+    S->GetField(dmy_key, my_key_)->set_io_vis(false);
+    S->GetField(dmy_key, my_key_)->set_io_checkpoint(false);
+  }}
+
+  // terms of the chain rule: the index of the partial derivative in model
+  // argument order, and ddep/dwrt_key, or null if dep is wrt_key
+  const std::vector<Key> arg_keys = {{ {argKeyList} }};
+  std::vector<int> term_index;
+  std::vector<Teuchos::RCP<const CompositeVector> > term_ddep;
+  for (const auto& dep : dependencies_) {{
+    int j = std::find(arg_keys.begin(), arg_keys.end(), dep) - arg_keys.begin();
+    AMANZI_ASSERT(j < arg_keys.size());
+    if (dep == wrt_key) {{
+      term_index.push_back(j);
+      term_ddep.push_back(Teuchos::null);
+    }} else if (S->GetFieldEvaluator(dep)->IsDependency(S, wrt_key)) {{
+      term_index.push_back(j);
+      term_ddep.push_back(S->GetFieldData(Keys::getDerivKey(dep, wrt_key)));
+    }}
+  }}
+  int nterms = term_index.size();
+
+{keyCompositeVectorListIndented}
+
+  std::vector<double> d;
+  for (CompositeVector::name_iterator comp=dmy->begin();
+       comp!=dmy->end(); ++comp) {{
+{keyEpetraVectorList}
+    std::vector<const double*> ddep_v(nterms, nullptr);
+    for (int k=0; k!=nterms; ++k) {{
+      if (term_ddep[k] != Teuchos::null) ddep_v[k] = (*term_ddep[k]->ViewComponent(*comp, false))[0];
+    }}
+    Epetra_MultiVector& dmy_v = *dmy->ViewComponent(*comp, false);
+
+    int ncomp = dmy->size(*comp, false);
+    d.resize({nargs} * ncomp);
+    model_->{myKeyMethod}DerivativesBatch({myBatchArgs}, d.data(), ncomp);
+    for (int i=0; i!=ncomp; ++i) {{
+      double dmy_i = 0.;
+      for (int k=0; k!=nterms; ++k) {{
+        const double d_ik = d[term_index[k]*ncomp + i];
+        dmy_i += ddep_v[k] ? d_ik * ddep_v[k][i] : d_ik;
+      }}
+      dmy_v[0][i] = dmy_i;
+    }}
+  }}
+}}
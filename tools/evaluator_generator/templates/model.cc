@@ -35,6 +35,12 @@ void
 
 {modelDerivImplementationList}
 
+{modelDerivativesImplementation}
+
+{modelBatchImplementation}
+
+{modelDerivativesBatchImplementation}
+
 }} //namespace
 }} //namespace
 }} //namespace
@@ -23,6 +23,14 @@ class {evalClassName}Model {{
 {modelMethodDeclaration}
 
 {modelDerivDeclarationList}
+
+  // All of the above partial derivatives, in argument order, in one call.
+  void {myKeyMethod}Derivatives({myMethodDeclarationArgs}, double* d) const;
+
+  // Batched versions of the above over n points, where each argument is an
+  // array of length n.  Partial derivative k at point i is d[k*n + i].
+  void {myKeyMethod}Batch({myMethodBatchDeclarationArgs}, double* out, int n) const;
+  void {myKeyMethod}DerivativesBatch({myMethodBatchDeclarationArgs}, double* d, int n) const;
   
  protected:
   void InitializeFromPlist_(Teuchos::ParameterList& plist);
@@ -0,0 +1,7 @@
+void
+{evalClassName}Model::{myMethod}Batch({myMethodBatchDeclarationArgs}, double* out, int n) const
+{{
+  for (int i=0; i!=n; ++i) {{
+{myMethodImplementation}
+  }}
+}}
@@ -0,0 +1,67 @@
+/*
+  Micro-benchmark of the {evalNameString} model: one call per partial
+  derivative versus the fused {myKeyMethod}Derivatives() versus the batched
+  {myKeyMethod}DerivativesBatch().
+
+  Generated via evaluator_generator.  Build against Teuchos with the model,
+  e.g. c++ -O2 -I<teuchos> {evalName}_model_bench.cc {evalName}_model.cc,
+  and run with an optional number of cells.
+*/
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+#include "Teuchos_ParameterList.hpp"
+#include "{evalName}_model.hh"
+
+using namespace Amanzi::{namespace}::Relations;
+
+int main(int argc, char** argv)
+{{
+  int n = argc > 1 ? std::atoi(argv[1]) : 1000000;
+  const int nargs = {nargs};
+
+  Teuchos::ParameterList plist;
+{benchParamList}
+  {evalClassName}Model model(plist);
+
+  std::mt19937 gen(0);
+  std::uniform_real_distribution<double> dist(0.1, 1.0);
+  std::vector<std::vector<double> > x(nargs, std::vector<double>(n));
+  for (auto& x_v : x) {{
+    for (auto& v : x_v) v = dist(gen);
+  }}
+  std::vector<double> d_separate(n * nargs), d_fused(n * nargs), d_batch(n * nargs);
+
+  typedef std::chrono::steady_clock clock;
+  auto t0 = clock::now();
+  for (int i=0; i!=n; ++i) {{
+{benchSeparateCalls}
+  }}
+  auto t1 = clock::now();
+  for (int i=0; i!=n; ++i) {{
+    model.{myKeyMethod}Derivatives({benchArgs}, &d_fused[i*nargs]);
+  }}
+  auto t2 = clock::now();
+  model.{myKeyMethod}DerivativesBatch({benchBatchArgs}, d_batch.data(), n);
+  auto t3 = clock::now();
+
+  double diff = 0.;
+  for (int i=0; i!=n; ++i) {{
+    for (int k=0; k!=nargs; ++k) {{
+      diff = std::max(diff, std::abs(d_separate[i*nargs + k] - d_fused[i*nargs + k]));
+      diff = std::max(diff, std::abs(d_separate[i*nargs + k] - d_batch[k*n + i]));
+    }}
+  }}
+
+  std::printf("{evalName}: %d cells, separate %g s, fused %g s, batched %g s, max difference %g\n", n,
+              std::chrono::duration<double>(t1 - t0).count(),
+              std::chrono::duration<double>(t2 - t1).count(),
+              std::chrono::duration<double>(t3 - t2).count(), diff);
+  return 0;
+}}
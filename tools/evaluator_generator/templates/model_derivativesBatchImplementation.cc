@@ -0,0 +1,7 @@
+void
+{evalClassName}Model::{myMethod}DerivativesBatch({myMethodBatchDeclarationArgs}, double* d, int n) const
+{{
+  for (int i=0; i!=n; ++i) {{
+{myMethodImplementation}
+  }}
+}}
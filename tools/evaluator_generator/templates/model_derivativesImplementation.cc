@@ -0,0 +1,5 @@
+void
+{evalClassName}Model::{myMethod}Derivatives({myMethodDeclarationArgs}, double* d) const
+{{
+{myMethodImplementation}
+}}